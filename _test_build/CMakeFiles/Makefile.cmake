@@ -0,0 +1,173 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "src/version/CMakeFiles/git-data/grabRef.cmake"
+  "/root/repo/cmake/AppendTargetProperty.cmake"
+  "/root/repo/cmake/CheckSSEFeatures.cmake"
+  "/root/repo/cmake/FindAtomic.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake.in"
+  "/root/repo/cmake/MMseqsResourceCompiler.cmake"
+  "/root/repo/cmake/MMseqsSetupDerivedTarget.cmake"
+  "/root/repo/cmake/MMseqsSetupTest.cmake"
+  "/root/repo/data/CMakeLists.txt"
+  "/root/repo/data/resources/CMakeLists.txt"
+  "/root/repo/data/workflow/CMakeLists.txt"
+  "/root/repo/lib/alp/CMakeLists.txt"
+  "/root/repo/lib/cacode/CMakeLists.txt"
+  "/root/repo/lib/ksw2/CMakeLists.txt"
+  "/root/repo/lib/microtar/CMakeLists.txt"
+  "/root/repo/lib/tinyexpr/CMakeLists.txt"
+  "/root/repo/lib/zstd/build/cmake/CMakeModules/GetZstdLibraryVersion.cmake"
+  "/root/repo/lib/zstd/build/cmake/lib/CMakeLists.txt"
+  "/root/repo/lib/zstd/build/cmake/lib/cmake_uninstall.cmake.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/alignment/CMakeLists.txt"
+  "/root/repo/src/clustering/CMakeLists.txt"
+  "/root/repo/src/commons/CMakeLists.txt"
+  "/root/repo/src/linclust/CMakeLists.txt"
+  "/root/repo/src/multihit/CMakeLists.txt"
+  "/root/repo/src/prefiltering/CMakeLists.txt"
+  "/root/repo/src/taxonomy/CMakeLists.txt"
+  "/root/repo/src/test/CMakeLists.txt"
+  "/root/repo/src/util/CMakeLists.txt"
+  "/root/repo/src/version/CMakeLists.txt"
+  "/root/repo/src/workflow/CMakeLists.txt"
+  "/root/repo/util/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBZip2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/zstd/build/cmake/lib/cmake_uninstall.cmake"
+  "lib/zstd/build/cmake/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/tinyexpr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/microtar/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/cacode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/alp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/ksw2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "data/resources/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "data/workflow/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/alignment/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/clustering/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/commons/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/linclust/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/multihit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/prefiltering/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/taxonomy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/workflow/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/version/CMakeFiles/git-data/HEAD"
+  "src/version/CMakeFiles/git-data/grabRef.cmake"
+  "src/version/CMakeFiles/git-data/head-ref"
+  "src/version/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "util/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "lib/zstd/build/cmake/lib/CMakeFiles/libzstd_static.dir/DependInfo.cmake"
+  "lib/zstd/build/cmake/lib/CMakeFiles/libzstd.pc.dir/DependInfo.cmake"
+  "lib/zstd/build/cmake/lib/CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "lib/tinyexpr/CMakeFiles/tinyexpr.dir/DependInfo.cmake"
+  "lib/microtar/CMakeFiles/microtar.dir/DependInfo.cmake"
+  "lib/cacode/CMakeFiles/cacode.dir/DependInfo.cmake"
+  "lib/alp/CMakeFiles/alp.dir/DependInfo.cmake"
+  "lib/ksw2/CMakeFiles/ksw2.dir/DependInfo.cmake"
+  "data/CMakeFiles/generated.dir/DependInfo.cmake"
+  "src/CMakeFiles/mmseqs-framework.dir/DependInfo.cmake"
+  "src/CMakeFiles/mmseqs.dir/DependInfo.cmake"
+  "src/version/CMakeFiles/version.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_alignment.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_alignmentperformance.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_alignmenttraceback.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_alp.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_assigngroup.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_backtracetranslator.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_binaryalignment.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_clusteringpartitions.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_compositionbias.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_counting.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_dbreader.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_dbreaderindexserialization.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_diagonalscoring.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_diagonalscoringperformance.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_indextable.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_kmergenerator.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_kmermerge.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_kmernucl.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_kmerscore.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_kmersort.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_kmertable.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_kwaymerge.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_multiplealignment.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_prefilterpaths.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_profilealignment.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_pssm.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_pssmprune.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_dbreaderzstd.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_reducematrix.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_scorebatch.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_scorematrixserialization.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_sequenceindex.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_tantan.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_taxonomy.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_translate.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_tinyexpr.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_taxexpr.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_profilestates.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_ksw2.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test_bestalphabet.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../generated/CovSeqidQscPercMinDiag.lib.h"
+  "../generated/CovSeqidQscPercMinDiagTargetCov.lib.h"
+  "../generated/ExpOpt3_8_polished.cs32.lib.h"
+  "../generated/Library255_may17.lib.h"
+  "../generated/PAM30.out.h"
+  "../generated/VTML40.out.h"
+  "../generated/VTML80.out.h"
+  "../generated/blastn.sh.h"
+  "../generated/blastp.sh.h"
+  "../generated/blastpgp.sh.h"
+  "../generated/blosum62.out.h"
+  "../generated/cascaded_clustering.sh.h"
+  "../generated/clustering.sh.h"
+  "../generated/createindex.sh.h"
+  "../generated/createtaxdb.sh.h"
+  "../generated/cs219.lib.h"
+  "../generated/databases.sh.h"
+  "../generated/easycluster.sh.h"
+  "../generated/easyrbh.sh.h"
+  "../generated/easysearch.sh.h"
+  "../generated/easytaxonomy.sh.h"
+  "../generated/enrich.sh.h"
+  "../generated/krona_prelude.html.h"
+  "../generated/libPolished_8.lib.h"
+  "../generated/linclust.sh.h"
+  "../generated/linsearch.sh.h"
+  "../generated/map.sh.h"
+  "../generated/multihitdb.sh.h"
+  "../generated/multihitsearch.sh.h"
+  "../generated/nucleotide.out.h"
+  "../generated/nucleotide_clustering.sh.h"
+  "../generated/rbh.sh.h"
+  "../generated/result_viz_prelude.html.zst.h"
+  "../generated/searchslicedtargetprofile.sh.h"
+  "../generated/searchtargetprofile.sh.h"
+  "../generated/taxonomy.sh.h"
+  "../generated/taxpercontig.sh.h"
+  "../generated/translated_search.sh.h"
+  "../generated/update_clustering.sh.h"
+  "CMakeFiles/generated"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
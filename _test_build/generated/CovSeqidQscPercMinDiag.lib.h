@@ -0,0 +1,5138 @@
+static const unsigned char CovSeqidQscPercMinDiag_lib[] = {
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x31, 0x30, 0x31, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x35, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x30, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x31, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x34, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x33, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x33, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x31, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37,
+  0x31, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x34, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x33, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x34, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x33, 0x32, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x33, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x35, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x31, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x30, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x34, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x34, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x35, 0x35, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x30, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x31,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x38, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x31, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x34, 0x33, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x32, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x30, 0x31, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x30, 0x38, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x34, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x34, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x38, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x32, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x35, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38,
+  0x31, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x36, 0x32, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x37, 0x35, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x34, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x34, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x33, 0x35, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x35, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x34, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x36, 0x38, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x36, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x33, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x34, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x32, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x30, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x32, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x31, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x39, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x30, 0x35, 0x32, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35,
+  0x33, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x38, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x38, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x34, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x35, 0x32, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x36, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x37, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x32, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x34, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x37, 0x39, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x33, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x36, 0x36, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x31, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x35, 0x36, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x37, 0x34, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x34, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x36, 0x34, 0x0a, 0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x31,
+  0x32, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x32, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x31, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x37, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x34, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x34, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x32, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x39, 0x31, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x34, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x37, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x31, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x34, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x30, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x31, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x36, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33,
+  0x34, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35,
+  0x31, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x36, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x36, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x34, 0x34, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x31, 0x38, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x30, 0x34, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x33, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x30, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35,
+  0x34, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x33, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x36, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x36, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x31, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x31, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x31, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x35, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x37, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x34, 0x39, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x35, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x34, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x32, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x31, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x39, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x38, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x38, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x36, 0x30, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x38, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x30, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x35, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x35, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x39, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x37, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x30, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x34, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x34, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x36, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x35, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x33, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x33, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x32, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x30, 0x31, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x31, 0x38, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x32, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x38, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x39, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x32, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x38, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x35, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x30, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x35, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x36, 0x36, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x30, 0x35, 0x0a,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x32, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x33, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x37, 0x32, 0x0a, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x30, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x36, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31,
+  0x31, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x34, 0x37, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x32, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x33, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x32, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x37, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x30, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x36, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x30, 0x35, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x30, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x34, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x33, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x34, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x38, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x35, 0x32, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x35, 0x35, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x30, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x32, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x37, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x30, 0x31, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x37, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x30, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x30, 0x31, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x30, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x31, 0x31, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x34, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x34, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x35, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x36, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x38, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x32, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x37, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x33, 0x35, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x34, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x31, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x37, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x38, 0x37, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x33, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x30, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x30, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x37, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x31, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x32, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x34, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x33, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x34, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32,
+  0x30, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x31, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x34, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x31, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x30, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35,
+  0x38, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x36, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x35, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x36, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x35, 0x32, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x37, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x35, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x32, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x34, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x33, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x38, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x39, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x38, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32,
+  0x31, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x36, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x36, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x34, 0x30, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x33, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x37, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x33, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x37, 0x35, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x37, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x32, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x34, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x32, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x32, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x36, 0x35, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x31, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x34, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x36, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x31, 0x32, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x32, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36,
+  0x36, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x35, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x34, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35,
+  0x38, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x34, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x35, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x36, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x37, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x31, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x30,
+  0x37, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x31, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x30, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x37, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x37, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x37, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x32, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x33, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x33, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x34, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x31, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x36, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x37, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x35, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x37, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x34, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x38, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x32, 0x34, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x35, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x35, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x35, 0x36, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x37, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x31, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x34, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x31, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x38, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x34, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x35, 0x32, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x39, 0x31, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x34, 0x37, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x31, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x33, 0x0a, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x34, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x38, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x31, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x37, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x34, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x36, 0x32, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x34, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x38, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x39, 0x38, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x34, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39,
+  0x34, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x34, 0x32, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x31, 0x38, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x30, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x38, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x36, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x36, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x37, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x34, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x35, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x30, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x31, 0x38, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x36, 0x38, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x34, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36,
+  0x32, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x31, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x34, 0x34, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35,
+  0x30, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x34, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x37, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x34, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x30, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x38, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36,
+  0x32, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x35, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37,
+  0x34, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x34, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36,
+  0x31, 0x37, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x31, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35,
+  0x34, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x32, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x31,
+  0x33, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x36, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x36, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x30, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x38,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x30, 0x36, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x33, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x33, 0x30, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x38, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x37, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x37, 0x30, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x34, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x31, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x33, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x30, 0x31, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x33, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x33, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x32, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x37, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x35, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x34, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x36, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x31, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x31, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x31, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x32, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x32, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x34, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x31, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x33, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x37, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x35, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x38, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x34, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x39, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x39, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x35, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x37, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x35, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x37, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x35, 0x33, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x36, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x35, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x31,
+  0x32, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x35, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x38, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x36, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x34, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x35, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x36, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x39, 0x33, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x39, 0x33, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x34, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x33, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x38, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x39, 0x33, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x30, 0x38, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x36, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x34, 0x33, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x33, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x37, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x32, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x33, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35,
+  0x38, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x36, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x34, 0x38, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x36, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x33, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x32, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x36, 0x36, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x37, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x33, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x33, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x39, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x36, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x36, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x34, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x34, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x38, 0x38, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x30, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x30, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x34, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x32, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x34, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x33, 0x35, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x34, 0x34, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x38, 0x32, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x32, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x35, 0x0a,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x33, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x31, 0x37, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x30, 0x37, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x35, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x35, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x34, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x33, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x32, 0x35, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x30, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x34, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36,
+  0x38, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x32, 0x35, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x30, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x32, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x34, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31,
+  0x33, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x39, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x33, 0x35, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x35, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x36, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x33, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x30, 0x31, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x30, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x35, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x35, 0x38, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x35, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x30, 0x37, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x32, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x36, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x31, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x38, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x35, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x30, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x38, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x34, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x30,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x39, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x34, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x37, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x36, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x30, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x30, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x38, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x38, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x38, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x33, 0x33, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x37, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x33, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x32, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x31, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x34, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x31, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x38, 0x38, 0x0a,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x36, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x37, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x32, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x32, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x31, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x31, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x34, 0x30, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x31, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x30, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x32, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x37, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x37, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x37, 0x30, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x38, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x32, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x37, 0x32, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x31, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x35, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x37, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x37, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x32, 0x31, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x34, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x38, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x33, 0x34, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36,
+  0x34, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x38, 0x30, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x32, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x36, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x31, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x31, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x39, 0x33, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x33, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x34, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x35, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x33, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x37, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x33, 0x32, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x36, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x38,
+  0x33, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x32, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x33, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x37, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x35, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x34, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x31, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x30, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x38, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x31, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x38, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x33, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x36, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x35, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x30, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x34, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x34, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x37, 0x36, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x30, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x35, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x30, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x34, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x33, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x36, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30,
+  0x37, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x37, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x37, 0x34, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x37, 0x30, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x31, 0x32, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x30, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x37, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x34, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x30, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x36, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x30, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x32, 0x34, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x32, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x31, 0x35, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x38, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x35, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x32, 0x39, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x36, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x30, 0x34, 0x0a,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x36, 0x38, 0x0a, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x35, 0x32, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x36, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x30, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x32, 0x39, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x36, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x30, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x34, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x38, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x33, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x30, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x30, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x34, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x32, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x32, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x30, 0x35, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x30, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x30, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x38, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x33, 0x30, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x35, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x35, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x30, 0x31, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x32, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x37, 0x33, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x31, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x34, 0x39, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x34, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x32, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x38, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x30, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x31, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x37, 0x35, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x31, 0x30, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x33, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x36, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x30, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x34, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x35, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x32, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x37, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x35, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37,
+  0x36, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x32, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x37, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x33, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x35, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x30, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x32, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x36, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x33, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x31, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x34,
+  0x35, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x32, 0x31, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34,
+  0x32, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x30, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x34, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x30, 0x35, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x33, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x31, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x31, 0x32, 0x38, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x38, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x35, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x30, 0x37, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x33, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x36, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x33, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x37, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x33, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x31, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x37,
+  0x36, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x32, 0x37, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37,
+  0x32, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x35, 0x31, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x31, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x33, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x33, 0x31, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x38, 0x32, 0x38, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x34, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x37, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x38, 0x31, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x30, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x32, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x35, 0x30, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x32, 0x31, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x32, 0x34, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x35, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x31, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x37, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39,
+  0x37, 0x32, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x34, 0x39, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x35, 0x34, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x37, 0x37, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x34, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x38,
+  0x35, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x36, 0x38, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x38, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x30, 0x39, 0x30, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x36, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x35, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x36, 0x0a,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x31, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x37, 0x32, 0x31, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x33, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x30, 0x35, 0x0a, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x36, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x34, 0x36, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x31, 0x33, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x39, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x34, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x36, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x38, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x30, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x33,
+  0x38, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x33, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x35, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x37, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x32, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x31, 0x30, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x34, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x36, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x37, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x33, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x35, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x32, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x32, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x36, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x34, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x36, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x33, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33, 0x38, 0x35, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35,
+  0x34, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x30, 0x32, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x36, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x33, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x37, 0x38, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x35, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x39, 0x37, 0x36, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x36, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x31, 0x36, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x32, 0x31, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x34, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x32, 0x34, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x34, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x38, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x39, 0x32, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x32, 0x36, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x35, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x39, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x35, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x34, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x31,
+  0x37, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x34, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x32, 0x32, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x31, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32,
+  0x34, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x35, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36,
+  0x39, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x38, 0x35, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x33, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x35, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x32, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x33,
+  0x36, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x34, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x31, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x35, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36,
+  0x39, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x37, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x39, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x39,
+  0x37, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x35, 0x30, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x35, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x30, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x32, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x35, 0x34, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x38, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x36, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x32, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x34,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36, 0x35, 0x36, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x38, 0x37, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x39, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x32,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x33, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x34, 0x36, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x36, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x33, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x38, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39,
+  0x36, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x32, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x34, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x35,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x35, 0x36, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x35, 0x38, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x39, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x30,
+  0x31, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x32, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x32, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x33, 0x33, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x33, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x36, 0x35, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x38, 0x38, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x38, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x31,
+  0x37, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x37, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x31, 0x38, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x36, 0x34, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38,
+  0x38, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x38, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x34, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x38, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x33, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x31, 0x39, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x34, 0x34, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x36,
+  0x39, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x39, 0x34, 0x30, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x31, 0x36, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x33, 0x35, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35,
+  0x32, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x32, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x32, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x39, 0x31, 0x35, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x30, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x34, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x36, 0x35, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x32, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x32,
+  0x30, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x35, 0x33, 0x38, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x32, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x38, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x36, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x34, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x33, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x35, 0x30, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x33, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x33, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x30, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x35, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x30, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x30,
+  0x32, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x32, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x33, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x32, 0x2e, 0x30,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x37, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x34, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x38, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x31, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x36, 0x31, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x39,
+  0x31, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x39, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x34, 0x38, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x39, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x30,
+  0x32, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x33, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x34, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x36, 0x30, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37,
+  0x34, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x33, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x37, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x37, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x37, 0x30, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x36,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x34, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x30, 0x35, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35,
+  0x35, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x31, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x30, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x35, 0x31, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x39, 0x37, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x34,
+  0x30, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x36, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x38,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x31, 0x30, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x33, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x30, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x37, 0x33, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x34,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x35, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x35, 0x20,
+  0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x35, 0x30, 0x30, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x31, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x37, 0x38, 0x33, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x31, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x35,
+  0x32, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x32, 0x33, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x38, 0x37, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x34, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x37, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x38,
+  0x39, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x37, 0x38, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x38, 0x33, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x36, 0x30, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x33, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x38, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x39, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x30, 0x2e,
+  0x39, 0x35, 0x32, 0x33, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33,
+  0x33, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x37, 0x33, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x38, 0x30, 0x37, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x38, 0x37, 0x30, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32,
+  0x36, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x32, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x31, 0x30, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x35, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x38, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x35, 0x35, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x37,
+  0x20, 0x30, 0x2e, 0x39, 0x36, 0x37, 0x38, 0x37, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e,
+  0x39, 0x37, 0x38, 0x33, 0x37, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37,
+  0x36, 0x30, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20,
+  0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x31, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x33,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x34, 0x32, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x35, 0x30, 0x20, 0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x37, 0x35, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x35, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x36, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x33, 0x30, 0x37, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x35,
+  0x20, 0x30, 0x2e, 0x39, 0x37, 0x37, 0x38, 0x39, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x30, 0x33, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x34, 0x35, 0x20, 0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x36,
+  0x36, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20,
+  0x30, 0x2e, 0x32, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x34, 0x38, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x31,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x39, 0x38, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x2e,
+  0x39, 0x36, 0x31, 0x32, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x34, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31,
+  0x30, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x32, 0x38, 0x34, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x38, 0x36, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x34, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x36, 0x39,
+  0x33, 0x32, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x37, 0x33, 0x39, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x37, 0x31, 0x33, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x33, 0x35, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x38, 0x36, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e,
+  0x33, 0x30, 0x20, 0x30, 0x2e, 0x34, 0x20, 0x30, 0x2e, 0x39, 0x35, 0x38,
+  0x36, 0x31, 0x0a, 0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20,
+  0x30, 0x2e, 0x33, 0x20, 0x30, 0x2e, 0x39, 0x38, 0x31, 0x31, 0x31, 0x0a,
+  0x30, 0x2e, 0x39, 0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x32,
+  0x20, 0x30, 0x2e, 0x39, 0x39, 0x35, 0x30, 0x31, 0x0a, 0x30, 0x2e, 0x39,
+  0x20, 0x30, 0x2e, 0x33, 0x30, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x30, 0x2e,
+  0x39, 0x39, 0x39, 0x36, 0x32, 0x0a
+};
+unsigned int CovSeqidQscPercMinDiag_lib_len = 61614;
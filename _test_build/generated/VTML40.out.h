@@ -0,0 +1,163 @@
+static const unsigned char VTML40_out[] = {
+  0x23, 0x0a, 0x23, 0x20, 0x20, 0x56, 0x54, 0x4d, 0x4c, 0x5f, 0x34, 0x30,
+  0x0a, 0x23, 0x0a, 0x23, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x61,
+  0x74, 0x72, 0x69, 0x78, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x72, 0x6f,
+  0x64, 0x75, 0x63, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x3a, 0x20,
+  0x76, 0x74, 0x6d, 0x6c, 0x5f, 0x34, 0x30, 0x71, 0x69, 0x6a, 0x2e, 0x6d,
+  0x61, 0x74, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x74, 0x6d,
+  0x6c, 0x5f, 0x50, 0x2e, 0x6d, 0x61, 0x74, 0x20, 0x62, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x66, 0x72, 0x65, 0x71, 0x75,
+  0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x0a, 0x23, 0x0a, 0x23, 0x20, 0x56,
+  0x54, 0x4d, 0x4c, 0x5f, 0x34, 0x30, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74,
+  0x69, 0x74, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x72,
+  0x69, 0x78, 0x2c, 0x20, 0x55, 0x6e, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20,
+  0x62, 0x69, 0x74, 0x73, 0x2f, 0x32, 0x2e, 0x30, 0x0a, 0x23, 0x20, 0x45,
+  0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x3d, 0x20, 0x2d, 0x31, 0x2e, 0x39, 0x39, 0x31, 0x36, 0x36,
+  0x37, 0x20, 0x62, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x45, 0x6e, 0x74, 0x72,
+  0x6f, 0x70, 0x79, 0x20, 0x3d, 0x20, 0x32, 0x2e, 0x32, 0x36, 0x37, 0x34,
+  0x35, 0x36, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x23, 0x20, 0x54, 0x61,
+  0x72, 0x67, 0x65, 0x74, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x3d,
+  0x20, 0x30, 0x2e, 0x36, 0x39, 0x36, 0x30, 0x0a, 0x23, 0x20, 0x4c, 0x6f,
+  0x77, 0x65, 0x73, 0x74, 0x20, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
+  0x20, 0x2d, 0x31, 0x32, 0x2c, 0x20, 0x48, 0x69, 0x67, 0x68, 0x65, 0x73,
+  0x74, 0x20, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x3d, 0x20, 0x31, 0x32, 0x0a,
+  0x23, 0x0a, 0x23, 0x20, 0x42, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x20, 0x28, 0x70, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x70, 0x75,
+  0x74, 0x65, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c,
+  0x29, 0x3a, 0x20, 0x30, 0x2e, 0x30, 0x38, 0x31, 0x39, 0x20, 0x30, 0x2e,
+  0x30, 0x31, 0x36, 0x39, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x35, 0x33, 0x20,
+  0x30, 0x2e, 0x30, 0x36, 0x31, 0x36, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x36,
+  0x35, 0x20, 0x30, 0x2e, 0x30, 0x37, 0x34, 0x35, 0x20, 0x30, 0x2e, 0x30,
+  0x32, 0x31, 0x37, 0x20, 0x30, 0x2e, 0x30, 0x35, 0x34, 0x39, 0x20, 0x30,
+  0x2e, 0x30, 0x35, 0x38, 0x32, 0x20, 0x30, 0x2e, 0x30, 0x39, 0x30, 0x35,
+  0x20, 0x30, 0x2e, 0x30, 0x32, 0x37, 0x34, 0x20, 0x30, 0x2e, 0x30, 0x34,
+  0x33, 0x35, 0x20, 0x30, 0x2e, 0x30, 0x35, 0x30, 0x36, 0x20, 0x30, 0x2e,
+  0x30, 0x33, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x34, 0x37, 0x20,
+  0x30, 0x2e, 0x30, 0x35, 0x33, 0x33, 0x20, 0x30, 0x2e, 0x30, 0x35, 0x36,
+  0x39, 0x20, 0x30, 0x2e, 0x30, 0x38, 0x31, 0x20, 0x30, 0x2e, 0x30, 0x31,
+  0x33, 0x32, 0x20, 0x30, 0x2e, 0x30, 0x33, 0x32, 0x39, 0x20, 0x30, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x31, 0x0a, 0x23, 0x20, 0x4c, 0x61, 0x6d, 0x62,
+  0x64, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x72, 0x65, 0x63,
+  0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x61, 0x6c, 0x29, 0x3a, 0x20, 0x30, 0x2e, 0x33, 0x34, 0x36,
+  0x35, 0x37, 0x0a, 0x09, 0x41, 0x09, 0x43, 0x09, 0x44, 0x09, 0x45, 0x09,
+  0x46, 0x09, 0x47, 0x09, 0x48, 0x09, 0x49, 0x09, 0x4b, 0x09, 0x4c, 0x09,
+  0x4d, 0x09, 0x4e, 0x09, 0x50, 0x09, 0x51, 0x09, 0x52, 0x09, 0x53, 0x09,
+  0x54, 0x09, 0x56, 0x09, 0x57, 0x09, 0x59, 0x09, 0x58, 0x0a, 0x41, 0x09,
+  0x36, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x33, 0x09, 0x2d,
+  0x36, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x35, 0x09, 0x2d,
+  0x34, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x34, 0x09, 0x2d,
+  0x33, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x35, 0x09, 0x30, 0x09, 0x2d, 0x31,
+  0x09, 0x2d, 0x31, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x31,
+  0x0a, 0x43, 0x09, 0x2d, 0x31, 0x09, 0x31, 0x31, 0x09, 0x2d, 0x31, 0x30,
+  0x09, 0x2d, 0x31, 0x30, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x35, 0x09, 0x2d,
+  0x35, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x39, 0x09, 0x2d,
+  0x33, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x39, 0x09, 0x2d,
+  0x35, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x32, 0x09, 0x2d,
+  0x31, 0x32, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x31, 0x0a, 0x44, 0x09, 0x2d,
+  0x34, 0x09, 0x2d, 0x31, 0x30, 0x09, 0x38, 0x09, 0x31, 0x09, 0x2d, 0x31,
+  0x32, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x31, 0x30, 0x09,
+  0x2d, 0x33, 0x09, 0x2d, 0x31, 0x31, 0x09, 0x2d, 0x37, 0x09, 0x30, 0x09,
+  0x2d, 0x34, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x33, 0x09,
+  0x2d, 0x34, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x31, 0x30,
+  0x09, 0x2d, 0x31, 0x0a, 0x45, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x31, 0x30,
+  0x09, 0x31, 0x09, 0x37, 0x09, 0x2d, 0x31, 0x31, 0x09, 0x2d, 0x35, 0x09,
+  0x2d, 0x34, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x37, 0x09,
+  0x2d, 0x36, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x34, 0x09, 0x31, 0x09, 0x2d,
+  0x37, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x36, 0x09, 0x2d,
+  0x31, 0x32, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x31, 0x0a, 0x46, 0x09, 0x2d,
+  0x36, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x31, 0x32, 0x09, 0x2d, 0x31, 0x31,
+  0x09, 0x38, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x33, 0x09,
+  0x2d, 0x31, 0x30, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x38,
+  0x09, 0x2d, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x35,
+  0x09, 0x2d, 0x36, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x31, 0x09, 0x32, 0x09,
+  0x2d, 0x31, 0x0a, 0x47, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x35, 0x09, 0x2d,
+  0x34, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x39, 0x09, 0x37, 0x09, 0x2d, 0x35,
+  0x09, 0x2d, 0x31, 0x32, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x39, 0x09, 0x2d,
+  0x38, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x36, 0x09, 0x2d,
+  0x35, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x38, 0x09, 0x2d,
+  0x37, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x31, 0x0a, 0x48, 0x09, 0x2d, 0x35,
+  0x09, 0x2d, 0x35, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x33,
+  0x09, 0x2d, 0x35, 0x09, 0x31, 0x30, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x33,
+  0x09, 0x2d, 0x35, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x34,
+  0x09, 0x30, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x34, 0x09,
+  0x2d, 0x36, 0x09, 0x2d, 0x34, 0x09, 0x30, 0x09, 0x2d, 0x31, 0x0a, 0x49,
+  0x09, 0x2d, 0x35, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x31, 0x30, 0x09, 0x2d,
+  0x38, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x31, 0x32, 0x09, 0x2d, 0x37, 0x09,
+  0x37, 0x09, 0x2d, 0x37, 0x09, 0x30, 0x09, 0x30, 0x09, 0x2d, 0x37, 0x09,
+  0x2d, 0x38, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x37, 0x09,
+  0x2d, 0x33, 0x09, 0x32, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x35, 0x09, 0x2d,
+  0x31, 0x0a, 0x4b, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x33,
+  0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x30, 0x09, 0x2d, 0x35, 0x09, 0x2d,
+  0x33, 0x09, 0x2d, 0x37, 0x09, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x34,
+  0x09, 0x2d, 0x32, 0x09, 0x2d, 0x34, 0x09, 0x30, 0x09, 0x32, 0x09, 0x2d,
+  0x33, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x37, 0x09, 0x2d,
+  0x36, 0x09, 0x2d, 0x31, 0x0a, 0x4c, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x39,
+  0x09, 0x2d, 0x31, 0x31, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x31, 0x09, 0x2d,
+  0x39, 0x09, 0x2d, 0x35, 0x09, 0x30, 0x09, 0x2d, 0x36, 0x09, 0x36, 0x09,
+  0x31, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x34, 0x09, 0x2d,
+  0x36, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x31, 0x09, 0x2d,
+  0x34, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x31, 0x0a, 0x4d, 0x09, 0x2d, 0x34,
+  0x09, 0x2d, 0x33, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x31,
+  0x09, 0x2d, 0x38, 0x09, 0x2d, 0x38, 0x09, 0x30, 0x09, 0x2d, 0x34, 0x09,
+  0x31, 0x09, 0x39, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x33,
+  0x09, 0x2d, 0x34, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x32,
+  0x09, 0x2d, 0x39, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x31, 0x0a, 0x4e, 0x09,
+  0x2d, 0x34, 0x09, 0x2d, 0x36, 0x09, 0x30, 0x09, 0x2d, 0x33, 0x09, 0x2d,
+  0x38, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x37, 0x09, 0x2d,
+  0x32, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x35, 0x09, 0x38, 0x09, 0x2d, 0x36,
+  0x09, 0x2d, 0x32, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x32,
+  0x09, 0x2d, 0x37, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x31,
+  0x0a, 0x50, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x34, 0x09,
+  0x2d, 0x34, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x34, 0x09,
+  0x2d, 0x38, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x38, 0x09,
+  0x2d, 0x36, 0x09, 0x38, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x35, 0x09, 0x2d,
+  0x32, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x37, 0x09, 0x2d,
+  0x31, 0x31, 0x09, 0x2d, 0x31, 0x0a, 0x51, 0x09, 0x2d, 0x33, 0x09, 0x2d,
+  0x39, 0x09, 0x2d, 0x33, 0x09, 0x31, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x36,
+  0x09, 0x30, 0x09, 0x2d, 0x37, 0x09, 0x30, 0x09, 0x2d, 0x34, 0x09, 0x2d,
+  0x33, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x33, 0x09, 0x38, 0x09, 0x2d, 0x31,
+  0x09, 0x2d, 0x32, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x31,
+  0x31, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x31, 0x0a, 0x52, 0x09, 0x2d, 0x35,
+  0x09, 0x2d, 0x35, 0x09, 0x2d, 0x38, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x38,
+  0x09, 0x2d, 0x35, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x37, 0x09, 0x32, 0x09,
+  0x2d, 0x36, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x35, 0x09,
+  0x2d, 0x31, 0x09, 0x38, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x34, 0x09, 0x2d,
+  0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x31, 0x0a, 0x53,
+  0x09, 0x30, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x33, 0x09,
+  0x2d, 0x35, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x37, 0x09,
+  0x2d, 0x33, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x31, 0x09,
+  0x2d, 0x32, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x34, 0x09, 0x37, 0x09, 0x31,
+  0x09, 0x2d, 0x36, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x31,
+  0x0a, 0x54, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x34, 0x09,
+  0x2d, 0x34, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x34, 0x09,
+  0x2d, 0x33, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x33, 0x09,
+  0x2d, 0x32, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x33, 0x09, 0x2d, 0x34, 0x09,
+  0x31, 0x09, 0x37, 0x09, 0x2d, 0x32, 0x09, 0x2d, 0x31, 0x31, 0x09, 0x2d,
+  0x36, 0x09, 0x2d, 0x31, 0x0a, 0x56, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x32,
+  0x09, 0x2d, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x38,
+  0x09, 0x2d, 0x36, 0x09, 0x32, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x31, 0x09,
+  0x2d, 0x32, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x35, 0x09,
+  0x2d, 0x37, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x32, 0x09, 0x36, 0x09, 0x2d,
+  0x31, 0x30, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x31, 0x0a, 0x57, 0x09, 0x2d,
+  0x37, 0x09, 0x2d, 0x31, 0x32, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x31, 0x32,
+  0x09, 0x2d, 0x31, 0x09, 0x2d, 0x37, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x34,
+  0x09, 0x2d, 0x37, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x39, 0x09, 0x2d, 0x38,
+  0x09, 0x2d, 0x37, 0x09, 0x2d, 0x31, 0x31, 0x09, 0x2d, 0x36, 0x09, 0x2d,
+  0x36, 0x09, 0x2d, 0x31, 0x31, 0x09, 0x2d, 0x31, 0x30, 0x09, 0x31, 0x32,
+  0x09, 0x30, 0x09, 0x2d, 0x31, 0x0a, 0x59, 0x09, 0x2d, 0x36, 0x09, 0x2d,
+  0x33, 0x09, 0x2d, 0x31, 0x30, 0x09, 0x2d, 0x35, 0x09, 0x32, 0x09, 0x2d,
+  0x38, 0x09, 0x30, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x36, 0x09, 0x2d, 0x34,
+  0x09, 0x2d, 0x38, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x31, 0x31, 0x09, 0x2d,
+  0x38, 0x09, 0x2d, 0x35, 0x09, 0x2d, 0x34, 0x09, 0x2d, 0x36, 0x09, 0x2d,
+  0x36, 0x09, 0x30, 0x09, 0x39, 0x09, 0x2d, 0x31, 0x0a, 0x58, 0x09, 0x2d,
+  0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d,
+  0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d,
+  0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d,
+  0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d,
+  0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d, 0x31, 0x09, 0x2d,
+  0x31, 0x0a
+};
+unsigned int VTML40_out_len = 1910;
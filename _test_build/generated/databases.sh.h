@@ -0,0 +1,1959 @@
+static const unsigned char databases_sh[] = {
+  0x23, 0x21, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x73, 0x68, 0x20, 0x2d, 0x65,
+  0x0a, 0x66, 0x61, 0x69, 0x6c, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x63, 0x68, 0x6f, 0x20, 0x22, 0x45, 0x72, 0x72, 0x6f,
+  0x72, 0x3a, 0x20, 0x24, 0x31, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x78, 0x69, 0x74, 0x20, 0x31, 0x0a, 0x7d, 0x0a, 0x0a, 0x6e, 0x6f, 0x74,
+  0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x5b, 0x20, 0x21, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24,
+  0x31, 0x22, 0x20, 0x5d, 0x0a, 0x7d, 0x0a, 0x0a, 0x68, 0x61, 0x73, 0x43,
+  0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x28, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20,
+  0x2d, 0x76, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20, 0x3e, 0x2f, 0x64, 0x65,
+  0x76, 0x2f, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x32, 0x3e, 0x26, 0x31, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x41, 0x52, 0x52, 0x3d, 0x22, 0x22, 0x0a, 0x70, 0x75,
+  0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x28, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65,
+  0x3d, 0x53, 0x43, 0x31, 0x30, 0x30, 0x33, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x43, 0x55, 0x52, 0x52, 0x3d, 0x22, 0x24, 0x28, 0x70, 0x72, 0x69, 0x6e,
+  0x74, 0x66, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20, 0x22, 0x24, 0x31, 0x22,
+  0x20, 0x7c, 0x20, 0x61, 0x77, 0x6b, 0x20, 0x27, 0x7b, 0x20, 0x67, 0x73,
+  0x75, 0x62, 0x28, 0x2f, 0x27, 0x5c, 0x27, 0x27, 0x2f, 0x2c, 0x20, 0x22,
+  0x27, 0x5c, 0x27, 0x27, 0x5c, 0x5c, 0x27, 0x5c, 0x27, 0x27, 0x27, 0x5c,
+  0x27, 0x27, 0x22, 0x29, 0x3b, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x3b,
+  0x20, 0x7d, 0x27, 0x29, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x5b, 0x20, 0x2d, 0x7a, 0x20, 0x22, 0x24, 0x41, 0x52, 0x52, 0x22,
+  0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x52, 0x52, 0x3d, 0x27, 0x27, 0x5c,
+  0x27, 0x24, 0x43, 0x55, 0x52, 0x52, 0x5c, 0x27, 0x27, 0x27, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x41, 0x52, 0x52, 0x3d, 0x24, 0x41, 0x52, 0x52,
+  0x27, 0x20, 0x27, 0x5c, 0x27, 0x24, 0x43, 0x55, 0x52, 0x52, 0x5c, 0x27,
+  0x27, 0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x3d, 0x22, 0x22,
+  0x0a, 0x69, 0x66, 0x20, 0x68, 0x61, 0x73, 0x43, 0x6f, 0x6d, 0x6d, 0x61,
+  0x6e, 0x64, 0x20, 0x61, 0x72, 0x69, 0x61, 0x32, 0x63, 0x3b, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x20, 0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59,
+  0x3d, 0x22, 0x24, 0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x20,
+  0x41, 0x52, 0x49, 0x41, 0x22, 0x3b, 0x20, 0x66, 0x69, 0x0a, 0x69, 0x66,
+  0x20, 0x68, 0x61, 0x73, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20,
+  0x63, 0x75, 0x72, 0x6c, 0x3b, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x20, 0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x3d, 0x22, 0x24,
+  0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x20, 0x43, 0x55, 0x52,
+  0x4c, 0x22, 0x3b, 0x20, 0x66, 0x69, 0x0a, 0x69, 0x66, 0x20, 0x68, 0x61,
+  0x73, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x67, 0x65,
+  0x74, 0x3b, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x53, 0x54,
+  0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x3d, 0x22, 0x24, 0x53, 0x54, 0x52,
+  0x41, 0x54, 0x45, 0x47, 0x59, 0x20, 0x57, 0x47, 0x45, 0x54, 0x22, 0x3b,
+  0x20, 0x66, 0x69, 0x0a, 0x69, 0x66, 0x20, 0x5b, 0x20, 0x22, 0x24, 0x53,
+  0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x22, 0x20, 0x3d, 0x20, 0x22,
+  0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x4e, 0x6f, 0x20, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
+  0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x50, 0x41,
+  0x54, 0x48, 0x2e, 0x20, 0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x69,
+  0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x72, 0x69, 0x61, 0x32,
+  0x63, 0x2c, 0x20, 0x63, 0x75, 0x72, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x77,
+  0x67, 0x65, 0x74, 0x2e, 0x22, 0x0a, 0x66, 0x69, 0x0a, 0x0a, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x28, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x55, 0x52, 0x4c, 0x3d, 0x22,
+  0x24, 0x31, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x55, 0x54, 0x50,
+  0x55, 0x54, 0x3d, 0x22, 0x24, 0x32, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x2b, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x69, 0x20, 0x69, 0x6e, 0x20, 0x24, 0x53, 0x54, 0x52,
+  0x41, 0x54, 0x45, 0x47, 0x59, 0x3b, 0x20, 0x64, 0x6f, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x22,
+  0x24, 0x69, 0x22, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x41, 0x52, 0x49, 0x41, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x49, 0x4c,
+  0x45, 0x4e, 0x41, 0x4d, 0x45, 0x3d, 0x24, 0x28, 0x62, 0x61, 0x73, 0x65,
+  0x6e, 0x61, 0x6d, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x50,
+  0x55, 0x54, 0x7d, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x49, 0x52, 0x3d, 0x24, 0x28,
+  0x64, 0x69, 0x72, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x4f,
+  0x55, 0x54, 0x50, 0x55, 0x54, 0x7d, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x69,
+  0x61, 0x32, 0x63, 0x20, 0x2d, 0x2d, 0x6d, 0x61, 0x78, 0x2d, 0x63, 0x6f,
+  0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x70, 0x65, 0x72,
+  0x2d, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x3d, 0x22, 0x24, 0x41, 0x52,
+  0x49, 0x41, 0x5f, 0x4e, 0x55, 0x4d, 0x5f, 0x43, 0x4f, 0x4e, 0x4e, 0x22,
+  0x20, 0x2d, 0x2d, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x2d, 0x6f, 0x76, 0x65,
+  0x72, 0x77, 0x72, 0x69, 0x74, 0x65, 0x3d, 0x74, 0x72, 0x75, 0x65, 0x20,
+  0x2d, 0x6f, 0x20, 0x22, 0x24, 0x46, 0x49, 0x4c, 0x45, 0x4e, 0x41, 0x4d,
+  0x45, 0x22, 0x20, 0x2d, 0x64, 0x20, 0x22, 0x24, 0x44, 0x49, 0x52, 0x22,
+  0x20, 0x22, 0x24, 0x55, 0x52, 0x4c, 0x22, 0x20, 0x26, 0x26, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x55, 0x52, 0x4c, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x63, 0x75, 0x72, 0x6c, 0x20, 0x2d, 0x4c, 0x20, 0x2d, 0x6f, 0x20,
+  0x22, 0x24, 0x4f, 0x55, 0x54, 0x50, 0x55, 0x54, 0x22, 0x20, 0x22, 0x24,
+  0x55, 0x52, 0x4c, 0x22, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x57, 0x47, 0x45, 0x54, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x67,
+  0x65, 0x74, 0x20, 0x2d, 0x4f, 0x20, 0x22, 0x24, 0x4f, 0x55, 0x54, 0x50,
+  0x55, 0x54, 0x22, 0x20, 0x22, 0x24, 0x55, 0x52, 0x4c, 0x22, 0x20, 0x26,
+  0x26, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73,
+  0x61, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x6e, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x2d, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x43, 0x6f, 0x75,
+  0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x20, 0x24, 0x55, 0x52, 0x4c, 0x20, 0x74, 0x6f, 0x20,
+  0x24, 0x4f, 0x55, 0x54, 0x50, 0x55, 0x54, 0x22, 0x0a, 0x7d, 0x0a, 0x0a,
+  0x23, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x6e, 0x75, 0x6d, 0x62,
+  0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+  0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x0a, 0x5b, 0x20,
+  0x22, 0x24, 0x23, 0x22, 0x20, 0x2d, 0x6e, 0x65, 0x20, 0x33, 0x20, 0x5d,
+  0x20, 0x26, 0x26, 0x20, 0x65, 0x63, 0x68, 0x6f, 0x20, 0x22, 0x50, 0x6c,
+  0x65, 0x61, 0x73, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65,
+  0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
+  0x20, 0x3c, 0x6f, 0x75, 0x74, 0x44, 0x42, 0x3e, 0x20, 0x3c, 0x74, 0x6d,
+  0x70, 0x3e, 0x22, 0x20, 0x26, 0x26, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20,
+  0x31, 0x3b, 0x0a, 0x5b, 0x20, 0x21, 0x20, 0x2d, 0x64, 0x20, 0x22, 0x24,
+  0x33, 0x22, 0x20, 0x5d, 0x20, 0x26, 0x26, 0x20, 0x20, 0x65, 0x63, 0x68,
+  0x6f, 0x20, 0x22, 0x74, 0x6d, 0x70, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
+  0x74, 0x6f, 0x72, 0x79, 0x20, 0x24, 0x33, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x66, 0x6f, 0x75, 0x6e, 0x64, 0x21, 0x22, 0x20, 0x26, 0x26, 0x20, 0x6d,
+  0x6b, 0x64, 0x69, 0x72, 0x20, 0x2d, 0x70, 0x20, 0x22, 0x24, 0x33, 0x22,
+  0x3b, 0x0a, 0x0a, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x49, 0x4f, 0x4e,
+  0x3d, 0x22, 0x24, 0x31, 0x22, 0x0a, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x3d,
+  0x22, 0x24, 0x32, 0x22, 0x0a, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x3d, 0x22, 0x24, 0x33, 0x22, 0x0a, 0x0a, 0x49, 0x4e, 0x50, 0x55,
+  0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x22, 0x0a, 0x63, 0x61,
+  0x73, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54,
+  0x49, 0x4f, 0x4e, 0x7d, 0x22, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x22, 0x55, 0x6e, 0x69, 0x52, 0x65, 0x66, 0x31, 0x30, 0x30, 0x22,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x31, 0x30, 0x30, 0x2e, 0x66, 0x61,
+  0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69,
+  0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66, 0x74,
+  0x70, 0x2e, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x6f, 0x72,
+  0x67, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61,
+  0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x2f,
+  0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65,
+  0x66, 0x31, 0x30, 0x30, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x31,
+  0x30, 0x30, 0x2e, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x6e,
+  0x6f, 0x74, 0x65, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46,
+  0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66,
+  0x74, 0x70, 0x2e, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x6f,
+  0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62,
+  0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74,
+  0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x2f, 0x75, 0x6e, 0x69, 0x72,
+  0x65, 0x66, 0x31, 0x30, 0x30, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66,
+  0x31, 0x30, 0x30, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x31, 0x30, 0x30,
+  0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62,
+  0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x31,
+  0x30, 0x30, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50,
+  0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53,
+  0x54, 0x41, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x55, 0x6e, 0x69,
+  0x52, 0x65, 0x66, 0x39, 0x30, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78,
+  0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66,
+  0x39, 0x30, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22,
+  0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x75, 0x6e, 0x69, 0x70, 0x72,
+  0x6f, 0x74, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64,
+  0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69,
+  0x70, 0x72, 0x6f, 0x74, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x2f,
+  0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x39, 0x30, 0x2f, 0x75, 0x6e, 0x69,
+  0x72, 0x65, 0x66, 0x39, 0x30, 0x2e, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x5f, 0x6e, 0x6f, 0x74, 0x65, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72,
+  0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f,
+  0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a,
+  0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f,
+  0x74, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61,
+  0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69, 0x70,
+  0x72, 0x6f, 0x74, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x2f, 0x75,
+  0x6e, 0x69, 0x72, 0x65, 0x66, 0x39, 0x30, 0x2f, 0x75, 0x6e, 0x69, 0x72,
+  0x65, 0x66, 0x39, 0x30, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67,
+  0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x39, 0x30,
+  0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62,
+  0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x39,
+  0x30, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55,
+  0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54,
+  0x41, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x55, 0x6e, 0x69, 0x52,
+  0x65, 0x66, 0x35, 0x30, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x35,
+  0x30, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x3b,
+  0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f,
+  0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a,
+  0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f,
+  0x74, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61,
+  0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69, 0x70,
+  0x72, 0x6f, 0x74, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x2f, 0x75,
+  0x6e, 0x69, 0x72, 0x65, 0x66, 0x35, 0x30, 0x2f, 0x75, 0x6e, 0x69, 0x72,
+  0x65, 0x66, 0x35, 0x30, 0x2e, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+  0x5f, 0x6e, 0x6f, 0x74, 0x65, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x66, 0x74, 0x70, 0x2e, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74,
+  0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61, 0x74,
+  0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72,
+  0x6f, 0x74, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x2f, 0x75, 0x6e,
+  0x69, 0x72, 0x65, 0x66, 0x35, 0x30, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65,
+  0x66, 0x35, 0x30, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x35, 0x30, 0x2e,
+  0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62, 0x61,
+  0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x72, 0x65, 0x66, 0x35, 0x30,
+  0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54,
+  0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41,
+  0x5f, 0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x55, 0x6e, 0x69, 0x50, 0x72,
+  0x6f, 0x74, 0x4b, 0x42, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74,
+  0x5f, 0x73, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61,
+  0x2e, 0x67, 0x7a, 0x22, 0x20, 0x7c, 0x7c, 0x20, 0x6e, 0x6f, 0x74, 0x45,
+  0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72,
+  0x6f, 0x74, 0x5f, 0x74, 0x72, 0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x66, 0x61,
+  0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69,
+  0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f,
+  0x66, 0x74, 0x70, 0x2e, 0x65, 0x78, 0x70, 0x61, 0x73, 0x79, 0x2e, 0x6f,
+  0x72, 0x67, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73,
+  0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+  0x2f, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x62, 0x61,
+  0x73, 0x65, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x2f,
+  0x72, 0x65, 0x6c, 0x64, 0x61, 0x74, 0x65, 0x2e, 0x74, 0x78, 0x74, 0x22,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70,
+  0x2e, 0x65, 0x78, 0x70, 0x61, 0x73, 0x79, 0x2e, 0x6f, 0x72, 0x67, 0x2f,
+  0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e,
+  0x69, 0x70, 0x72, 0x6f, 0x74, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x2f, 0x6b, 0x6e,
+  0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x62, 0x61, 0x73, 0x65, 0x2f,
+  0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x2f, 0x75, 0x6e, 0x69,
+  0x70, 0x72, 0x6f, 0x74, 0x5f, 0x73, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x66,
+  0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e,
+  0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x73, 0x70, 0x72, 0x6f, 0x74, 0x2e,
+  0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22,
+  0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e,
+  0x65, 0x78, 0x70, 0x61, 0x73, 0x79, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x64,
+  0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69,
+  0x70, 0x72, 0x6f, 0x74, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x2f, 0x6b, 0x6e, 0x6f,
+  0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x62, 0x61, 0x73, 0x65, 0x2f, 0x63,
+  0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x2f, 0x75, 0x6e, 0x69, 0x70,
+  0x72, 0x6f, 0x74, 0x5f, 0x74, 0x72, 0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x66,
+  0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e,
+  0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x74, 0x72, 0x65, 0x6d, 0x62, 0x6c,
+  0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62,
+  0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74,
+  0x5f, 0x73, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61,
+  0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x74, 0x72, 0x65, 0x6d,
+  0x62, 0x6c, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50,
+  0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53,
+  0x54, 0x41, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x55, 0x6e, 0x69,
+  0x50, 0x72, 0x6f, 0x74, 0x4b, 0x42, 0x2f, 0x54, 0x72, 0x45, 0x4d, 0x42,
+  0x4c, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x74, 0x72,
+  0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67,
+  0x7a, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x65, 0x78, 0x70,
+  0x61, 0x73, 0x79, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x64, 0x61, 0x74, 0x61,
+  0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f,
+  0x74, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x2f, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65,
+  0x64, 0x67, 0x65, 0x62, 0x61, 0x73, 0x65, 0x2f, 0x63, 0x6f, 0x6d, 0x70,
+  0x6c, 0x65, 0x74, 0x65, 0x2f, 0x72, 0x65, 0x6c, 0x64, 0x61, 0x74, 0x65,
+  0x2e, 0x74, 0x78, 0x74, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69,
+  0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69,
+  0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f,
+  0x66, 0x74, 0x70, 0x2e, 0x65, 0x78, 0x70, 0x61, 0x73, 0x79, 0x2e, 0x6f,
+  0x72, 0x67, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73,
+  0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+  0x2f, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x62, 0x61,
+  0x73, 0x65, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x2f,
+  0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x74, 0x72, 0x65, 0x6d,
+  0x62, 0x6c, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x74, 0x72,
+  0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67,
+  0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75,
+  0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69,
+  0x70, 0x72, 0x6f, 0x74, 0x5f, 0x74, 0x72, 0x65, 0x6d, 0x62, 0x6c, 0x2e,
+  0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f,
+  0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f,
+  0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x55, 0x6e, 0x69, 0x50, 0x72, 0x6f,
+  0x74, 0x4b, 0x42, 0x2f, 0x53, 0x77, 0x69, 0x73, 0x73, 0x2d, 0x50, 0x72,
+  0x6f, 0x74, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74,
+  0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x73,
+  0x70, 0x72, 0x6f, 0x74, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67,
+  0x7a, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x65, 0x78, 0x70,
+  0x61, 0x73, 0x79, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x64, 0x61, 0x74, 0x61,
+  0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f,
+  0x74, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x2f, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65,
+  0x64, 0x67, 0x65, 0x62, 0x61, 0x73, 0x65, 0x2f, 0x63, 0x6f, 0x6d, 0x70,
+  0x6c, 0x65, 0x74, 0x65, 0x2f, 0x72, 0x65, 0x6c, 0x64, 0x61, 0x74, 0x65,
+  0x2e, 0x74, 0x78, 0x74, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69,
+  0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69,
+  0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f,
+  0x66, 0x74, 0x70, 0x2e, 0x65, 0x78, 0x70, 0x61, 0x73, 0x79, 0x2e, 0x6f,
+  0x72, 0x67, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73,
+  0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x2f, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+  0x2f, 0x6b, 0x6e, 0x6f, 0x77, 0x6c, 0x65, 0x64, 0x67, 0x65, 0x62, 0x61,
+  0x73, 0x65, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x2f,
+  0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x73, 0x70, 0x72, 0x6f,
+  0x74, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72, 0x6f, 0x74, 0x5f, 0x73, 0x70, 0x72,
+  0x6f, 0x74, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68,
+  0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x75, 0x6e, 0x69, 0x70, 0x72,
+  0x6f, 0x74, 0x5f, 0x73, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x66, 0x61, 0x73,
+  0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50,
+  0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f, 0x4c, 0x49, 0x53,
+  0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x22, 0x4e, 0x52, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78,
+  0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6e, 0x72, 0x2e, 0x67, 0x7a, 0x22,
+  0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20,
+  0x22, 0x2b, 0x25, 0x73, 0x22, 0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72,
+  0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f,
+  0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x6e, 0x63, 0x62, 0x69,
+  0x2e, 0x6e, 0x6c, 0x6d, 0x2e, 0x6e, 0x69, 0x68, 0x2e, 0x67, 0x6f, 0x76,
+  0x2f, 0x62, 0x6c, 0x61, 0x73, 0x74, 0x2f, 0x64, 0x62, 0x2f, 0x46, 0x41,
+  0x53, 0x54, 0x41, 0x2f, 0x6e, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x6e, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x6e, 0x63, 0x62,
+  0x69, 0x2e, 0x6e, 0x69, 0x68, 0x2e, 0x67, 0x6f, 0x76, 0x2f, 0x70, 0x75,
+  0x62, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x61,
+  0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74, 0x61, 0x78,
+  0x69, 0x64, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x61, 0x63, 0x63, 0x65,
+  0x73, 0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74, 0x61, 0x78, 0x69, 0x64, 0x2e,
+  0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x61, 0x63,
+  0x63, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74, 0x61, 0x78, 0x69,
+  0x64, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x75, 0x6e, 0x7a, 0x69, 0x70,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x2e, 0x61, 0x63, 0x63, 0x65, 0x73,
+  0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74, 0x61, 0x78, 0x69, 0x64, 0x2e, 0x67,
+  0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46,
+  0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f,
+  0x2f, 0x66, 0x74, 0x70, 0x2e, 0x6e, 0x63, 0x62, 0x69, 0x2e, 0x6e, 0x69,
+  0x68, 0x2e, 0x67, 0x6f, 0x76, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x74, 0x61,
+  0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x61, 0x63, 0x63, 0x65, 0x73,
+  0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74, 0x61, 0x78, 0x69, 0x64, 0x2f, 0x70,
+  0x64, 0x62, 0x2e, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e,
+  0x32, 0x74, 0x61, 0x78, 0x69, 0x64, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x70, 0x64, 0x62, 0x2e, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6f,
+  0x6e, 0x32, 0x74, 0x61, 0x78, 0x69, 0x64, 0x2e, 0x67, 0x7a, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x67, 0x75, 0x6e, 0x7a, 0x69, 0x70, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x64, 0x62, 0x2e,
+  0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74, 0x61,
+  0x78, 0x69, 0x64, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x6e, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54,
+  0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f, 0x4c,
+  0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x22, 0x4e, 0x54, 0x22, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74,
+  0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6e, 0x74, 0x2e, 0x67,
+  0x7a, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74,
+  0x65, 0x20, 0x22, 0x2b, 0x25, 0x73, 0x22, 0x20, 0x3e, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76,
+  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e,
+  0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74,
+  0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x6e, 0x63,
+  0x62, 0x69, 0x2e, 0x6e, 0x6c, 0x6d, 0x2e, 0x6e, 0x69, 0x68, 0x2e, 0x67,
+  0x6f, 0x76, 0x2f, 0x62, 0x6c, 0x61, 0x73, 0x74, 0x2f, 0x64, 0x62, 0x2f,
+  0x46, 0x41, 0x53, 0x54, 0x41, 0x2f, 0x6e, 0x74, 0x2e, 0x67, 0x7a, 0x22,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x6e, 0x74, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62, 0x61, 0x63,
+  0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x6e, 0x74, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f,
+  0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f,
+  0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x47, 0x54, 0x44, 0x42, 0x22, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64, 0x6f, 0x6e, 0x65,
+  0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e,
+  0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74,
+  0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61,
+  0x63, 0x65, 0x2e, 0x75, 0x71, 0x2e, 0x65, 0x64, 0x75, 0x2e, 0x61, 0x75,
+  0x2f, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x2f, 0x67, 0x74, 0x64, 0x62,
+  0x2f, 0x64, 0x61, 0x74, 0x61, 0x2f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x73, 0x2f, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x56, 0x45,
+  0x52, 0x53, 0x49, 0x4f, 0x4e, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73,
+  0x3a, 0x2f, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61, 0x63, 0x65, 0x2e,
+  0x75, 0x71, 0x2e, 0x65, 0x64, 0x75, 0x2e, 0x61, 0x75, 0x2f, 0x70, 0x75,
+  0x62, 0x6c, 0x69, 0x63, 0x2f, 0x67, 0x74, 0x64, 0x62, 0x2f, 0x64, 0x61,
+  0x74, 0x61, 0x2f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x73, 0x2f,
+  0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x67, 0x65, 0x6e, 0x6f, 0x6d,
+  0x69, 0x63, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5f, 0x72, 0x65, 0x70,
+  0x73, 0x2f, 0x67, 0x74, 0x64, 0x62, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x65,
+  0x69, 0x6e, 0x73, 0x5f, 0x61, 0x61, 0x5f, 0x72, 0x65, 0x70, 0x73, 0x2e,
+  0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x67, 0x74, 0x64,
+  0x62, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22,
+  0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x64, 0x61, 0x74, 0x61,
+  0x2e, 0x61, 0x63, 0x65, 0x2e, 0x75, 0x71, 0x2e, 0x65, 0x64, 0x75, 0x2e,
+  0x61, 0x75, 0x2f, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x2f, 0x67, 0x74,
+  0x64, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x2f, 0x72, 0x65, 0x6c, 0x65,
+  0x61, 0x73, 0x65, 0x73, 0x2f, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2f,
+  0x62, 0x61, 0x63, 0x31, 0x32, 0x30, 0x5f, 0x74, 0x61, 0x78, 0x6f, 0x6e,
+  0x6f, 0x6d, 0x79, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x62, 0x61,
+  0x63, 0x31, 0x32, 0x30, 0x5f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d,
+  0x79, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c,
+  0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74,
+  0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x61, 0x63,
+  0x65, 0x2e, 0x75, 0x71, 0x2e, 0x65, 0x64, 0x75, 0x2e, 0x61, 0x75, 0x2f,
+  0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x2f, 0x67, 0x74, 0x64, 0x62, 0x2f,
+  0x64, 0x61, 0x74, 0x61, 0x2f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+  0x73, 0x2f, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x61, 0x72, 0x31,
+  0x32, 0x32, 0x5f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2e,
+  0x74, 0x73, 0x76, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x61, 0x72, 0x31, 0x32, 0x32, 0x5f,
+  0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2e, 0x74, 0x73, 0x76,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64, 0x6f, 0x77,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64, 0x6f, 0x6e, 0x65, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54,
+  0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x47, 0x54, 0x44, 0x42, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x50, 0x44, 0x42, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x64, 0x62, 0x5f, 0x73, 0x65, 0x71,
+  0x72, 0x65, 0x73, 0x2e, 0x74, 0x78, 0x74, 0x2e, 0x67, 0x7a, 0x22, 0x3b,
+  0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x22,
+  0x2b, 0x25, 0x73, 0x22, 0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73,
+  0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x77, 0x77, 0x70, 0x64, 0x62,
+  0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x70, 0x64, 0x62,
+  0x2f, 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x5f, 0x64, 0x61, 0x74,
+  0x61, 0x2f, 0x70, 0x64, 0x62, 0x5f, 0x73, 0x65, 0x71, 0x72, 0x65, 0x73,
+  0x2e, 0x74, 0x78, 0x74, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x64,
+  0x62, 0x5f, 0x73, 0x65, 0x71, 0x72, 0x65, 0x73, 0x2e, 0x74, 0x78, 0x74,
+  0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x70, 0x75, 0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70,
+  0x64, 0x62, 0x5f, 0x73, 0x65, 0x71, 0x72, 0x65, 0x73, 0x2e, 0x74, 0x78,
+  0x74, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45,
+  0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f, 0x4c, 0x49, 0x53, 0x54,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x22, 0x50, 0x44, 0x42, 0x37, 0x30, 0x22, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74,
+  0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x22, 0x2b, 0x25, 0x73, 0x22, 0x20,
+  0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65,
+  0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77,
+  0x75, 0x73, 0x65, 0x72, 0x2e, 0x67, 0x77, 0x64, 0x67, 0x2e, 0x64, 0x65,
+  0x2f, 0x7e, 0x63, 0x6f, 0x6d, 0x70, 0x62, 0x69, 0x6f, 0x6c, 0x2f, 0x64,
+  0x61, 0x74, 0x61, 0x2f, 0x68, 0x68, 0x73, 0x75, 0x69, 0x74, 0x65, 0x2f,
+  0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73, 0x2f, 0x68, 0x68,
+  0x73, 0x75, 0x69, 0x74, 0x65, 0x5f, 0x64, 0x62, 0x73, 0x2f, 0x70, 0x64,
+  0x62, 0x37, 0x30, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x6d, 0x6d, 0x63,
+  0x69, 0x66, 0x5f, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x74, 0x61,
+  0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x64, 0x62, 0x37, 0x30,
+  0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x72,
+  0x20, 0x2d, 0x78, 0x4f, 0x7a, 0x66, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x64, 0x62, 0x37,
+  0x30, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x70, 0x64,
+  0x62, 0x37, 0x30, 0x5f, 0x61, 0x33, 0x6d, 0x2e, 0x66, 0x66, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x7c, 0x20, 0x74, 0x72, 0x20, 0x2d, 0x64, 0x20, 0x27,
+  0x5c, 0x30, 0x30, 0x30, 0x27, 0x20, 0x7c, 0x20, 0x61, 0x77, 0x6b, 0x20,
+  0x2d, 0x76, 0x20, 0x6f, 0x75, 0x74, 0x66, 0x69, 0x6c, 0x65, 0x3d, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x6d, 0x73, 0x61, 0x22, 0x20, 0x27, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x45, 0x6e, 0x74, 0x72,
+  0x79, 0x28, 0x29, 0x20, 0x7b, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66,
+  0x20, 0x22, 0x25, 0x73, 0x5c, 0x30, 0x22, 0x2c, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x3e, 0x3e, 0x20, 0x6f, 0x75, 0x74, 0x66, 0x69, 0x6c, 0x65,
+  0x3b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x2b, 0x20,
+  0x31, 0x3b, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3d, 0x22, 0x22, 0x3b, 0x20,
+  0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x22, 0x5c, 0x74, 0x22,
+  0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x22, 0x5c, 0x74, 0x22, 0x73, 0x69,
+  0x7a, 0x65, 0x20, 0x3e, 0x3e, 0x20, 0x6f, 0x75, 0x74, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x3b, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d,
+  0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x2b, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x3b, 0x20, 0x7d, 0x20, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x20,
+  0x7b, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x22, 0x22, 0x3b,
+  0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+  0x20, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x20, 0x69, 0x66, 0x28,
+  0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x28, 0x6f, 0x75, 0x74, 0x66, 0x69,
+  0x6c, 0x65, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x20,
+  0x6f, 0x75, 0x74, 0x66, 0x69, 0x6c, 0x65, 0x3d, 0x22, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x22, 0x3b, 0x20, 0x7d, 0x20, 0x6f, 0x75, 0x74, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x6f, 0x75, 0x74, 0x66, 0x69,
+  0x6c, 0x65, 0x22, 0x2e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x3b, 0x20,
+  0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x22, 0x29, 0x20, 0x3e,
+  0x20, 0x6f, 0x75, 0x74, 0x66, 0x69, 0x6c, 0x65, 0x3b, 0x20, 0x70, 0x72,
+  0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x22, 0x29, 0x20, 0x3e, 0x20, 0x6f,
+  0x75, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x20, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x66, 0x28, 0x22, 0x25, 0x63, 0x25, 0x63, 0x25, 0x63, 0x25,
+  0x63, 0x22, 0x2c, 0x31, 0x31, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x29,
+  0x20, 0x3e, 0x20, 0x6f, 0x75, 0x74, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x2e,
+  0x64, 0x62, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3b, 0x20, 0x7d, 0x20, 0x2f,
+  0x5e, 0x3e, 0x73, 0x73, 0x5f, 0x2f, 0x20, 0x7b, 0x20, 0x69, 0x6e, 0x73,
+  0x73, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79,
+  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x3b, 0x20,
+  0x7d, 0x20, 0x69, 0x6e, 0x73, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x20,
+  0x7b, 0x20, 0x69, 0x6e, 0x73, 0x73, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x3b, 0x20, 0x7d, 0x20, 0x2f, 0x5e, 0x3e, 0x2f,
+  0x20, 0x26, 0x26, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x3d, 0x3d,
+  0x20, 0x30, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x64, 0x20,
+  0x3e, 0x20, 0x31, 0x29, 0x20, 0x7b, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65,
+  0x45, 0x6e, 0x74, 0x72, 0x79, 0x28, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x69,
+  0x64, 0x20, 0x3d, 0x20, 0x69, 0x64, 0x20, 0x2b, 0x20, 0x31, 0x3b, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x22, 0x3e, 0x22, 0x73, 0x75,
+  0x62, 0x73, 0x74, 0x72, 0x28, 0x24, 0x31, 0x2c, 0x20, 0x32, 0x29, 0x22,
+  0x5c, 0x6e, 0x22, 0x3b, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x3d,
+  0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x2b, 0x20, 0x31, 0x3b, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x3b, 0x20, 0x7d, 0x20, 0x65, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x7b, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x22, 0x22, 0x24, 0x30, 0x22,
+  0x5c, 0x6e, 0x22, 0x3b, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x3d,
+  0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x2b, 0x20, 0x31, 0x3b, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x3b, 0x20, 0x7d, 0x20, 0x45, 0x4e, 0x44, 0x20,
+  0x7b, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x45, 0x6e, 0x74, 0x72, 0x79,
+  0x28, 0x29, 0x3b, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x6f, 0x75,
+  0x74, 0x66, 0x69, 0x6c, 0x65, 0x29, 0x3b, 0x20, 0x63, 0x6c, 0x6f, 0x73,
+  0x65, 0x28, 0x6f, 0x75, 0x74, 0x66, 0x69, 0x6c, 0x65, 0x22, 0x2e, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x22, 0x29, 0x3b, 0x20, 0x7d, 0x27, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x6d, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x64, 0x62, 0x37, 0x30, 0x2e,
+  0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50,
+  0x45, 0x3d, 0x22, 0x41, 0x33, 0x4d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x50, 0x66, 0x61, 0x6d,
+  0x2d, 0x41, 0x2e, 0x66, 0x75, 0x6c, 0x6c, 0x22, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74,
+  0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64, 0x62, 0x2e, 0x6d,
+  0x73, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c,
+  0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70,
+  0x2e, 0x65, 0x62, 0x69, 0x2e, 0x61, 0x63, 0x2e, 0x75, 0x6b, 0x2f, 0x70,
+  0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73,
+  0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x2f, 0x50, 0x66,
+  0x61, 0x6d, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x67,
+  0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c,
+  0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70,
+  0x2e, 0x65, 0x62, 0x69, 0x2e, 0x61, 0x63, 0x2e, 0x75, 0x6b, 0x2f, 0x70,
+  0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x73,
+  0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2f, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+  0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x2f, 0x50, 0x66,
+  0x61, 0x6d, 0x2d, 0x41, 0x2e, 0x66, 0x75, 0x6c, 0x6c, 0x2e, 0x67, 0x7a,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x64, 0x62, 0x2e, 0x6d, 0x73, 0x61, 0x2e, 0x67, 0x7a,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50,
+  0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x53, 0x54, 0x4f,
+  0x43, 0x4b, 0x48, 0x4f, 0x4c, 0x4d, 0x5f, 0x4d, 0x53, 0x41, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22,
+  0x50, 0x66, 0x61, 0x6d, 0x2d, 0x41, 0x2e, 0x73, 0x65, 0x65, 0x64, 0x22,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x64, 0x62, 0x2e, 0x6d, 0x73, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x3b, 0x20,
+  0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x66, 0x74, 0x70, 0x2e, 0x65, 0x62, 0x69, 0x2e, 0x61, 0x63, 0x2e,
+  0x75, 0x6b, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62,
+  0x61, 0x73, 0x65, 0x73, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69,
+  0x6f, 0x6e, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x66, 0x74, 0x70, 0x2e, 0x65, 0x62, 0x69, 0x2e, 0x61, 0x63, 0x2e,
+  0x75, 0x6b, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62,
+  0x61, 0x73, 0x65, 0x73, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2d, 0x41, 0x2e, 0x73, 0x65, 0x65,
+  0x64, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64, 0x62, 0x2e, 0x6d, 0x73,
+  0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d,
+  0x22, 0x53, 0x54, 0x4f, 0x43, 0x4b, 0x48, 0x4f, 0x4c, 0x4d, 0x5f, 0x4d,
+  0x53, 0x41, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x22, 0x50, 0x66, 0x61, 0x6d, 0x2d, 0x42, 0x22, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d,
+  0x73, 0x61, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x3b, 0x20,
+  0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x66, 0x74, 0x70, 0x2e, 0x65, 0x62, 0x69, 0x2e, 0x61, 0x63, 0x2e,
+  0x75, 0x6b, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62,
+  0x61, 0x73, 0x65, 0x73, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69,
+  0x6f, 0x6e, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x66, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x66, 0x74, 0x70, 0x2e, 0x65, 0x62, 0x69, 0x2e, 0x61, 0x63, 0x2e,
+  0x75, 0x6b, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x62,
+  0x61, 0x73, 0x65, 0x73, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2f, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73,
+  0x65, 0x2f, 0x50, 0x66, 0x61, 0x6d, 0x2d, 0x42, 0x2e, 0x74, 0x67, 0x7a,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67,
+  0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e,
+  0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41,
+  0x53, 0x54, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x65, 0x67, 0x67,
+  0x4e, 0x4f, 0x47, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73,
+  0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
+  0x2e, 0x64, 0x6f, 0x6e, 0x65, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x22, 0x2b, 0x25, 0x73, 0x22, 0x20,
+  0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65,
+  0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x65, 0x67, 0x67,
+  0x6e, 0x6f, 0x67, 0x35, 0x2e, 0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x64, 0x65,
+  0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2f, 0x65, 0x67,
+  0x67, 0x6e, 0x6f, 0x67, 0x5f, 0x35, 0x2e, 0x30, 0x2f, 0x70, 0x65, 0x72,
+  0x5f, 0x74, 0x61, 0x78, 0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2f, 0x32,
+  0x2f, 0x32, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x61, 0x6c, 0x67, 0x73, 0x2e,
+  0x74, 0x61, 0x72, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x62, 0x61, 0x63, 0x74, 0x65, 0x72,
+  0x69, 0x61, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e,
+  0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74,
+  0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x65, 0x67, 0x67, 0x6e, 0x6f, 0x67, 0x35,
+  0x2e, 0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x64, 0x65, 0x2f, 0x64, 0x6f, 0x77,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2f, 0x65, 0x67, 0x67, 0x6e, 0x6f, 0x67,
+  0x5f, 0x35, 0x2e, 0x30, 0x2f, 0x70, 0x65, 0x72, 0x5f, 0x74, 0x61, 0x78,
+  0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2f, 0x32, 0x31, 0x35, 0x37, 0x2f,
+  0x32, 0x31, 0x35, 0x37, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x61, 0x6c, 0x67,
+  0x73, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x61, 0x72, 0x63, 0x68,
+  0x65, 0x61, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e,
+  0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74,
+  0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x65, 0x67, 0x67, 0x6e, 0x6f, 0x67, 0x35,
+  0x2e, 0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x64, 0x65, 0x2f, 0x64, 0x6f, 0x77,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2f, 0x65, 0x67, 0x67, 0x6e, 0x6f, 0x67,
+  0x5f, 0x35, 0x2e, 0x30, 0x2f, 0x70, 0x65, 0x72, 0x5f, 0x74, 0x61, 0x78,
+  0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2f, 0x32, 0x37, 0x35, 0x39, 0x2f,
+  0x32, 0x37, 0x35, 0x39, 0x5f, 0x72, 0x61, 0x77, 0x5f, 0x61, 0x6c, 0x67,
+  0x73, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x65, 0x75, 0x6b, 0x61,
+  0x72, 0x79, 0x6f, 0x74, 0x61, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x65, 0x67, 0x67, 0x6e,
+  0x6f, 0x67, 0x35, 0x2e, 0x65, 0x6d, 0x62, 0x6c, 0x2e, 0x64, 0x65, 0x2f,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2f, 0x65, 0x67, 0x67,
+  0x6e, 0x6f, 0x67, 0x5f, 0x35, 0x2e, 0x30, 0x2f, 0x70, 0x65, 0x72, 0x5f,
+  0x74, 0x61, 0x78, 0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2f, 0x31, 0x30,
+  0x32, 0x33, 0x39, 0x2f, 0x31, 0x30, 0x32, 0x33, 0x39, 0x5f, 0x72, 0x61,
+  0x77, 0x5f, 0x61, 0x6c, 0x67, 0x73, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x76, 0x69, 0x72, 0x75, 0x73, 0x65, 0x73, 0x2e, 0x74, 0x61, 0x72,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64, 0x6f, 0x77,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64, 0x6f, 0x6e, 0x65, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54,
+  0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x65, 0x67, 0x67, 0x4e, 0x4f,
+  0x47, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+  0x75, 0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x62, 0x61,
+  0x63, 0x74, 0x65, 0x72, 0x69, 0x61, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68,
+  0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x61, 0x72, 0x63, 0x68, 0x65,
+  0x61, 0x2e, 0x74, 0x61, 0x72, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x65, 0x75, 0x6b, 0x61, 0x72, 0x79, 0x6f, 0x74, 0x61, 0x2e,
+  0x74, 0x61, 0x72, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x76, 0x69, 0x72, 0x75, 0x73, 0x65, 0x73, 0x2e, 0x74, 0x61, 0x72, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x41, 0x52,
+  0x32, 0x44, 0x42, 0x5f, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x45, 0x3d,
+  0x27, 0x5c, 0x2e, 0x72, 0x61, 0x77, 0x5f, 0x61, 0x6c, 0x67, 0x5c, 0x2e,
+  0x66, 0x61, 0x61, 0x5c, 0x2e, 0x67, 0x7a, 0x24, 0x27, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x44, 0x5f, 0x46, 0x49,
+  0x58, 0x5f, 0x4c, 0x4f, 0x4f, 0x4b, 0x55, 0x50, 0x3d, 0x27, 0x73, 0x7c,
+  0x5c, 0x2e, 0x72, 0x61, 0x77, 0x5f, 0x61, 0x6c, 0x67, 0x5c, 0x2e, 0x66,
+  0x61, 0x61, 0x5c, 0x2e, 0x67, 0x7a, 0x7c, 0x7c, 0x67, 0x27, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x56,
+  0x4f, 0x47, 0x44, 0x42, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x2e, 0x64, 0x6f, 0x6e, 0x65, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69,
+  0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66,
+  0x69, 0x6c, 0x65, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2e, 0x63, 0x73, 0x62,
+  0x2e, 0x75, 0x6e, 0x69, 0x76, 0x69, 0x65, 0x2e, 0x61, 0x63, 0x2e, 0x61,
+  0x74, 0x2f, 0x76, 0x6f, 0x67, 0x2f, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74,
+  0x2f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x2e, 0x74, 0x78, 0x74,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65,
+  0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x66, 0x69, 0x6c,
+  0x65, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2e, 0x63, 0x73, 0x62, 0x2e, 0x75,
+  0x6e, 0x69, 0x76, 0x69, 0x65, 0x2e, 0x61, 0x63, 0x2e, 0x61, 0x74, 0x2f,
+  0x76, 0x6f, 0x67, 0x2f, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x2f, 0x76,
+  0x6f, 0x67, 0x2e, 0x72, 0x61, 0x77, 0x5f, 0x61, 0x6c, 0x67, 0x73, 0x2e,
+  0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x6f, 0x67,
+  0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75,
+  0x63, 0x68, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
+  0x2e, 0x64, 0x6f, 0x6e, 0x65, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45,
+  0x3d, 0x22, 0x65, 0x67, 0x67, 0x4e, 0x4f, 0x47, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f, 0x62,
+  0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x6f, 0x67, 0x2e, 0x74, 0x61, 0x72,
+  0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x54, 0x41, 0x52, 0x32, 0x44, 0x42, 0x5f, 0x49, 0x4e, 0x43, 0x4c,
+  0x55, 0x44, 0x45, 0x3d, 0x27, 0x5c, 0x2e, 0x6d, 0x73, 0x61, 0x24, 0x27,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x44,
+  0x5f, 0x46, 0x49, 0x58, 0x5f, 0x4c, 0x4f, 0x4f, 0x4b, 0x55, 0x50, 0x3d,
+  0x27, 0x73, 0x7c, 0x5c, 0x2e, 0x6d, 0x73, 0x61, 0x7c, 0x7c, 0x67, 0x27,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x43, 0x44, 0x44, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6d, 0x73, 0x61,
+  0x2e, 0x67, 0x7a, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70,
+  0x2e, 0x6e, 0x63, 0x62, 0x69, 0x2e, 0x6e, 0x69, 0x68, 0x2e, 0x67, 0x6f,
+  0x76, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x6d, 0x6d, 0x64, 0x62, 0x2f, 0x63,
+  0x64, 0x64, 0x2f, 0x63, 0x64, 0x64, 0x2e, 0x69, 0x6e, 0x66, 0x6f, 0x22,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70,
+  0x2e, 0x6e, 0x63, 0x62, 0x69, 0x2e, 0x6e, 0x69, 0x68, 0x2e, 0x67, 0x6f,
+  0x76, 0x2f, 0x70, 0x75, 0x62, 0x2f, 0x6d, 0x6d, 0x64, 0x62, 0x2f, 0x63,
+  0x64, 0x64, 0x2f, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x74, 0x61, 0x72,
+  0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x74, 0x61,
+  0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d,
+  0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x44, 0x5f,
+  0x46, 0x49, 0x58, 0x5f, 0x4c, 0x4f, 0x4f, 0x4b, 0x55, 0x50, 0x3d, 0x27,
+  0x73, 0x7c, 0x5c, 0x2e, 0x46, 0x41, 0x53, 0x54, 0x41, 0x7c, 0x7c, 0x67,
+  0x27, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x46, 0x41,
+  0x53, 0x54, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x32,
+  0x50, 0x52, 0x4f, 0x46, 0x49, 0x4c, 0x45, 0x5f, 0x50, 0x41, 0x52, 0x3d,
+  0x22, 0x2d, 0x2d, 0x73, 0x6b, 0x69, 0x70, 0x2d, 0x71, 0x75, 0x65, 0x72,
+  0x79, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x22, 0x52, 0x65, 0x73, 0x66, 0x69, 0x6e, 0x64, 0x65, 0x72,
+  0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64, 0x6f,
+  0x6e, 0x65, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22,
+  0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x61, 0x70, 0x69, 0x2e,
+  0x62, 0x69, 0x74, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6f, 0x72,
+  0x67, 0x2f, 0x32, 0x2e, 0x30, 0x2f, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x2f, 0x67, 0x65, 0x6e, 0x6f, 0x6d,
+  0x69, 0x63, 0x65, 0x70, 0x69, 0x64, 0x65, 0x6d, 0x69, 0x6f, 0x6c, 0x6f,
+  0x67, 0x79, 0x2f, 0x72, 0x65, 0x73, 0x66, 0x69, 0x6e, 0x64, 0x65, 0x72,
+  0x5f, 0x64, 0x62, 0x2f, 0x63, 0x6f, 0x6d, 0x6d, 0x69, 0x74, 0x2f, 0x6d,
+  0x61, 0x73, 0x74, 0x65, 0x72, 0x3f, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73,
+  0x3d, 0x68, 0x61, 0x73, 0x68, 0x2c, 0x64, 0x61, 0x74, 0x65, 0x22, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22,
+  0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x62, 0x69, 0x74, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x67, 0x65,
+  0x6e, 0x6f, 0x6d, 0x69, 0x63, 0x65, 0x70, 0x69, 0x64, 0x65, 0x6d, 0x69,
+  0x6f, 0x6c, 0x6f, 0x67, 0x79, 0x2f, 0x72, 0x65, 0x73, 0x66, 0x69, 0x6e,
+  0x64, 0x65, 0x72, 0x5f, 0x64, 0x62, 0x2f, 0x67, 0x65, 0x74, 0x2f, 0x6d,
+  0x61, 0x73, 0x74, 0x65, 0x72, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x6d, 0x61, 0x73, 0x74, 0x65, 0x72, 0x2e, 0x74, 0x61,
+  0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x72, 0x20, 0x2d, 0x43,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x22, 0x20, 0x2d, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x70, 0x2d, 0x63,
+  0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x31, 0x20,
+  0x2d, 0x78, 0x7a, 0x76, 0x66, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x61, 0x73, 0x74, 0x65,
+  0x72, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x2a,
+  0x2e, 0x66, 0x73, 0x61, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6d, 0x20, 0x2d, 0x66, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x6d, 0x61, 0x73, 0x74, 0x65, 0x72, 0x2e, 0x74, 0x61, 0x72, 0x2e,
+  0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64, 0x6f, 0x6e, 0x65,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50,
+  0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x53, 0x41,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x22, 0x64, 0x62, 0x43, 0x41, 0x4e, 0x32, 0x22, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f,
+  0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64, 0x6f, 0x77,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64, 0x6f, 0x6e, 0x65, 0x22, 0x3b,
+  0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f,
+  0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70,
+  0x3a, 0x2f, 0x2f, 0x62, 0x63, 0x62, 0x2e, 0x75, 0x6e, 0x6c, 0x2e, 0x65,
+  0x64, 0x75, 0x2f, 0x64, 0x62, 0x43, 0x41, 0x4e, 0x32, 0x2f, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2f, 0x64, 0x62, 0x43, 0x41, 0x4e,
+  0x2d, 0x66, 0x61, 0x6d, 0x2d, 0x61, 0x6c, 0x6e, 0x2d, 0x56, 0x39, 0x2e,
+  0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61,
+  0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x66, 0x20, 0x22, 0x39, 0x20, 0x25, 0x73, 0x5c, 0x6e, 0x22,
+  0x20, 0x22, 0x24, 0x28, 0x64, 0x61, 0x74, 0x65, 0x20, 0x22, 0x2b, 0x25,
+  0x73, 0x22, 0x29, 0x22, 0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64, 0x6f, 0x6e,
+  0x65, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e,
+  0x50, 0x55, 0x54, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41,
+  0x53, 0x54, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x45, 0x44, 0x5f, 0x46, 0x49, 0x58,
+  0x5f, 0x4c, 0x4f, 0x4f, 0x4b, 0x55, 0x50, 0x3d, 0x27, 0x73, 0x7c, 0x5c,
+  0x2e, 0x61, 0x6c, 0x6e, 0x7c, 0x7c, 0x67, 0x27, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 0x49, 0x4c,
+  0x56, 0x41, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x64,
+  0x6f, 0x6e, 0x65, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e,
+  0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74,
+  0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x61, 0x72,
+  0x62, 0x2d, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x2e, 0x64, 0x65, 0x2f, 0x72,
+  0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x24, 0x7b, 0x53, 0x49, 0x4c,
+  0x56, 0x41, 0x5f, 0x52, 0x45, 0x4c, 0x7d, 0x2f, 0x45, 0x78, 0x70, 0x6f,
+  0x72, 0x74, 0x73, 0x2f, 0x52, 0x45, 0x41, 0x44, 0x4d, 0x45, 0x2e, 0x74,
+  0x78, 0x74, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+  0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20,
+  0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70,
+  0x2e, 0x61, 0x72, 0x62, 0x2d, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x2e, 0x64,
+  0x65, 0x2f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x24, 0x7b,
+  0x53, 0x49, 0x4c, 0x56, 0x41, 0x5f, 0x52, 0x45, 0x4c, 0x7d, 0x2f, 0x45,
+  0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2f, 0x53, 0x49, 0x4c, 0x56, 0x41,
+  0x5f, 0x24, 0x7b, 0x53, 0x49, 0x4c, 0x56, 0x41, 0x5f, 0x52, 0x45, 0x4c,
+  0x7d, 0x5f, 0x53, 0x53, 0x55, 0x52, 0x65, 0x66, 0x5f, 0x4e, 0x52, 0x39,
+  0x39, 0x5f, 0x74, 0x61, 0x78, 0x5f, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x2e,
+  0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x73,
+  0x69, 0x6c, 0x76, 0x61, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67,
+  0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65,
+  0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x74,
+  0x70, 0x2e, 0x61, 0x72, 0x62, 0x2d, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x2e,
+  0x64, 0x65, 0x2f, 0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x5f, 0x24,
+  0x7b, 0x53, 0x49, 0x4c, 0x56, 0x41, 0x5f, 0x52, 0x45, 0x4c, 0x7d, 0x2f,
+  0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73, 0x2f, 0x74, 0x61, 0x78, 0x6f,
+  0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x74, 0x61, 0x78, 0x5f, 0x73, 0x6c, 0x76,
+  0x5f, 0x73, 0x73, 0x75, 0x5f, 0x24, 0x7b, 0x53, 0x49, 0x4c, 0x56, 0x41,
+  0x5f, 0x52, 0x45, 0x4c, 0x7d, 0x2e, 0x74, 0x78, 0x74, 0x2e, 0x67, 0x7a,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x5f, 0x74, 0x61, 0x78,
+  0x2e, 0x74, 0x78, 0x74, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x75, 0x6e, 0x7a, 0x69, 0x70,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x5f, 0x74, 0x61, 0x78, 0x2e,
+  0x74, 0x78, 0x74, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61,
+  0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73,
+  0x3a, 0x2f, 0x2f, 0x66, 0x74, 0x70, 0x2e, 0x61, 0x72, 0x62, 0x2d, 0x73,
+  0x69, 0x6c, 0x76, 0x61, 0x2e, 0x64, 0x65, 0x2f, 0x72, 0x65, 0x6c, 0x65,
+  0x61, 0x73, 0x65, 0x5f, 0x24, 0x7b, 0x53, 0x49, 0x4c, 0x56, 0x41, 0x5f,
+  0x52, 0x45, 0x4c, 0x7d, 0x2f, 0x45, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x73,
+  0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x74, 0x61,
+  0x78, 0x5f, 0x73, 0x6c, 0x76, 0x5f, 0x73, 0x73, 0x75, 0x5f, 0x24, 0x7b,
+  0x53, 0x49, 0x4c, 0x56, 0x41, 0x5f, 0x52, 0x45, 0x4c, 0x7d, 0x2e, 0x61,
+  0x63, 0x63, 0x5f, 0x74, 0x61, 0x78, 0x69, 0x64, 0x2e, 0x67, 0x7a, 0x22,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x2e, 0x61, 0x63, 0x63, 0x5f,
+  0x74, 0x61, 0x78, 0x69, 0x64, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x75, 0x6e, 0x7a, 0x69,
+  0x70, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x2e, 0x61, 0x63, 0x63,
+  0x5f, 0x74, 0x61, 0x78, 0x69, 0x64, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75, 0x63,
+  0x68, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e,
+  0x64, 0x6f, 0x6e, 0x65, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73,
+  0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x73, 0x69, 0x6c, 0x76,
+  0x61, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f,
+  0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f,
+  0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x4b, 0x61, 0x6c, 0x61, 0x6d, 0x61,
+  0x72, 0x69, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74,
+  0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69, 0x2e,
+  0x74, 0x73, 0x76, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+  0x72, 0x69, 0x6e, 0x74, 0x66, 0x20, 0x22, 0x33, 0x2e, 0x37, 0x20, 0x25,
+  0x73, 0x5c, 0x6e, 0x22, 0x20, 0x22, 0x24, 0x28, 0x64, 0x61, 0x74, 0x65,
+  0x20, 0x22, 0x2b, 0x25, 0x73, 0x22, 0x29, 0x22, 0x20, 0x3e, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x77,
+  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x68,
+  0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x72, 0x61, 0x77, 0x2e, 0x67,
+  0x69, 0x74, 0x68, 0x75, 0x62, 0x75, 0x73, 0x65, 0x72, 0x63, 0x6f, 0x6e,
+  0x74, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x6c, 0x73, 0x6b,
+  0x61, 0x74, 0x7a, 0x2f, 0x4b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69,
+  0x2f, 0x6d, 0x61, 0x73, 0x74, 0x65, 0x72, 0x2f, 0x73, 0x72, 0x63, 0x2f,
+  0x4b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69, 0x5f, 0x76, 0x33, 0x2e,
+  0x37, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c, 0x61,
+  0x6d, 0x61, 0x72, 0x69, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x49,
+  0x4f, 0x4e, 0x53, 0x3d, 0x22, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d,
+  0x53, 0x43, 0x32, 0x30, 0x33, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x49, 0x46, 0x53,
+  0x3d, 0x22, 0x24, 0x28, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x20, 0x27,
+  0x5c, 0x74, 0x27, 0x29, 0x22, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x2d,
+  0x72, 0x20, 0x4e, 0x41, 0x4d, 0x45, 0x20, 0x41, 0x43, 0x43, 0x45, 0x53,
+  0x53, 0x49, 0x4f, 0x4e, 0x20, 0x54, 0x41, 0x58, 0x49, 0x44, 0x3b, 0x20,
+  0x64, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5b, 0x20, 0x22, 0x24, 0x4e, 0x41,
+  0x4d, 0x45, 0x22, 0x20, 0x3d, 0x20, 0x22, 0x73, 0x63, 0x69, 0x65, 0x6e,
+  0x74, 0x69, 0x66, 0x69, 0x63, 0x4e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x5d,
+  0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+  0x61, 0x73, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x41, 0x43, 0x43, 0x45, 0x53,
+  0x53, 0x49, 0x4f, 0x4e, 0x7d, 0x22, 0x20, 0x69, 0x6e, 0x20, 0x58, 0x58,
+  0x58, 0x2a, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x69, 0x6e, 0x75, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x73, 0x61, 0x63, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x5b, 0x20, 0x2d, 0x7a, 0x20, 0x22, 0x24, 0x41, 0x43, 0x43, 0x45,
+  0x53, 0x53, 0x49, 0x4f, 0x4e, 0x53, 0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x43, 0x43, 0x45,
+  0x53, 0x53, 0x49, 0x4f, 0x4e, 0x53, 0x3d, 0x22, 0x24, 0x41, 0x43, 0x43,
+  0x45, 0x53, 0x53, 0x49, 0x4f, 0x4e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x49,
+  0x4f, 0x4e, 0x53, 0x3d, 0x22, 0x24, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53,
+  0x49, 0x4f, 0x4e, 0x53, 0x2c, 0x24, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53,
+  0x49, 0x4f, 0x4e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x6e, 0x65, 0x20, 0x3c, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69, 0x2e, 0x74, 0x73, 0x76,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69, 0x2e, 0x66, 0x61, 0x73,
+  0x74, 0x61, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20,
+  0x52, 0x65, 0x73, 0x65, 0x74, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f,
+  0x61, 0x64, 0x20, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x67, 0x79, 0x20,
+  0x74, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20, 0x61,
+  0x72, 0x69, 0x61, 0x32, 0x63, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x4e, 0x43,
+  0x42, 0x49, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x3d,
+  0x22, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x68, 0x61, 0x73, 0x43, 0x6f, 0x6d,
+  0x6d, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x75, 0x72, 0x6c, 0x3b, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x20, 0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59,
+  0x3d, 0x22, 0x24, 0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x20,
+  0x43, 0x55, 0x52, 0x4c, 0x22, 0x3b, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x68, 0x61, 0x73, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20,
+  0x77, 0x67, 0x65, 0x74, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x53,
+  0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x3d, 0x22, 0x24, 0x53, 0x54,
+  0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x20, 0x57, 0x47, 0x45, 0x54, 0x22,
+  0x3b, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5b, 0x20, 0x22, 0x24,
+  0x53, 0x54, 0x52, 0x41, 0x54, 0x45, 0x47, 0x59, 0x22, 0x20, 0x3d, 0x20,
+  0x22, 0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x4e, 0x6f, 0x20,
+  0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x74, 0x6f, 0x6f,
+  0x6c, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x50,
+  0x41, 0x54, 0x48, 0x2e, 0x20, 0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20,
+  0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x72, 0x69, 0x61,
+  0x32, 0x63, 0x2c, 0x20, 0x63, 0x75, 0x72, 0x6c, 0x20, 0x6f, 0x72, 0x20,
+  0x77, 0x67, 0x65, 0x74, 0x2e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x46, 0x69, 0x6c, 0x65, 0x20, 0x22,
+  0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x65, 0x75, 0x74, 0x69,
+  0x6c, 0x73, 0x2e, 0x6e, 0x63, 0x62, 0x69, 0x2e, 0x6e, 0x6c, 0x6d, 0x2e,
+  0x6e, 0x69, 0x68, 0x2e, 0x67, 0x6f, 0x76, 0x2f, 0x65, 0x6e, 0x74, 0x72,
+  0x65, 0x7a, 0x2f, 0x65, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2f, 0x65, 0x66,
+  0x65, 0x74, 0x63, 0x68, 0x2e, 0x66, 0x63, 0x67, 0x69, 0x3f, 0x64, 0x62,
+  0x3d, 0x6e, 0x75, 0x63, 0x6c, 0x65, 0x6f, 0x74, 0x69, 0x64, 0x65, 0x26,
+  0x69, 0x64, 0x3d, 0x24, 0x7b, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x49,
+  0x4f, 0x4e, 0x53, 0x7d, 0x26, 0x72, 0x65, 0x74, 0x74, 0x79, 0x70, 0x65,
+  0x3d, 0x66, 0x61, 0x73, 0x74, 0x61, 0x26, 0x72, 0x65, 0x74, 0x6d, 0x6f,
+  0x64, 0x65, 0x3d, 0x74, 0x78, 0x74, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c,
+  0x61, 0x6d, 0x61, 0x72, 0x69, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e,
+  0x74, 0x6d, 0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x77, 0x6b, 0x20, 0x27, 0x2f, 0x3c,
+  0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x2f, 0x20, 0x7b, 0x20,
+  0x65, 0x78, 0x69, 0x74, 0x20, 0x31, 0x3b, 0x20, 0x7d, 0x20, 0x27, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69, 0x2e, 0x66, 0x61,
+  0x73, 0x74, 0x61, 0x2e, 0x74, 0x6d, 0x70, 0x22, 0x20, 0x7c, 0x7c, 0x20,
+  0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x43, 0x6f, 0x75, 0x6c, 0x64, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64,
+  0x20, 0x67, 0x65, 0x6e, 0x6f, 0x6d, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x4e, 0x43, 0x42, 0x49, 0x2e, 0x20, 0x50, 0x6c, 0x65, 0x61,
+  0x73, 0x65, 0x20, 0x74, 0x72, 0x79, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e,
+  0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x2e, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x77, 0x6b,
+  0x20, 0x2d, 0x46, 0x20, 0x27, 0x5b, 0x5c, 0x74, 0x3e, 0x2e, 0x5d, 0x27,
+  0x20, 0x27, 0x4e, 0x52, 0x20, 0x3d, 0x3d, 0x20, 0x46, 0x4e, 0x52, 0x20,
+  0x7b, 0x20, 0x66, 0x5b, 0x24, 0x32, 0x5d, 0x3d, 0x24, 0x4e, 0x46, 0x3b,
+  0x20, 0x6e, 0x65, 0x78, 0x74, 0x3b, 0x20, 0x7d, 0x20, 0x2f, 0x5e, 0x3e,
+  0x2f, 0x7b, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x24, 0x30, 0x22,
+  0x20, 0x54, 0x61, 0x78, 0x49, 0x44, 0x3d, 0x22, 0x66, 0x5b, 0x24, 0x32,
+  0x5d, 0x22, 0x20, 0x22, 0x3b, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x3b, 0x20,
+  0x7d, 0x20, 0x7b, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x3b, 0x20, 0x7d,
+  0x27, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69, 0x2e,
+  0x74, 0x73, 0x76, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61,
+  0x72, 0x69, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x74, 0x6d, 0x70,
+  0x22, 0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72,
+  0x69, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6d, 0x20,
+  0x2d, 0x66, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61, 0x72, 0x69,
+  0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x2e, 0x74, 0x6d, 0x70, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x75, 0x73, 0x68, 0x5f,
+  0x62, 0x61, 0x63, 0x6b, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6b, 0x61, 0x6c, 0x61, 0x6d, 0x61,
+  0x72, 0x69, 0x2e, 0x66, 0x61, 0x73, 0x74, 0x61, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f,
+  0x54, 0x59, 0x50, 0x45, 0x3d, 0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f,
+  0x4c, 0x49, 0x53, 0x54, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b,
+  0x0a, 0x65, 0x73, 0x61, 0x63, 0x0a, 0x0a, 0x69, 0x66, 0x20, 0x6e, 0x6f,
+  0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x4f,
+  0x55, 0x54, 0x44, 0x42, 0x7d, 0x2e, 0x64, 0x62, 0x74, 0x79, 0x70, 0x65,
+  0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x63, 0x61, 0x73, 0x65,
+  0x20, 0x22, 0x24, 0x7b, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x5f, 0x54, 0x59,
+  0x50, 0x45, 0x7d, 0x22, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x46, 0x41, 0x53, 0x54, 0x41, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x22,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76,
+  0x61, 0x6c, 0x20, 0x22, 0x73, 0x65, 0x74, 0x20, 0x2d, 0x2d, 0x20, 0x24,
+  0x41, 0x52, 0x52, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43,
+  0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22,
+  0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x62, 0x20, 0x22, 0x24,
+  0x7b, 0x40, 0x7d, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44,
+  0x42, 0x7d, 0x22, 0x20, 0x24, 0x7b, 0x43, 0x4f, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69,
+  0x6c, 0x20, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x62, 0x20,
+  0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x20, 0x69, 0x6e, 0x20, 0x22,
+  0x24, 0x7b, 0x40, 0x7d, 0x22, 0x3b, 0x20, 0x64, 0x6f, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6d,
+  0x20, 0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x69, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x6e, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x46, 0x53, 0x41, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d,
+  0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53,
+  0x7d, 0x22, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x62, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x22, 0x2a, 0x2e, 0x66, 0x73, 0x61, 0x20, 0x22, 0x24, 0x7b, 0x4f,
+  0x55, 0x54, 0x44, 0x42, 0x7d, 0x22, 0x20, 0x24, 0x7b, 0x43, 0x4f, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20,
+  0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+  0x64, 0x62, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6d, 0x20, 0x2d, 0x66, 0x20, 0x2d,
+  0x2d, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x22, 0x2a, 0x2e, 0x66, 0x73, 0x61, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x41, 0x33,
+  0x4d, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32,
+  0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20,
+  0x6d, 0x73, 0x61, 0x32, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54,
+  0x44, 0x42, 0x7d, 0x22, 0x20, 0x2d, 0x2d, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x2d, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x31, 0x20, 0x2d, 0x2d, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x2d, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x20, 0x30, 0x2e,
+  0x35, 0x20, 0x2d, 0x2d, 0x6d, 0x73, 0x61, 0x2d, 0x74, 0x79, 0x70, 0x65,
+  0x20, 0x31, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53,
+  0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66,
+  0x61, 0x69, 0x6c, 0x20, 0x22, 0x6d, 0x73, 0x61, 0x32, 0x70, 0x72, 0x6f,
+  0x66, 0x69, 0x6c, 0x65, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x53,
+  0x54, 0x4f, 0x43, 0x4b, 0x48, 0x4f, 0x4c, 0x4d, 0x5f, 0x4d, 0x53, 0x41,
+  0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
+  0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
+  0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30,
+  0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
+  0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20, 0x63,
+  0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x6d, 0x73, 0x61, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64,
+  0x62, 0x2e, 0x6d, 0x73, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d,
+  0x73, 0x61, 0x22, 0x20, 0x24, 0x7b, 0x56, 0x45, 0x52, 0x42, 0x5f, 0x50,
+  0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69,
+  0x6c, 0x20, 0x22, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x6d, 0x73,
+  0x61, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x6d, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x64,
+  0x62, 0x2e, 0x6d, 0x73, 0x61, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c,
+  0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62,
+  0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53,
+  0x45, 0x51, 0x53, 0x7d, 0x22, 0x20, 0x6d, 0x73, 0x61, 0x32, 0x70, 0x72,
+  0x6f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20,
+  0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x22, 0x20, 0x2d,
+  0x2d, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2d, 0x6d, 0x6f, 0x64, 0x65, 0x20,
+  0x31, 0x20, 0x2d, 0x2d, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2d, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x24, 0x7b, 0x54, 0x48,
+  0x52, 0x45, 0x41, 0x44, 0x53, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x6d, 0x73,
+  0x61, 0x32, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x64, 0x69,
+  0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x5b, 0x20, 0x2d, 0x6e, 0x20, 0x22, 0x24, 0x7b, 0x52,
+  0x45, 0x4d, 0x4f, 0x56, 0x45, 0x5f, 0x54, 0x4d, 0x50, 0x7d, 0x22, 0x20,
+  0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68,
+  0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73,
+  0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20,
+  0x72, 0x6d, 0x64, 0x62, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20, 0x24,
+  0x7b, 0x56, 0x45, 0x52, 0x42, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c,
+  0x20, 0x22, 0x72, 0x6d, 0x64, 0x62, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22,
+  0x46, 0x41, 0x53, 0x54, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x22, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68,
+  0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73,
+  0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d,
+  0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20, 0x74, 0x61, 0x72, 0x32,
+  0x64, 0x62, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x74, 0x61, 0x72, 0x2e,
+  0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20, 0x2d, 0x2d,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2d, 0x64, 0x62, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x31, 0x31, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41,
+  0x44, 0x53, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x20, 0x5c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
+  0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x74, 0x61, 0x72, 0x32,
+  0x64, 0x62, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5b, 0x20, 0x2d, 0x6e,
+  0x20, 0x22, 0x24, 0x7b, 0x53, 0x45, 0x44, 0x5f, 0x46, 0x49, 0x58, 0x5f,
+  0x4c, 0x4f, 0x4f, 0x4b, 0x55, 0x50, 0x7d, 0x22, 0x20, 0x5d, 0x3b, 0x20,
+  0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x64, 0x20, 0x22, 0x24, 0x7b,
+  0x53, 0x45, 0x44, 0x5f, 0x46, 0x49, 0x58, 0x5f, 0x4c, 0x4f, 0x4f, 0x4b,
+  0x55, 0x50, 0x7d, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f,
+  0x6f, 0x6b, 0x75, 0x70, 0x22, 0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61,
+  0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x74, 0x6d, 0x70, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6d, 0x76, 0x20, 0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d,
+  0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x74, 0x6d,
+  0x70, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b,
+  0x75, 0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x6d, 0x20, 0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61,
+  0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45,
+  0x51, 0x53, 0x7d, 0x22, 0x20, 0x6d, 0x73, 0x61, 0x32, 0x70, 0x72, 0x6f,
+  0x66, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20, 0x22,
+  0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x22, 0x20, 0x2d, 0x2d,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x2d, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x31,
+  0x20, 0x2d, 0x2d, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2d, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x24, 0x7b, 0x46, 0x41, 0x53,
+  0x54, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x5f, 0x4d, 0x53, 0x41, 0x32, 0x50,
+  0x52, 0x4f, 0x46, 0x49, 0x4c, 0x45, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20,
+  0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53, 0x5f, 0x50, 0x41,
+  0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c,
+  0x20, 0x22, 0x6d, 0x73, 0x61, 0x32, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+  0x65, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5b, 0x20, 0x2d, 0x6e, 0x20,
+  0x22, 0x24, 0x7b, 0x52, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x5f, 0x54, 0x4d,
+  0x50, 0x7d, 0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32,
+  0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51,
+  0x53, 0x7d, 0x22, 0x20, 0x72, 0x6d, 0x64, 0x62, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73,
+  0x61, 0x22, 0x20, 0x24, 0x7b, 0x56, 0x45, 0x52, 0x42, 0x5f, 0x50, 0x41,
+  0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20,
+  0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x72, 0x6d, 0x64, 0x62, 0x20, 0x64,
+  0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x22, 0x65, 0x67, 0x67, 0x4e, 0x4f, 0x47, 0x22, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76, 0x61,
+  0x6c, 0x20, 0x22, 0x73, 0x65, 0x74, 0x20, 0x2d, 0x2d, 0x20, 0x24, 0x41,
+  0x52, 0x52, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32,
+  0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20,
+  0x74, 0x61, 0x72, 0x32, 0x64, 0x62, 0x20, 0x22, 0x24, 0x7b, 0x40, 0x7d,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20, 0x2d, 0x2d, 0x6f, 0x75,
+  0x74, 0x70, 0x75, 0x74, 0x2d, 0x64, 0x62, 0x74, 0x79, 0x70, 0x65, 0x20,
+  0x31, 0x31, 0x20, 0x2d, 0x2d, 0x74, 0x61, 0x72, 0x2d, 0x69, 0x6e, 0x63,
+  0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x41, 0x52, 0x32,
+  0x44, 0x42, 0x5f, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x45, 0x7d, 0x22,
+  0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53, 0x5f, 0x50,
+  0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69,
+  0x6c, 0x20, 0x22, 0x74, 0x61, 0x72, 0x32, 0x64, 0x62, 0x20, 0x64, 0x69,
+  0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x6d, 0x20, 0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x7b,
+  0x40, 0x7d, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x5b, 0x20, 0x2d, 0x6e, 0x20, 0x22, 0x24, 0x7b, 0x53,
+  0x45, 0x44, 0x5f, 0x46, 0x49, 0x58, 0x5f, 0x4c, 0x4f, 0x4f, 0x4b, 0x55,
+  0x50, 0x7d, 0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x65, 0x64, 0x20, 0x22, 0x24, 0x7b, 0x53, 0x45, 0x44, 0x5f, 0x46,
+  0x49, 0x58, 0x5f, 0x4c, 0x4f, 0x4f, 0x4b, 0x55, 0x50, 0x7d, 0x22, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x22,
+  0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b,
+  0x75, 0x70, 0x5f, 0x74, 0x6d, 0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x76, 0x20, 0x2d,
+  0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f,
+  0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x74, 0x6d, 0x70, 0x22, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d,
+  0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73,
+  0x7c, 0x5c, 0x2e, 0x72, 0x61, 0x77, 0x5f, 0x61, 0x6c, 0x67, 0x5c, 0x2e,
+  0x66, 0x61, 0x61, 0x5c, 0x2e, 0x67, 0x7a, 0x7c, 0x7c, 0x67, 0x27, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x22,
+  0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b,
+  0x75, 0x70, 0x2e, 0x74, 0x6d, 0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x76, 0x20, 0x2d, 0x66, 0x20, 0x2d, 0x2d,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70,
+  0x2e, 0x74, 0x6d, 0x70, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c,
+  0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d,
+  0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53,
+  0x7d, 0x22, 0x20, 0x6d, 0x73, 0x61, 0x32, 0x70, 0x72, 0x6f, 0x66, 0x69,
+  0x6c, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x22, 0x20, 0x2d, 0x2d, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x2d, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x31, 0x20, 0x2d,
+  0x2d, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2d, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x20, 0x30, 0x2e, 0x35, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41,
+  0x44, 0x53, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c,
+  0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x6d, 0x73, 0x61, 0x32, 0x70,
+  0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x76, 0x20,
+  0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x6c,
+  0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55,
+  0x54, 0x44, 0x42, 0x7d, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x76, 0x20,
+  0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x2e, 0x73,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55,
+  0x54, 0x44, 0x42, 0x7d, 0x2e, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x5b, 0x20, 0x2d, 0x6e, 0x20, 0x22, 0x24, 0x7b, 0x52, 0x45, 0x4d, 0x4f,
+  0x56, 0x45, 0x5f, 0x54, 0x4d, 0x50, 0x7d, 0x22, 0x20, 0x5d, 0x3b, 0x20,
+  0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b,
+  0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20, 0x72, 0x6d, 0x64,
+  0x62, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x6d, 0x73, 0x61, 0x22, 0x20, 0x24, 0x7b, 0x56, 0x45,
+  0x52, 0x42, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x72,
+  0x6d, 0x64, 0x62, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x47, 0x54, 0x44,
+  0x42, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32,
+  0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20,
+  0x74, 0x61, 0x72, 0x32, 0x64, 0x62, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x67, 0x74, 0x64, 0x62,
+  0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67, 0x7a, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61,
+  0x72, 0x64, 0x62, 0x22, 0x20, 0x2d, 0x2d, 0x74, 0x61, 0x72, 0x2d, 0x69,
+  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x27, 0x66, 0x61, 0x61, 0x24,
+  0x27, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53, 0x5f,
+  0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61,
+  0x69, 0x6c, 0x20, 0x22, 0x74, 0x61, 0x72, 0x32, 0x64, 0x62, 0x20, 0x64,
+  0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x65, 0x64, 0x20, 0x27, 0x73, 0x7c, 0x5f, 0x70, 0x72, 0x6f,
+  0x74, 0x65, 0x69, 0x6e, 0x5c, 0x2e, 0x66, 0x61, 0x61, 0x7c, 0x7c, 0x67,
+  0x27, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x74, 0x61, 0x72, 0x64, 0x62, 0x2e, 0x6c, 0x6f, 0x6f,
+  0x6b, 0x75, 0x70, 0x22, 0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x72, 0x64,
+  0x62, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x2e, 0x74, 0x6d, 0x70,
+  0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x76,
+  0x20, 0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x72, 0x64,
+  0x62, 0x2e, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x2e, 0x74, 0x6d, 0x70,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x74, 0x61, 0x72, 0x64, 0x62, 0x2e, 0x6c, 0x6f, 0x6f,
+  0x6b, 0x75, 0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43,
+  0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22,
+  0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x62, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74,
+  0x61, 0x72, 0x64, 0x62, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54,
+  0x44, 0x42, 0x7d, 0x22, 0x20, 0x24, 0x7b, 0x43, 0x4f, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61,
+  0x69, 0x6c, 0x20, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x62,
+  0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x5b, 0x20, 0x2d, 0x6e, 0x20, 0x22,
+  0x24, 0x7b, 0x52, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x5f, 0x54, 0x4d, 0x50,
+  0x7d, 0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
+  0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
+  0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30,
+  0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53,
+  0x7d, 0x22, 0x20, 0x72, 0x6d, 0x64, 0x62, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x72,
+  0x64, 0x62, 0x22, 0x20, 0x24, 0x7b, 0x56, 0x45, 0x52, 0x42, 0x5f, 0x50,
+  0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c,
+  0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x72, 0x6d, 0x64, 0x62, 0x20,
+  0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a,
+  0x65, 0x73, 0x61, 0x63, 0x0a, 0x66, 0x69, 0x0a, 0x0a, 0x69, 0x66, 0x20,
+  0x5b, 0x20, 0x2d, 0x6e, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x41, 0x58, 0x4f,
+  0x4e, 0x4f, 0x4d, 0x59, 0x7d, 0x22, 0x20, 0x5d, 0x20, 0x26, 0x26, 0x20,
+  0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24,
+  0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x5f, 0x6d, 0x61, 0x70, 0x70,
+  0x69, 0x6e, 0x67, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x53,
+  0x45, 0x4c, 0x45, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x7d, 0x22, 0x20, 0x69,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x53, 0x49, 0x4c,
+  0x56, 0x41, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6d, 0x6b, 0x64, 0x69, 0x72, 0x20, 0x2d, 0x70, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74,
+  0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x31, 0x36, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4d, 0x44, 0x3d, 0x27, 0x42, 0x45,
+  0x47, 0x49, 0x4e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x73, 0x5b,
+  0x22, 0x72, 0x6f, 0x6f, 0x74, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x22, 0x31, 0x5c,
+  0x74, 0x7c, 0x5c, 0x74, 0x31, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x6e, 0x6f,
+  0x20, 0x72, 0x61, 0x6e, 0x6b, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x2d, 0x5c,
+  0x74, 0x7c, 0x22, 0x20, 0x3e, 0x20, 0x74, 0x61, 0x78, 0x64, 0x69, 0x72,
+  0x22, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70, 0x22,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x22, 0x31,
+  0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x72, 0x6f, 0x6f, 0x74, 0x5c, 0x74, 0x7c,
+  0x5c, 0x74, 0x2d, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x73, 0x63, 0x69, 0x65,
+  0x6e, 0x74, 0x69, 0x66, 0x69, 0x63, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x5c,
+  0x74, 0x7c, 0x22, 0x20, 0x3e, 0x20, 0x74, 0x61, 0x78, 0x64, 0x69, 0x72,
+  0x22, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70, 0x22,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x28, 0x24, 0x31, 0x2c, 0x20, 0x61, 0x2c, 0x20, 0x22, 0x3b, 0x22,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x73, 0x75, 0x62, 0x28, 0x22, 0x64,
+  0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x22, 0x2c, 0x20, 0x22, 0x73, 0x75, 0x70,
+  0x65, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x64, 0x6f, 0x6d, 0x22, 0x2c, 0x20,
+  0x24, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x73, 0x5b, 0x24,
+  0x31, 0x5d, 0x20, 0x3d, 0x20, 0x24, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67,
+  0x73, 0x75, 0x62, 0x28, 0x2f, 0x5b, 0x5e, 0x2c, 0x3b, 0x5d, 0x2a, 0x3b,
+  0x24, 0x2f, 0x2c, 0x20, 0x22, 0x22, 0x2c, 0x20, 0x24, 0x31, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x24,
+  0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x20, 0x3d,
+  0x3d, 0x20, 0x32, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+  0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x72, 0x6f, 0x6f, 0x74,
+  0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x69, 0x64,
+  0x20, 0x3d, 0x20, 0x69, 0x64, 0x73, 0x5b, 0x70, 0x6e, 0x61, 0x6d, 0x65,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28,
+  0x22, 0x25, 0x73, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x25, 0x73, 0x5c, 0x74,
+  0x7c, 0x5c, 0x74, 0x25, 0x73, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x2d, 0x5c,
+  0x74, 0x7c, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x24, 0x32, 0x2c, 0x20, 0x70,
+  0x69, 0x64, 0x2c, 0x20, 0x24, 0x33, 0x29, 0x20, 0x3e, 0x20, 0x74, 0x61,
+  0x78, 0x64, 0x69, 0x72, 0x22, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e,
+  0x64, 0x6d, 0x70, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e,
+  0x74, 0x66, 0x28, 0x22, 0x25, 0x73, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x25,
+  0x73, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x2d, 0x5c, 0x74, 0x7c, 0x5c, 0x74,
+  0x73, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x63, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x5c, 0x74, 0x7c, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x24,
+  0x32, 0x2c, 0x20, 0x61, 0x5b, 0x6e, 0x2d, 0x31, 0x5d, 0x29, 0x20, 0x3e,
+  0x20, 0x74, 0x61, 0x78, 0x64, 0x69, 0x72, 0x22, 0x2f, 0x6e, 0x61, 0x6d,
+  0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x27, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x77, 0x6b, 0x20, 0x2d, 0x76,
+  0x20, 0x74, 0x61, 0x78, 0x64, 0x69, 0x72, 0x3d, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78,
+  0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x22, 0x20, 0x2d, 0x46, 0x27, 0x5c, 0x74,
+  0x27, 0x20, 0x22, 0x24, 0x43, 0x4d, 0x44, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x73, 0x69,
+  0x6c, 0x76, 0x61, 0x5f, 0x74, 0x61, 0x78, 0x2e, 0x74, 0x78, 0x74, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75,
+  0x63, 0x68, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79,
+  0x2f, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x64, 0x2e, 0x64, 0x6d, 0x70, 0x22,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75,
+  0x63, 0x68, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79,
+  0x2f, 0x64, 0x65, 0x6c, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x64, 0x6d,
+  0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
+  0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
+  0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30,
+  0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
+  0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20, 0x63,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x74, 0x61, 0x78, 0x64, 0x62, 0x20, 0x22,
+  0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x22, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74,
+  0x61, 0x78, 0x64, 0x62, 0x22, 0x20, 0x2d, 0x2d, 0x6e, 0x63, 0x62, 0x69,
+  0x2d, 0x74, 0x61, 0x78, 0x2d, 0x64, 0x75, 0x6d, 0x70, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74,
+  0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x22, 0x20, 0x2d, 0x2d, 0x74,
+  0x61, 0x78, 0x2d, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x66,
+  0x69, 0x6c, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x73, 0x69, 0x6c, 0x76, 0x61, 0x2e, 0x61,
+  0x63, 0x63, 0x5f, 0x74, 0x61, 0x78, 0x69, 0x64, 0x22, 0x20, 0x24, 0x7b,
+  0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53, 0x5f, 0x50, 0x41, 0x52, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x22, 0x4e, 0x52, 0x22, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x20,
+  0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x5f, 0x6d, 0x61,
+  0x70, 0x70, 0x69, 0x6e, 0x67, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d,
+  0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53,
+  0x7d, 0x22, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x74, 0x61, 0x78,
+  0x64, 0x62, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x22,
+  0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53, 0x5f, 0x50,
+  0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69,
+  0x6c, 0x20, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x74, 0x61, 0x78,
+  0x64, 0x62, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45,
+  0x51, 0x53, 0x7d, 0x22, 0x20, 0x6e, 0x72, 0x74, 0x6f, 0x74, 0x61, 0x78,
+  0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x64, 0x62,
+  0x2e, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74,
+  0x61, 0x78, 0x69, 0x64, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x70, 0x72, 0x6f, 0x74, 0x2e,
+  0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x32, 0x74, 0x61,
+  0x78, 0x69, 0x64, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44,
+  0x42, 0x7d, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42,
+  0x7d, 0x5f, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x24,
+  0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53, 0x5f, 0x50, 0x41, 0x52,
+  0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20,
+  0x22, 0x6e, 0x72, 0x74, 0x6f, 0x74, 0x61, 0x78, 0x6d, 0x61, 0x70, 0x70,
+  0x69, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x22, 0x47, 0x54, 0x44, 0x42, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65,
+  0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61,
+  0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x31, 0x36, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4d, 0x44,
+  0x3d, 0x27, 0x42, 0x45, 0x47, 0x49, 0x4e, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x46, 0x53, 0x20, 0x3d, 0x20, 0x22, 0x5b, 0x5c, 0x74, 0x3b, 0x5d, 0x22,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x5b, 0x22, 0x63, 0x22,
+  0x5d, 0x20, 0x3d, 0x20, 0x22, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x22, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x5b, 0x22, 0x64, 0x22, 0x5d,
+  0x20, 0x3d, 0x20, 0x22, 0x73, 0x75, 0x70, 0x65, 0x72, 0x6b, 0x69, 0x6e,
+  0x67, 0x64, 0x6f, 0x6d, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e,
+  0x6b, 0x5b, 0x22, 0x66, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x22, 0x66, 0x61,
+  0x6d, 0x69, 0x6c, 0x79, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e,
+  0x6b, 0x5b, 0x22, 0x67, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x22, 0x67, 0x65,
+  0x6e, 0x75, 0x73, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e, 0x6b,
+  0x5b, 0x22, 0x6f, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x22, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x5b,
+  0x22, 0x70, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x22, 0x70, 0x68, 0x79, 0x6c,
+  0x75, 0x6d, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x5b,
+  0x22, 0x73, 0x22, 0x5d, 0x20, 0x3d, 0x20, 0x22, 0x73, 0x70, 0x65, 0x63,
+  0x69, 0x65, 0x73, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x78, 0x43,
+  0x6e, 0x74, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64,
+  0x73, 0x5b, 0x22, 0x72, 0x6f, 0x6f, 0x74, 0x22, 0x5d, 0x20, 0x3d, 0x20,
+  0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x22,
+  0x31, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x31, 0x5c, 0x74, 0x7c, 0x5c, 0x74,
+  0x6e, 0x6f, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x5c, 0x74, 0x7c, 0x5c, 0x74,
+  0x2d, 0x5c, 0x74, 0x7c, 0x22, 0x20, 0x3e, 0x20, 0x74, 0x61, 0x78, 0x64,
+  0x69, 0x72, 0x22, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x64, 0x6d,
+  0x70, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20,
+  0x22, 0x31, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x72, 0x6f, 0x6f, 0x74, 0x5c,
+  0x74, 0x7c, 0x5c, 0x74, 0x2d, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x73, 0x63,
+  0x69, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x63, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x5c, 0x74, 0x7c, 0x22, 0x20, 0x3e, 0x20, 0x74, 0x61, 0x78, 0x64,
+  0x69, 0x72, 0x22, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x64, 0x6d,
+  0x70, 0x22, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x76, 0x54, 0x61,
+  0x78, 0x6f, 0x6e, 0x3d, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x28, 0x69, 0x20, 0x3d, 0x20, 0x32, 0x3b, 0x20, 0x69, 0x20, 0x3c,
+  0x3d, 0x20, 0x4e, 0x46, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x24,
+  0x69, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x64, 0x73, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72,
+  0x65, 0x76, 0x54, 0x61, 0x78, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x69, 0x64,
+  0x73, 0x5b, 0x24, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x61, 0x78, 0x43,
+  0x6e, 0x74, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x73, 0x5b, 0x24, 0x69, 0x5d, 0x20,
+  0x3d, 0x20, 0x74, 0x61, 0x78, 0x43, 0x6e, 0x74, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x20, 0x3d, 0x20,
+  0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x28, 0x24, 0x69, 0x2c, 0x20, 0x30,
+  0x2c, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x73,
+  0x75, 0x62, 0x73, 0x74, 0x72, 0x28, 0x24, 0x69, 0x2c, 0x20, 0x34, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x67, 0x73, 0x75, 0x62, 0x28, 0x2f, 0x5f, 0x2f, 0x2c, 0x20, 0x22, 0x20,
+  0x22, 0x2c, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69, 0x6e,
+  0x74, 0x66, 0x28, 0x22, 0x25, 0x73, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x25,
+  0x73, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x25, 0x73, 0x5c, 0x74, 0x7c, 0x5c,
+  0x74, 0x2d, 0x5c, 0x74, 0x7c, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x74, 0x61,
+  0x78, 0x43, 0x6e, 0x74, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x76, 0x54, 0x61,
+  0x78, 0x6f, 0x6e, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x5b, 0x72, 0x5d,
+  0x29, 0x20, 0x3e, 0x20, 0x74, 0x61, 0x78, 0x64, 0x69, 0x72, 0x22, 0x2f,
+  0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70, 0x22, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72,
+  0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x25, 0x73, 0x5c, 0x74, 0x7c, 0x5c,
+  0x74, 0x25, 0x73, 0x5c, 0x74, 0x7c, 0x5c, 0x74, 0x2d, 0x5c, 0x74, 0x7c,
+  0x5c, 0x74, 0x73, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x63,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x5c, 0x74, 0x7c, 0x5c, 0x6e, 0x22, 0x2c,
+  0x20, 0x74, 0x61, 0x78, 0x43, 0x6e, 0x74, 0x2c, 0x20, 0x6e, 0x61, 0x6d,
+  0x65, 0x29, 0x20, 0x3e, 0x20, 0x74, 0x61, 0x78, 0x64, 0x69, 0x72, 0x22,
+  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70, 0x22, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+  0x72, 0x65, 0x76, 0x54, 0x61, 0x78, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x74,
+  0x61, 0x78, 0x43, 0x6e, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x66, 0x28, 0x22, 0x25, 0x73, 0x5c, 0x74, 0x25, 0x73, 0x5c,
+  0x6e, 0x22, 0x2c, 0x20, 0x24, 0x31, 0x2c, 0x20, 0x69, 0x64, 0x73, 0x5b,
+  0x24, 0x4e, 0x46, 0x5d, 0x29, 0x20, 0x3e, 0x20, 0x74, 0x61, 0x78, 0x64,
+  0x69, 0x72, 0x22, 0x2f, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x5f,
+  0x67, 0x65, 0x6e, 0x6f, 0x6d, 0x65, 0x73, 0x22, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x27, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6b, 0x64,
+  0x69, 0x72, 0x20, 0x2d, 0x70, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e,
+  0x6f, 0x6d, 0x79, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x61, 0x77, 0x6b, 0x20, 0x2d, 0x76, 0x20, 0x74, 0x61,
+  0x78, 0x64, 0x69, 0x72, 0x3d, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f,
+  0x6d, 0x79, 0x22, 0x20, 0x22, 0x24, 0x43, 0x4d, 0x44, 0x22, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x62, 0x61, 0x63, 0x31, 0x32, 0x30, 0x5f, 0x74, 0x61, 0x78, 0x6f, 0x6e,
+  0x6f, 0x6d, 0x79, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x20, 0x22, 0x24, 0x7b,
+  0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x61, 0x72,
+  0x31, 0x32, 0x32, 0x5f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79,
+  0x2e, 0x74, 0x73, 0x76, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74,
+  0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x6d, 0x65, 0x72, 0x67,
+  0x65, 0x64, 0x2e, 0x64, 0x6d, 0x70, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x64, 0x65,
+  0x6c, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70, 0x22, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20,
+  0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64,
+  0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38,
+  0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20,
+  0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x74, 0x61, 0x78, 0x64, 0x62, 0x20,
+  0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x22, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x74, 0x61, 0x78, 0x64, 0x62, 0x22, 0x20, 0x2d, 0x2d, 0x6e, 0x63, 0x62,
+  0x69, 0x2d, 0x74, 0x61, 0x78, 0x2d, 0x64, 0x75, 0x6d, 0x70, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x22, 0x20, 0x2d, 0x2d,
+  0x74, 0x61, 0x78, 0x2d, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d,
+  0x66, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f,
+  0x6d, 0x79, 0x2f, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x5f, 0x67,
+  0x65, 0x6e, 0x6f, 0x6d, 0x65, 0x73, 0x22, 0x20, 0x2d, 0x2d, 0x74, 0x61,
+  0x78, 0x2d, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x6d, 0x6f,
+  0x64, 0x65, 0x20, 0x31, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41,
+  0x44, 0x53, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x63, 0x72, 0x65,
+  0x61, 0x74, 0x65, 0x74, 0x61, 0x78, 0x64, 0x62, 0x20, 0x64, 0x69, 0x65,
+  0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x5b, 0x20, 0x2d, 0x6e, 0x20, 0x22, 0x24, 0x7b,
+  0x52, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x5f, 0x54, 0x4d, 0x50, 0x7d, 0x22,
+  0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x6d, 0x20, 0x2d, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24, 0x7b, 0x54,
+  0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78,
+  0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e,
+  0x64, 0x6d, 0x70, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f,
+  0x6d, 0x79, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f,
+  0x6d, 0x65, 0x72, 0x67, 0x65, 0x64, 0x2e, 0x64, 0x6d, 0x70, 0x22, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x64, 0x65,
+  0x6c, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x64, 0x6d, 0x70, 0x22, 0x20,
+  0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d,
+  0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2f, 0x6d, 0x61,
+  0x70, 0x70, 0x69, 0x6e, 0x67, 0x5f, 0x67, 0x65, 0x6e, 0x6f, 0x6d, 0x65,
+  0x73, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41,
+  0x54, 0x48, 0x7d, 0x2f, 0x62, 0x61, 0x63, 0x31, 0x32, 0x30, 0x5f, 0x74,
+  0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d, 0x79, 0x2e, 0x74, 0x73, 0x76, 0x22,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x61, 0x72, 0x31, 0x32, 0x32, 0x5f, 0x74, 0x61, 0x78, 0x6f,
+  0x6e, 0x6f, 0x6d, 0x79, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x6d, 0x20, 0x2d, 0x72, 0x66, 0x20, 0x2d, 0x2d, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74,
+  0x61, 0x78, 0x64, 0x62, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50,
+  0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e,
+  0x6f, 0x6d, 0x79, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51,
+  0x53, 0x7d, 0x22, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x69, 0x64,
+  0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x5f, 0x68,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x5f, 0x70, 0x72,
+  0x65, 0x66, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x20, 0x2d, 0x2d, 0x74, 0x73,
+  0x76, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53, 0x5f,
+  0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69,
+  0x6c, 0x20, 0x22, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x69, 0x64, 0x20,
+  0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x61, 0x77, 0x6b, 0x20, 0x27, 0x7b, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x28, 0x24, 0x30, 0x2c, 0x20, 0x2f, 0x20, 0x4f, 0x58, 0x3d, 0x5b,
+  0x30, 0x2d, 0x39, 0x5d, 0x2b, 0x20, 0x2f, 0x29, 0x3b, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x52, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x20, 0x21, 0x3d,
+  0x20, 0x2d, 0x31, 0x29, 0x20, 0x7b, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74,
+  0x20, 0x24, 0x31, 0x22, 0x5c, 0x74, 0x22, 0x73, 0x75, 0x62, 0x73, 0x74,
+  0x72, 0x28, 0x24, 0x30, 0x2c, 0x20, 0x52, 0x53, 0x54, 0x41, 0x52, 0x54,
+  0x2b, 0x34, 0x2c, 0x20, 0x52, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x2d,
+  0x35, 0x29, 0x3b, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x3b, 0x20, 0x7d, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x28, 0x24, 0x30, 0x2c, 0x20, 0x2f, 0x20,
+  0x54, 0x61, 0x78, 0x49, 0x44, 0x3d, 0x5b, 0x30, 0x2d, 0x39, 0x5d, 0x2b,
+  0x20, 0x2f, 0x29, 0x3b, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x24,
+  0x31, 0x22, 0x5c, 0x74, 0x22, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x28,
+  0x24, 0x30, 0x2c, 0x20, 0x52, 0x53, 0x54, 0x41, 0x52, 0x54, 0x2b, 0x37,
+  0x2c, 0x20, 0x52, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x2d, 0x38, 0x29,
+  0x3b, 0x20, 0x7d, 0x27, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+  0x5f, 0x70, 0x72, 0x65, 0x66, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x20, 0x5c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x4c, 0x43, 0x5f, 0x41, 0x4c, 0x4c, 0x3d, 0x43, 0x20, 0x73,
+  0x6f, 0x72, 0x74, 0x20, 0x2d, 0x6e, 0x20, 0x3e, 0x20, 0x22, 0x24, 0x7b,
+  0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x5f, 0x6d, 0x61, 0x70, 0x70, 0x69,
+  0x6e, 0x67, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x6d, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+  0x5f, 0x70, 0x72, 0x65, 0x66, 0x2e, 0x74, 0x73, 0x76, 0x22, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c,
+  0x6c, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62,
+  0x6c, 0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45,
+  0x51, 0x53, 0x7d, 0x22, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x74,
+  0x61, 0x78, 0x64, 0x62, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44,
+  0x42, 0x7d, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x74, 0x61, 0x78, 0x6f, 0x6e, 0x6f, 0x6d,
+  0x79, 0x22, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x53,
+  0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61,
+  0x69, 0x6c, 0x20, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x74, 0x61,
+  0x78, 0x64, 0x62, 0x20, 0x64, 0x69, 0x65, 0x64, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x65, 0x73, 0x61, 0x63, 0x0a, 0x66, 0x69, 0x0a, 0x0a, 0x69, 0x66,
+  0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22,
+  0x24, 0x7b, 0x4f, 0x55, 0x54, 0x44, 0x42, 0x7d, 0x2e, 0x76, 0x65, 0x72,
+  0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x76, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24,
+  0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x76,
+  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f,
+  0x55, 0x54, 0x44, 0x42, 0x7d, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
+  0x6e, 0x22, 0x0a, 0x66, 0x69, 0x0a, 0x0a, 0x69, 0x66, 0x20, 0x5b, 0x20,
+  0x2d, 0x6e, 0x20, 0x22, 0x24, 0x7b, 0x52, 0x45, 0x4d, 0x4f, 0x56, 0x45,
+  0x5f, 0x54, 0x4d, 0x50, 0x7d, 0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68,
+  0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6d, 0x20, 0x2d, 0x66,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x73,
+  0x68, 0x22, 0x0a, 0x66, 0x69, 0x0a
+};
+unsigned int databases_sh_len = 23466;
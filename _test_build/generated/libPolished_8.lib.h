@@ -0,0 +1,157 @@
+static const unsigned char libPolished_8_lib[] = {
+  0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x4c, 0x69, 0x62, 0x72, 0x61,
+  0x72, 0x79, 0x0a, 0x53, 0x49, 0x5a, 0x45, 0x09, 0x38, 0x0a, 0x4c, 0x45,
+  0x4e, 0x47, 0x09, 0x31, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74,
+  0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f,
+  0x52, 0x09, 0x30, 0x2e, 0x30, 0x33, 0x34, 0x34, 0x36, 0x36, 0x36, 0x36,
+  0x37, 0x0a, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x09, 0x30, 0x2e, 0x35, 0x30,
+  0x2c, 0x30, 0x2e, 0x35, 0x30, 0x2c, 0x30, 0x2e, 0x35, 0x30, 0x0a, 0x49,
+  0x53, 0x4c, 0x4f, 0x47, 0x09, 0x46, 0x0a, 0x4c, 0x45, 0x4e, 0x47, 0x09,
+  0x31, 0x0a, 0x41, 0x4c, 0x50, 0x48, 0x09, 0x32, 0x30, 0x0a, 0x50, 0x52,
+  0x4f, 0x42, 0x53, 0x09, 0x41, 0x09, 0x52, 0x09, 0x4e, 0x09, 0x44, 0x09,
+  0x43, 0x09, 0x51, 0x09, 0x45, 0x09, 0x47, 0x09, 0x48, 0x09, 0x49, 0x09,
+  0x4c, 0x09, 0x4b, 0x09, 0x4d, 0x09, 0x46, 0x09, 0x50, 0x09, 0x53, 0x09,
+  0x54, 0x09, 0x57, 0x09, 0x59, 0x09, 0x56, 0x0a, 0x31, 0x09, 0x34, 0x31,
+  0x35, 0x30, 0x09, 0x34, 0x39, 0x37, 0x30, 0x09, 0x35, 0x36, 0x34, 0x34,
+  0x09, 0x34, 0x39, 0x32, 0x32, 0x09, 0x36, 0x39, 0x30, 0x38, 0x09, 0x34,
+  0x35, 0x31, 0x33, 0x09, 0x35, 0x34, 0x37, 0x32, 0x09, 0x34, 0x38, 0x37,
+  0x36, 0x09, 0x36, 0x39, 0x34, 0x34, 0x09, 0x35, 0x33, 0x37, 0x32, 0x09,
+  0x34, 0x32, 0x39, 0x33, 0x09, 0x34, 0x37, 0x37, 0x35, 0x09, 0x36, 0x33,
+  0x35, 0x31, 0x09, 0x37, 0x36, 0x38, 0x35, 0x09, 0x31, 0x30, 0x36, 0x32,
+  0x09, 0x34, 0x31, 0x37, 0x37, 0x09, 0x34, 0x34, 0x37, 0x39, 0x09, 0x39,
+  0x35, 0x37, 0x31, 0x09, 0x37, 0x34, 0x31, 0x37, 0x09, 0x35, 0x32, 0x32,
+  0x32, 0x0a, 0x2f, 0x2f, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74,
+  0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f,
+  0x52, 0x09, 0x30, 0x2e, 0x30, 0x36, 0x31, 0x34, 0x20, 0x20, 0x20, 0x20,
+  0x0a, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x09, 0x30, 0x2e, 0x36, 0x37, 0x2c,
+  0x30, 0x2e, 0x35, 0x30, 0x2c, 0x30, 0x2e, 0x35, 0x30, 0x0a, 0x49, 0x53,
+  0x4c, 0x4f, 0x47, 0x09, 0x46, 0x0a, 0x4c, 0x45, 0x4e, 0x47, 0x09, 0x31,
+  0x0a, 0x41, 0x4c, 0x50, 0x48, 0x09, 0x32, 0x30, 0x0a, 0x50, 0x52, 0x4f,
+  0x42, 0x53, 0x09, 0x41, 0x09, 0x52, 0x09, 0x4e, 0x09, 0x44, 0x09, 0x43,
+  0x09, 0x51, 0x09, 0x45, 0x09, 0x47, 0x09, 0x48, 0x09, 0x49, 0x09, 0x4c,
+  0x09, 0x4b, 0x09, 0x4d, 0x09, 0x46, 0x09, 0x50, 0x09, 0x53, 0x09, 0x54,
+  0x09, 0x57, 0x09, 0x59, 0x09, 0x56, 0x0a, 0x31, 0x09, 0x34, 0x37, 0x30,
+  0x39, 0x09, 0x35, 0x31, 0x35, 0x35, 0x09, 0x34, 0x36, 0x32, 0x32, 0x09,
+  0x34, 0x33, 0x34, 0x33, 0x09, 0x36, 0x34, 0x30, 0x33, 0x09, 0x35, 0x35,
+  0x33, 0x35, 0x09, 0x34, 0x39, 0x36, 0x34, 0x09, 0x39, 0x30, 0x39, 0x09,
+  0x35, 0x38, 0x32, 0x34, 0x09, 0x36, 0x36, 0x37, 0x31, 0x09, 0x35, 0x32,
+  0x32, 0x30, 0x09, 0x34, 0x32, 0x37, 0x32, 0x09, 0x37, 0x33, 0x32, 0x38,
+  0x09, 0x36, 0x37, 0x32, 0x30, 0x09, 0x35, 0x35, 0x30, 0x39, 0x09, 0x34,
+  0x36, 0x37, 0x36, 0x09, 0x35, 0x31, 0x36, 0x38, 0x09, 0x39, 0x33, 0x37,
+  0x33, 0x09, 0x35, 0x39, 0x31, 0x39, 0x09, 0x35, 0x38, 0x37, 0x37, 0x0a,
+  0x2f, 0x2f, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x50, 0x72,
+  0x6f, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x09,
+  0x30, 0x2e, 0x30, 0x35, 0x32, 0x31, 0x38, 0x33, 0x33, 0x33, 0x33, 0x0a,
+  0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x09, 0x30, 0x2e, 0x38, 0x33, 0x2c, 0x30,
+  0x2e, 0x35, 0x30, 0x2c, 0x30, 0x2e, 0x35, 0x30, 0x0a, 0x49, 0x53, 0x4c,
+  0x4f, 0x47, 0x09, 0x46, 0x0a, 0x4c, 0x45, 0x4e, 0x47, 0x09, 0x31, 0x0a,
+  0x41, 0x4c, 0x50, 0x48, 0x09, 0x32, 0x30, 0x0a, 0x50, 0x52, 0x4f, 0x42,
+  0x53, 0x09, 0x41, 0x09, 0x52, 0x09, 0x4e, 0x09, 0x44, 0x09, 0x43, 0x09,
+  0x51, 0x09, 0x45, 0x09, 0x47, 0x09, 0x48, 0x09, 0x49, 0x09, 0x4c, 0x09,
+  0x4b, 0x09, 0x4d, 0x09, 0x46, 0x09, 0x50, 0x09, 0x53, 0x09, 0x54, 0x09,
+  0x57, 0x09, 0x59, 0x09, 0x56, 0x0a, 0x31, 0x09, 0x35, 0x34, 0x32, 0x37,
+  0x09, 0x35, 0x33, 0x32, 0x30, 0x09, 0x36, 0x32, 0x36, 0x35, 0x09, 0x36,
+  0x38, 0x34, 0x39, 0x09, 0x36, 0x30, 0x30, 0x33, 0x09, 0x36, 0x31, 0x36,
+  0x35, 0x09, 0x35, 0x34, 0x32, 0x37, 0x09, 0x36, 0x31, 0x36, 0x33, 0x09,
+  0x34, 0x39, 0x39, 0x30, 0x09, 0x34, 0x38, 0x38, 0x33, 0x09, 0x33, 0x35,
+  0x35, 0x39, 0x09, 0x35, 0x32, 0x36, 0x30, 0x09, 0x36, 0x30, 0x34, 0x39,
+  0x09, 0x32, 0x30, 0x32, 0x31, 0x09, 0x37, 0x31, 0x34, 0x31, 0x09, 0x35,
+  0x31, 0x33, 0x31, 0x09, 0x35, 0x35, 0x37, 0x34, 0x09, 0x34, 0x32, 0x34,
+  0x34, 0x09, 0x31, 0x38, 0x35, 0x39, 0x09, 0x34, 0x36, 0x33, 0x34, 0x0a,
+  0x2f, 0x2f, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x50, 0x72,
+  0x6f, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x09,
+  0x30, 0x2e, 0x31, 0x33, 0x31, 0x34, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x43,
+  0x4f, 0x4c, 0x4f, 0x52, 0x09, 0x30, 0x2e, 0x35, 0x30, 0x2c, 0x30, 0x2e,
+  0x36, 0x37, 0x2c, 0x30, 0x2e, 0x35, 0x30, 0x0a, 0x49, 0x53, 0x4c, 0x4f,
+  0x47, 0x09, 0x46, 0x0a, 0x4c, 0x45, 0x4e, 0x47, 0x09, 0x31, 0x0a, 0x41,
+  0x4c, 0x50, 0x48, 0x09, 0x32, 0x30, 0x0a, 0x50, 0x52, 0x4f, 0x42, 0x53,
+  0x09, 0x41, 0x09, 0x52, 0x09, 0x4e, 0x09, 0x44, 0x09, 0x43, 0x09, 0x51,
+  0x09, 0x45, 0x09, 0x47, 0x09, 0x48, 0x09, 0x49, 0x09, 0x4c, 0x09, 0x4b,
+  0x09, 0x4d, 0x09, 0x46, 0x09, 0x50, 0x09, 0x53, 0x09, 0x54, 0x09, 0x57,
+  0x09, 0x59, 0x09, 0x56, 0x0a, 0x31, 0x09, 0x34, 0x34, 0x32, 0x34, 0x09,
+  0x34, 0x36, 0x39, 0x30, 0x09, 0x33, 0x39, 0x30, 0x39, 0x09, 0x32, 0x34,
+  0x32, 0x38, 0x09, 0x37, 0x34, 0x35, 0x36, 0x09, 0x34, 0x33, 0x37, 0x34,
+  0x09, 0x32, 0x31, 0x37, 0x36, 0x09, 0x34, 0x32, 0x34, 0x35, 0x09, 0x35,
+  0x35, 0x37, 0x39, 0x09, 0x35, 0x39, 0x35, 0x38, 0x09, 0x35, 0x34, 0x32,
+  0x34, 0x09, 0x33, 0x39, 0x34, 0x37, 0x09, 0x37, 0x39, 0x37, 0x36, 0x09,
+  0x36, 0x33, 0x32, 0x32, 0x09, 0x34, 0x39, 0x34, 0x30, 0x09, 0x34, 0x33,
+  0x30, 0x34, 0x09, 0x33, 0x36, 0x31, 0x30, 0x09, 0x39, 0x33, 0x38, 0x32,
+  0x09, 0x36, 0x33, 0x30, 0x35, 0x09, 0x36, 0x32, 0x32, 0x32, 0x0a, 0x2f,
+  0x2f, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x50, 0x72, 0x6f,
+  0x66, 0x69, 0x6c, 0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x09, 0x30,
+  0x2e, 0x31, 0x35, 0x35, 0x34, 0x38, 0x33, 0x33, 0x33, 0x0a, 0x43, 0x4f,
+  0x4c, 0x4f, 0x52, 0x09, 0x30, 0x2e, 0x36, 0x37, 0x2c, 0x30, 0x2e, 0x36,
+  0x37, 0x2c, 0x30, 0x2e, 0x35, 0x30, 0x0a, 0x49, 0x53, 0x4c, 0x4f, 0x47,
+  0x09, 0x46, 0x0a, 0x4c, 0x45, 0x4e, 0x47, 0x09, 0x31, 0x0a, 0x41, 0x4c,
+  0x50, 0x48, 0x09, 0x32, 0x30, 0x0a, 0x50, 0x52, 0x4f, 0x42, 0x53, 0x09,
+  0x41, 0x09, 0x52, 0x09, 0x4e, 0x09, 0x44, 0x09, 0x43, 0x09, 0x51, 0x09,
+  0x45, 0x09, 0x47, 0x09, 0x48, 0x09, 0x49, 0x09, 0x4c, 0x09, 0x4b, 0x09,
+  0x4d, 0x09, 0x46, 0x09, 0x50, 0x09, 0x53, 0x09, 0x54, 0x09, 0x57, 0x09,
+  0x59, 0x09, 0x56, 0x0a, 0x31, 0x09, 0x34, 0x33, 0x39, 0x36, 0x09, 0x36,
+  0x37, 0x32, 0x31, 0x09, 0x37, 0x31, 0x38, 0x36, 0x09, 0x36, 0x34, 0x33,
+  0x36, 0x09, 0x36, 0x37, 0x35, 0x35, 0x09, 0x35, 0x35, 0x32, 0x36, 0x09,
+  0x36, 0x35, 0x36, 0x35, 0x09, 0x35, 0x39, 0x36, 0x30, 0x09, 0x37, 0x30,
+  0x38, 0x31, 0x09, 0x32, 0x35, 0x31, 0x36, 0x09, 0x31, 0x37, 0x30, 0x39,
+  0x09, 0x36, 0x34, 0x34, 0x32, 0x09, 0x34, 0x36, 0x32, 0x38, 0x09, 0x33,
+  0x39, 0x38, 0x34, 0x09, 0x36, 0x39, 0x33, 0x34, 0x09, 0x36, 0x36, 0x37,
+  0x31, 0x09, 0x34, 0x39, 0x33, 0x36, 0x09, 0x38, 0x34, 0x31, 0x34, 0x09,
+  0x35, 0x39, 0x38, 0x39, 0x09, 0x32, 0x33, 0x36, 0x32, 0x0a, 0x2f, 0x2f,
+  0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x50, 0x72, 0x6f, 0x66,
+  0x69, 0x6c, 0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x09, 0x30, 0x2e,
+  0x31, 0x39, 0x31, 0x34, 0x35, 0x20, 0x20, 0x20, 0x0a, 0x43, 0x4f, 0x4c,
+  0x4f, 0x52, 0x09, 0x30, 0x2e, 0x38, 0x33, 0x2c, 0x30, 0x2e, 0x36, 0x37,
+  0x2c, 0x30, 0x2e, 0x35, 0x30, 0x0a, 0x49, 0x53, 0x4c, 0x4f, 0x47, 0x09,
+  0x46, 0x0a, 0x4c, 0x45, 0x4e, 0x47, 0x09, 0x31, 0x0a, 0x41, 0x4c, 0x50,
+  0x48, 0x09, 0x32, 0x30, 0x0a, 0x50, 0x52, 0x4f, 0x42, 0x53, 0x09, 0x41,
+  0x09, 0x52, 0x09, 0x4e, 0x09, 0x44, 0x09, 0x43, 0x09, 0x51, 0x09, 0x45,
+  0x09, 0x47, 0x09, 0x48, 0x09, 0x49, 0x09, 0x4c, 0x09, 0x4b, 0x09, 0x4d,
+  0x09, 0x46, 0x09, 0x50, 0x09, 0x53, 0x09, 0x54, 0x09, 0x57, 0x09, 0x59,
+  0x09, 0x56, 0x0a, 0x31, 0x09, 0x32, 0x35, 0x33, 0x38, 0x09, 0x34, 0x39,
+  0x33, 0x39, 0x09, 0x34, 0x37, 0x30, 0x31, 0x09, 0x33, 0x38, 0x35, 0x32,
+  0x09, 0x35, 0x39, 0x39, 0x35, 0x09, 0x35, 0x32, 0x38, 0x30, 0x09, 0x34,
+  0x35, 0x34, 0x34, 0x09, 0x34, 0x34, 0x34, 0x37, 0x09, 0x35, 0x36, 0x31,
+  0x35, 0x09, 0x35, 0x32, 0x37, 0x35, 0x09, 0x34, 0x34, 0x32, 0x35, 0x09,
+  0x34, 0x38, 0x30, 0x33, 0x09, 0x36, 0x31, 0x32, 0x38, 0x09, 0x36, 0x31,
+  0x32, 0x35, 0x09, 0x33, 0x37, 0x38, 0x35, 0x09, 0x32, 0x39, 0x33, 0x39,
+  0x09, 0x32, 0x38, 0x39, 0x33, 0x09, 0x39, 0x33, 0x30, 0x38, 0x09, 0x35,
+  0x34, 0x38, 0x32, 0x09, 0x34, 0x36, 0x39, 0x37, 0x0a, 0x2f, 0x2f, 0x0a,
+  0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x50, 0x72, 0x6f, 0x66, 0x69,
+  0x6c, 0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x09, 0x30, 0x2e, 0x31,
+  0x39, 0x35, 0x33, 0x35, 0x20, 0x20, 0x20, 0x0a, 0x43, 0x4f, 0x4c, 0x4f,
+  0x52, 0x09, 0x30, 0x2e, 0x35, 0x30, 0x2c, 0x30, 0x2e, 0x38, 0x33, 0x2c,
+  0x30, 0x2e, 0x35, 0x30, 0x0a, 0x49, 0x53, 0x4c, 0x4f, 0x47, 0x09, 0x46,
+  0x0a, 0x4c, 0x45, 0x4e, 0x47, 0x09, 0x31, 0x0a, 0x41, 0x4c, 0x50, 0x48,
+  0x09, 0x32, 0x30, 0x0a, 0x50, 0x52, 0x4f, 0x42, 0x53, 0x09, 0x41, 0x09,
+  0x52, 0x09, 0x4e, 0x09, 0x44, 0x09, 0x43, 0x09, 0x51, 0x09, 0x45, 0x09,
+  0x47, 0x09, 0x48, 0x09, 0x49, 0x09, 0x4c, 0x09, 0x4b, 0x09, 0x4d, 0x09,
+  0x46, 0x09, 0x50, 0x09, 0x53, 0x09, 0x54, 0x09, 0x57, 0x09, 0x59, 0x09,
+  0x56, 0x0a, 0x31, 0x09, 0x33, 0x33, 0x31, 0x36, 0x09, 0x34, 0x33, 0x30,
+  0x39, 0x09, 0x35, 0x36, 0x34, 0x36, 0x09, 0x34, 0x37, 0x37, 0x31, 0x09,
+  0x35, 0x38, 0x38, 0x34, 0x09, 0x35, 0x30, 0x35, 0x31, 0x09, 0x34, 0x34,
+  0x31, 0x39, 0x09, 0x35, 0x31, 0x33, 0x39, 0x09, 0x36, 0x32, 0x34, 0x31,
+  0x09, 0x33, 0x34, 0x38, 0x31, 0x09, 0x32, 0x38, 0x37, 0x35, 0x09, 0x34,
+  0x34, 0x33, 0x38, 0x09, 0x34, 0x36, 0x38, 0x32, 0x09, 0x33, 0x36, 0x37,
+  0x38, 0x09, 0x35, 0x32, 0x38, 0x34, 0x09, 0x34, 0x35, 0x36, 0x32, 0x09,
+  0x33, 0x35, 0x33, 0x35, 0x09, 0x37, 0x32, 0x30, 0x32, 0x09, 0x35, 0x32,
+  0x35, 0x36, 0x09, 0x33, 0x36, 0x33, 0x30, 0x0a, 0x2f, 0x2f, 0x0a, 0x43,
+  0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c,
+  0x65, 0x0a, 0x50, 0x52, 0x49, 0x4f, 0x52, 0x09, 0x30, 0x2e, 0x31, 0x37,
+  0x38, 0x32, 0x36, 0x36, 0x36, 0x37, 0x0a, 0x43, 0x4f, 0x4c, 0x4f, 0x52,
+  0x09, 0x30, 0x2e, 0x36, 0x37, 0x2c, 0x30, 0x2e, 0x38, 0x33, 0x2c, 0x30,
+  0x2e, 0x35, 0x30, 0x0a, 0x49, 0x53, 0x4c, 0x4f, 0x47, 0x09, 0x46, 0x0a,
+  0x4c, 0x45, 0x4e, 0x47, 0x09, 0x31, 0x0a, 0x41, 0x4c, 0x50, 0x48, 0x09,
+  0x32, 0x30, 0x0a, 0x50, 0x52, 0x4f, 0x42, 0x53, 0x09, 0x41, 0x09, 0x52,
+  0x09, 0x4e, 0x09, 0x44, 0x09, 0x43, 0x09, 0x51, 0x09, 0x45, 0x09, 0x47,
+  0x09, 0x48, 0x09, 0x49, 0x09, 0x4c, 0x09, 0x4b, 0x09, 0x4d, 0x09, 0x46,
+  0x09, 0x50, 0x09, 0x53, 0x09, 0x54, 0x09, 0x57, 0x09, 0x59, 0x09, 0x56,
+  0x0a, 0x31, 0x09, 0x34, 0x30, 0x33, 0x38, 0x09, 0x32, 0x39, 0x36, 0x33,
+  0x09, 0x34, 0x33, 0x34, 0x31, 0x09, 0x34, 0x35, 0x32, 0x38, 0x09, 0x36,
+  0x37, 0x34, 0x36, 0x09, 0x33, 0x36, 0x38, 0x37, 0x09, 0x33, 0x34, 0x33,
+  0x37, 0x09, 0x35, 0x31, 0x35, 0x38, 0x09, 0x34, 0x36, 0x38, 0x37, 0x09,
+  0x35, 0x35, 0x39, 0x39, 0x09, 0x34, 0x31, 0x32, 0x34, 0x09, 0x32, 0x35,
+  0x35, 0x34, 0x09, 0x35, 0x35, 0x35, 0x36, 0x09, 0x36, 0x32, 0x31, 0x31,
+  0x09, 0x36, 0x33, 0x34, 0x38, 0x09, 0x33, 0x38, 0x32, 0x31, 0x09, 0x34,
+  0x31, 0x33, 0x39, 0x09, 0x38, 0x35, 0x32, 0x30, 0x09, 0x35, 0x35, 0x36,
+  0x35, 0x09, 0x35, 0x33, 0x30, 0x34, 0x0a, 0x2f, 0x2f, 0x0a
+};
+unsigned int libPolished_8_lib_len = 1846;
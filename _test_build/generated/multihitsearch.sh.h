@@ -0,0 +1,141 @@
+static const unsigned char multihitsearch_sh[] = {
+  0x23, 0x21, 0x2f, 0x62, 0x69, 0x6e, 0x2f, 0x73, 0x68, 0x20, 0x2d, 0x65,
+  0x0a, 0x66, 0x61, 0x69, 0x6c, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x63, 0x68, 0x6f, 0x20, 0x22, 0x45, 0x72, 0x72, 0x6f,
+  0x72, 0x3a, 0x20, 0x24, 0x31, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65,
+  0x78, 0x69, 0x74, 0x20, 0x31, 0x0a, 0x7d, 0x0a, 0x0a, 0x6e, 0x6f, 0x74,
+  0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x09,
+  0x5b, 0x20, 0x21, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24, 0x31, 0x22, 0x20,
+  0x5d, 0x0a, 0x7d, 0x0a, 0x0a, 0x23, 0x70, 0x72, 0x65, 0x20, 0x70, 0x72,
+  0x6f, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x0a, 0x5b, 0x20, 0x2d,
+  0x7a, 0x20, 0x22, 0x24, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x22, 0x20,
+  0x5d, 0x20, 0x26, 0x26, 0x20, 0x65, 0x63, 0x68, 0x6f, 0x20, 0x22, 0x50,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e,
+  0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x5c,
+  0x24, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x20, 0x74, 0x6f, 0x20, 0x79,
+  0x6f, 0x75, 0x72, 0x20, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x20, 0x62,
+  0x69, 0x6e, 0x61, 0x72, 0x79, 0x2e, 0x22, 0x20, 0x26, 0x26, 0x20, 0x65,
+  0x78, 0x69, 0x74, 0x20, 0x31, 0x3b, 0x0a, 0x23, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61,
+  0x62, 0x6c, 0x65, 0x73, 0x0a, 0x5b, 0x20, 0x22, 0x24, 0x23, 0x22, 0x20,
+  0x2d, 0x6e, 0x65, 0x20, 0x34, 0x20, 0x5d, 0x20, 0x26, 0x26, 0x20, 0x65,
+  0x63, 0x68, 0x6f, 0x20, 0x22, 0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20,
+  0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x20, 0x3c, 0x71, 0x75, 0x65,
+  0x72, 0x79, 0x44, 0x42, 0x3e, 0x20, 0x3c, 0x74, 0x61, 0x72, 0x67, 0x65,
+  0x74, 0x44, 0x42, 0x3e, 0x20, 0x3c, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x44, 0x42, 0x3e, 0x20, 0x3c, 0x74, 0x6d, 0x70, 0x44, 0x69, 0x72, 0x3e,
+  0x22, 0x20, 0x26, 0x26, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 0x31, 0x3b,
+  0x0a, 0x23, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x69, 0x66, 0x20,
+  0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x0a,
+  0x5b, 0x20, 0x21, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24, 0x31, 0x2e, 0x64,
+  0x62, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x5d, 0x20, 0x26, 0x26, 0x20,
+  0x65, 0x63, 0x68, 0x6f, 0x20, 0x22, 0x24, 0x31, 0x2e, 0x64, 0x62, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e,
+  0x64, 0x21, 0x22, 0x20, 0x26, 0x26, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20,
+  0x31, 0x3b, 0x0a, 0x5b, 0x20, 0x21, 0x20, 0x2d, 0x66, 0x20, 0x22, 0x24,
+  0x32, 0x2e, 0x64, 0x62, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x5d, 0x20,
+  0x26, 0x26, 0x20, 0x65, 0x63, 0x68, 0x6f, 0x20, 0x22, 0x24, 0x32, 0x2e,
+  0x64, 0x62, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66,
+  0x6f, 0x75, 0x6e, 0x64, 0x21, 0x22, 0x20, 0x26, 0x26, 0x20, 0x65, 0x78,
+  0x69, 0x74, 0x20, 0x31, 0x3b, 0x0a, 0x23, 0x20, 0x54, 0x4f, 0x20, 0x44,
+  0x4f, 0x3f, 0x3f, 0x3f, 0x20, 0x61, 0x64, 0x64, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x69, 0x66, 0x20, 0x24, 0x33, 0x2e, 0x64, 0x62, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20,
+  0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72,
+  0x65, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x72, 0x65, 0x20, 0x77, 0x6f, 0x72,
+  0x6b, 0x66, 0x6f, 0x6c, 0x77, 0x20, 0x3f, 0x3f, 0x3f, 0x0a, 0x0a, 0x51,
+  0x55, 0x45, 0x52, 0x59, 0x3d, 0x22, 0x24, 0x31, 0x22, 0x0a, 0x54, 0x41,
+  0x52, 0x47, 0x45, 0x54, 0x3d, 0x22, 0x24, 0x32, 0x22, 0x0a, 0x4f, 0x55,
+  0x54, 0x50, 0x55, 0x54, 0x3d, 0x22, 0x24, 0x33, 0x22, 0x0a, 0x54, 0x4d,
+  0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x3d, 0x22, 0x24, 0x34, 0x22, 0x0a,
+  0x0a, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74,
+  0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d,
+  0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22,
+  0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x22, 0x24, 0x7b, 0x51, 0x55, 0x45,
+  0x52, 0x59, 0x7d, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x41, 0x52, 0x47,
+  0x45, 0x54, 0x7d, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x22, 0x20, 0x24,
+  0x7b, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x5f, 0x50, 0x41, 0x52, 0x7d,
+  0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
+  0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x22, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x22, 0x0a, 0x66,
+  0x69, 0x0a, 0x0a, 0x69, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69,
+  0x73, 0x74, 0x73, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50,
+  0x41, 0x54, 0x48, 0x7d, 0x2f, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61,
+  0x74, 0x65, 0x2e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x3b, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x61, 0x67,
+  0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x74,
+  0x61, 0x6b, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68,
+  0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x68, 0x69, 0x74,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x3d, 0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x22, 0x24, 0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22,
+  0x20, 0x62, 0x65, 0x73, 0x74, 0x68, 0x69, 0x74, 0x70, 0x65, 0x72, 0x73,
+  0x65, 0x74, 0x20, 0x22, 0x24, 0x7b, 0x51, 0x55, 0x45, 0x52, 0x59, 0x7d,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x41, 0x52, 0x47, 0x45, 0x54, 0x7d,
+  0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x22,
+  0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f,
+  0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x22, 0x20, 0x24,
+  0x7b, 0x42, 0x45, 0x53, 0x54, 0x48, 0x49, 0x54, 0x42, 0x59, 0x53, 0x45,
+  0x54, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69, 0x6c,
+  0x20, 0x22, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x20,
+  0x62, 0x65, 0x73, 0x74, 0x20, 0x68, 0x69, 0x74, 0x20, 0x66, 0x61, 0x69,
+  0x6c, 0x65, 0x64, 0x22, 0x0a, 0x66, 0x69, 0x0a, 0x0a, 0x69, 0x66, 0x20,
+  0x6e, 0x6f, 0x74, 0x45, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x22, 0x24,
+  0x7b, 0x4f, 0x55, 0x54, 0x50, 0x55, 0x54, 0x7d, 0x2e, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x22, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53,
+  0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24,
+  0x7b, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x7d, 0x22, 0x20, 0x6d, 0x65,
+  0x72, 0x67, 0x65, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x62, 0x79,
+  0x73, 0x65, 0x74, 0x20, 0x22, 0x24, 0x7b, 0x51, 0x55, 0x45, 0x52, 0x59,
+  0x7d, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x6d, 0x65, 0x6d,
+  0x62, 0x65, 0x72, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f,
+  0x50, 0x41, 0x54, 0x48, 0x7d, 0x2f, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67,
+  0x61, 0x74, 0x65, 0x22, 0x20, 0x22, 0x24, 0x7b, 0x4f, 0x55, 0x54, 0x50,
+  0x55, 0x54, 0x7d, 0x22, 0x20, 0x24, 0x7b, 0x54, 0x48, 0x52, 0x45, 0x41,
+  0x44, 0x53, 0x5f, 0x50, 0x41, 0x52, 0x7d, 0x20, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x61, 0x69,
+  0x6c, 0x20, 0x22, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x73, 0x65, 0x74, 0x72,
+  0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65,
+  0x64, 0x22, 0x0a, 0x66, 0x69, 0x0a, 0x0a, 0x69, 0x66, 0x20, 0x5b, 0x20,
+  0x2d, 0x6e, 0x20, 0x22, 0x24, 0x7b, 0x52, 0x45, 0x4d, 0x4f, 0x56, 0x45,
+  0x5f, 0x54, 0x4d, 0x50, 0x7d, 0x22, 0x20, 0x5d, 0x3b, 0x20, 0x74, 0x68,
+  0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6d, 0x64, 0x69, 0x72,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x22, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x53,
+  0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22, 0x24,
+  0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x22, 0x20, 0x72, 0x6d, 0x64, 0x62,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x24, 0x7b,
+  0x56, 0x45, 0x52, 0x42, 0x4f, 0x53, 0x49, 0x54, 0x59, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x23, 0x20, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3d,
+  0x53, 0x43, 0x32, 0x30, 0x38, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x22,
+  0x24, 0x4d, 0x4d, 0x53, 0x45, 0x51, 0x53, 0x22, 0x20, 0x72, 0x6d, 0x64,
+  0x62, 0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54,
+  0x48, 0x7d, 0x2f, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65,
+  0x22, 0x20, 0x24, 0x7b, 0x56, 0x45, 0x52, 0x42, 0x4f, 0x53, 0x49, 0x54,
+  0x59, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6d, 0x20, 0x2d, 0x66,
+  0x20, 0x22, 0x24, 0x7b, 0x54, 0x4d, 0x50, 0x5f, 0x50, 0x41, 0x54, 0x48,
+  0x7d, 0x2f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x68, 0x69, 0x74, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x2e, 0x73, 0x68, 0x22, 0x0a, 0x66, 0x69, 0x0a,
+  0x0a
+};
+unsigned int multihitsearch_sh_len = 1645;
@@ -0,0 +1,36 @@
+static const unsigned char nucleotide_out[] = {
+  0x23, 0x20, 0x4e, 0x55, 0x43, 0x4c, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x2f,
+  0x32, 0x20, 0x42, 0x69, 0x74, 0x0a, 0x23, 0x20, 0x42, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x28, 0x70, 0x72, 0x65, 0x63,
+  0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x61, 0x6c, 0x29, 0x3a, 0x20, 0x30, 0x2e, 0x32, 0x34, 0x39,
+  0x39, 0x39, 0x37, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x34, 0x39, 0x39, 0x39,
+  0x37, 0x35, 0x20, 0x30, 0x2e, 0x32, 0x34, 0x39, 0x39, 0x39, 0x37, 0x35,
+  0x20, 0x30, 0x2e, 0x32, 0x34, 0x39, 0x39, 0x39, 0x37, 0x35, 0x20, 0x30,
+  0x2e, 0x30, 0x30, 0x30, 0x30, 0x31, 0x0a, 0x23, 0x20, 0x4c, 0x61, 0x6d,
+  0x62, 0x64, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x72, 0x65,
+  0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x29, 0x3a, 0x20, 0x30, 0x2e, 0x36, 0x33,
+  0x33, 0x37, 0x33, 0x31, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x41, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x58, 0x0a, 0x41, 0x20, 0x20, 0x32, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30,
+  0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30,
+  0x0a, 0x43, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x20,
+  0x32, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30,
+  0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d,
+  0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x54, 0x20, 0x2d, 0x33, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30,
+  0x20, 0x20, 0x32, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30,
+  0x0a, 0x47, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d,
+  0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30,
+  0x30, 0x30, 0x20, 0x20, 0x32, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d,
+  0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x0a, 0x58, 0x20, 0x2d, 0x33, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30,
+  0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e,
+  0x30, 0x30, 0x30, 0x30, 0x20, 0x2d, 0x33, 0x2e, 0x30, 0x30, 0x30, 0x30
+};
+unsigned int nucleotide_out_len = 396;
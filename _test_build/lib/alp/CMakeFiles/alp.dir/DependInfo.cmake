@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/alp/njn_dynprogprob.cpp" "lib/alp/CMakeFiles/alp.dir/njn_dynprogprob.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_dynprogprob.cpp.o.d"
+  "/root/repo/lib/alp/njn_dynprogproblim.cpp" "lib/alp/CMakeFiles/alp.dir/njn_dynprogproblim.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_dynprogproblim.cpp.o.d"
+  "/root/repo/lib/alp/njn_dynprogprobproto.cpp" "lib/alp/CMakeFiles/alp.dir/njn_dynprogprobproto.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_dynprogprobproto.cpp.o.d"
+  "/root/repo/lib/alp/njn_ioutil.cpp" "lib/alp/CMakeFiles/alp.dir/njn_ioutil.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_ioutil.cpp.o.d"
+  "/root/repo/lib/alp/njn_localmaxstat.cpp" "lib/alp/CMakeFiles/alp.dir/njn_localmaxstat.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_localmaxstat.cpp.o.d"
+  "/root/repo/lib/alp/njn_localmaxstatmatrix.cpp" "lib/alp/CMakeFiles/alp.dir/njn_localmaxstatmatrix.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_localmaxstatmatrix.cpp.o.d"
+  "/root/repo/lib/alp/njn_localmaxstatutil.cpp" "lib/alp/CMakeFiles/alp.dir/njn_localmaxstatutil.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_localmaxstatutil.cpp.o.d"
+  "/root/repo/lib/alp/njn_random.cpp" "lib/alp/CMakeFiles/alp.dir/njn_random.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/njn_random.cpp.o.d"
+  "/root/repo/lib/alp/sls_alignment_evaluer.cpp" "lib/alp/CMakeFiles/alp.dir/sls_alignment_evaluer.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/sls_alignment_evaluer.cpp.o.d"
+  "/root/repo/lib/alp/sls_alp.cpp" "lib/alp/CMakeFiles/alp.dir/sls_alp.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/sls_alp.cpp.o.d"
+  "/root/repo/lib/alp/sls_alp_data.cpp" "lib/alp/CMakeFiles/alp.dir/sls_alp_data.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/sls_alp_data.cpp.o.d"
+  "/root/repo/lib/alp/sls_alp_regression.cpp" "lib/alp/CMakeFiles/alp.dir/sls_alp_regression.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/sls_alp_regression.cpp.o.d"
+  "/root/repo/lib/alp/sls_alp_sim.cpp" "lib/alp/CMakeFiles/alp.dir/sls_alp_sim.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/sls_alp_sim.cpp.o.d"
+  "/root/repo/lib/alp/sls_basic.cpp" "lib/alp/CMakeFiles/alp.dir/sls_basic.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/sls_basic.cpp.o.d"
+  "/root/repo/lib/alp/sls_pvalues.cpp" "lib/alp/CMakeFiles/alp.dir/sls_pvalues.cpp.o" "gcc" "lib/alp/CMakeFiles/alp.dir/sls_pvalues.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alp.dir/njn_dynprogprob.cpp.o"
+  "CMakeFiles/alp.dir/njn_dynprogprob.cpp.o.d"
+  "CMakeFiles/alp.dir/njn_dynprogproblim.cpp.o"
+  "CMakeFiles/alp.dir/njn_dynprogproblim.cpp.o.d"
+  "CMakeFiles/alp.dir/njn_dynprogprobproto.cpp.o"
+  "CMakeFiles/alp.dir/njn_dynprogprobproto.cpp.o.d"
+  "CMakeFiles/alp.dir/njn_ioutil.cpp.o"
+  "CMakeFiles/alp.dir/njn_ioutil.cpp.o.d"
+  "CMakeFiles/alp.dir/njn_localmaxstat.cpp.o"
+  "CMakeFiles/alp.dir/njn_localmaxstat.cpp.o.d"
+  "CMakeFiles/alp.dir/njn_localmaxstatmatrix.cpp.o"
+  "CMakeFiles/alp.dir/njn_localmaxstatmatrix.cpp.o.d"
+  "CMakeFiles/alp.dir/njn_localmaxstatutil.cpp.o"
+  "CMakeFiles/alp.dir/njn_localmaxstatutil.cpp.o.d"
+  "CMakeFiles/alp.dir/njn_random.cpp.o"
+  "CMakeFiles/alp.dir/njn_random.cpp.o.d"
+  "CMakeFiles/alp.dir/sls_alignment_evaluer.cpp.o"
+  "CMakeFiles/alp.dir/sls_alignment_evaluer.cpp.o.d"
+  "CMakeFiles/alp.dir/sls_alp.cpp.o"
+  "CMakeFiles/alp.dir/sls_alp.cpp.o.d"
+  "CMakeFiles/alp.dir/sls_alp_data.cpp.o"
+  "CMakeFiles/alp.dir/sls_alp_data.cpp.o.d"
+  "CMakeFiles/alp.dir/sls_alp_regression.cpp.o"
+  "CMakeFiles/alp.dir/sls_alp_regression.cpp.o.d"
+  "CMakeFiles/alp.dir/sls_alp_sim.cpp.o"
+  "CMakeFiles/alp.dir/sls_alp_sim.cpp.o.d"
+  "CMakeFiles/alp.dir/sls_basic.cpp.o"
+  "CMakeFiles/alp.dir/sls_basic.cpp.o.d"
+  "CMakeFiles/alp.dir/sls_pvalues.cpp.o"
+  "CMakeFiles/alp.dir/sls_pvalues.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/cacode/lambda_calculator.cpp" "lib/cacode/CMakeFiles/cacode.dir/lambda_calculator.cpp.o" "gcc" "lib/cacode/CMakeFiles/cacode.dir/lambda_calculator.cpp.o.d"
+  "/root/repo/lib/cacode/lubksb.cpp" "lib/cacode/CMakeFiles/cacode.dir/lubksb.cpp.o" "gcc" "lib/cacode/CMakeFiles/cacode.dir/lubksb.cpp.o.d"
+  "/root/repo/lib/cacode/ludcmp.cpp" "lib/cacode/CMakeFiles/cacode.dir/ludcmp.cpp.o" "gcc" "lib/cacode/CMakeFiles/cacode.dir/ludcmp.cpp.o.d"
+  "/root/repo/lib/cacode/nrutil.cpp" "lib/cacode/CMakeFiles/cacode.dir/nrutil.cpp.o" "gcc" "lib/cacode/CMakeFiles/cacode.dir/nrutil.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
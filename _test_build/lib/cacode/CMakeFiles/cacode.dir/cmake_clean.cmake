@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cacode.dir/lambda_calculator.cpp.o"
+  "CMakeFiles/cacode.dir/lambda_calculator.cpp.o.d"
+  "CMakeFiles/cacode.dir/lubksb.cpp.o"
+  "CMakeFiles/cacode.dir/lubksb.cpp.o.d"
+  "CMakeFiles/cacode.dir/ludcmp.cpp.o"
+  "CMakeFiles/cacode.dir/ludcmp.cpp.o.d"
+  "CMakeFiles/cacode.dir/nrutil.cpp.o"
+  "CMakeFiles/cacode.dir/nrutil.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cacode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ksw2.dir/ksw2_extz2_sse.cpp.o"
+  "CMakeFiles/ksw2.dir/ksw2_extz2_sse.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ksw2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/microtar.dir/microtar.c.o"
+  "CMakeFiles/microtar.dir/microtar.c.o.d"
+  "libmicrotar.a"
+  "libmicrotar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/microtar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tinyexpr.dir/tinyexpr.c.o"
+  "CMakeFiles/tinyexpr.dir/tinyexpr.c.o.d"
+  "libtinyexpr.a"
+  "libtinyexpr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tinyexpr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libzstd.pc"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/libzstd.pc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,65 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/entropy_common.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/entropy_common.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/error_private.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/error_private.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/fse_decompress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/fse_decompress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/pool.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/pool.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/threading.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/threading.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/xxhash.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/xxhash.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/zstd_common.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/common/zstd_common.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/fse_compress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/fse_compress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/hist.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/hist.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/huf_compress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/huf_compress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_compress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_compress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_double_fast.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_double_fast.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_fast.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_fast.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_lazy.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_lazy.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_ldm.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_ldm.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_opt.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstd_opt.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstdmt_compress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/compress/zstdmt_compress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/huf_decompress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/huf_decompress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/zstd_ddict.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/zstd_ddict.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/zstd_decompress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/zstd_decompress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/zstd_decompress_block.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/decompress/zstd_decompress_block.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/deprecated/zbuff_common.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/deprecated/zbuff_common.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/deprecated/zbuff_compress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/deprecated/zbuff_compress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/deprecated/zbuff_decompress.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/deprecated/zbuff_decompress.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/cover.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/cover.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/divsufsort.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/divsufsort.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/fastcover.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/fastcover.c.o.d"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/zdict.c.o"
+  "CMakeFiles/libzstd_static.dir/__/__/__/lib/dictBuilder/zdict.c.o.d"
+  "libzstd.a"
+  "libzstd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libzstd_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
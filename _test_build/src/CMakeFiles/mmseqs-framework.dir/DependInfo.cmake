@@ -0,0 +1,186 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/MMseqsBase.cpp" "src/CMakeFiles/mmseqs-framework.dir/MMseqsBase.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/MMseqsBase.cpp.o.d"
+  "/root/repo/src/alignment/Alignment.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/Alignment.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/Alignment.cpp.o.d"
+  "/root/repo/src/alignment/BandedNucleotideAligner.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/BandedNucleotideAligner.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/BandedNucleotideAligner.cpp.o.d"
+  "/root/repo/src/alignment/CompressedA3M.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/CompressedA3M.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/CompressedA3M.cpp.o.d"
+  "/root/repo/src/alignment/Main.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/Main.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/Main.cpp.o.d"
+  "/root/repo/src/alignment/Matcher.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/Matcher.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/Matcher.cpp.o.d"
+  "/root/repo/src/alignment/MsaFilter.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/MsaFilter.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/MsaFilter.cpp.o.d"
+  "/root/repo/src/alignment/MultipleAlignment.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/MultipleAlignment.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/MultipleAlignment.cpp.o.d"
+  "/root/repo/src/alignment/PSSMCalculator.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/PSSMCalculator.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/PSSMCalculator.cpp.o.d"
+  "/root/repo/src/alignment/StripedSmithWaterman.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/StripedSmithWaterman.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/StripedSmithWaterman.cpp.o.d"
+  "/root/repo/src/alignment/prefilteralign.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/prefilteralign.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/prefilteralign.cpp.o.d"
+  "/root/repo/src/alignment/rescorediagonal.cpp" "src/CMakeFiles/mmseqs-framework.dir/alignment/rescorediagonal.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/alignment/rescorediagonal.cpp.o.d"
+  "/root/repo/src/clustering/AlignmentSymmetry.cpp" "src/CMakeFiles/mmseqs-framework.dir/clustering/AlignmentSymmetry.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/clustering/AlignmentSymmetry.cpp.o.d"
+  "/root/repo/src/clustering/Clustering.cpp" "src/CMakeFiles/mmseqs-framework.dir/clustering/Clustering.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/clustering/Clustering.cpp.o.d"
+  "/root/repo/src/clustering/ClusteringAlgorithms.cpp" "src/CMakeFiles/mmseqs-framework.dir/clustering/ClusteringAlgorithms.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/clustering/ClusteringAlgorithms.cpp.o.d"
+  "/root/repo/src/clustering/Main.cpp" "src/CMakeFiles/mmseqs-framework.dir/clustering/Main.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/clustering/Main.cpp.o.d"
+  "/root/repo/src/commons/A3MReader.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/A3MReader.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/A3MReader.cpp.o.d"
+  "/root/repo/src/commons/Application.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Application.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Application.cpp.o.d"
+  "/root/repo/src/commons/BaseMatrix.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/BaseMatrix.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/BaseMatrix.cpp.o.d"
+  "/root/repo/src/commons/Command.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Command.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Command.cpp.o.d"
+  "/root/repo/src/commons/CommandCaller.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/CommandCaller.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/CommandCaller.cpp.o.d"
+  "/root/repo/src/commons/DBConcat.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/DBConcat.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/DBConcat.cpp.o.d"
+  "/root/repo/src/commons/DBReader.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/DBReader.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/DBReader.cpp.o.d"
+  "/root/repo/src/commons/DBWriter.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/DBWriter.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/DBWriter.cpp.o.d"
+  "/root/repo/src/commons/Debug.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Debug.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Debug.cpp.o.d"
+  "/root/repo/src/commons/ExpressionParser.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/ExpressionParser.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/ExpressionParser.cpp.o.d"
+  "/root/repo/src/commons/FileUtil.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/FileUtil.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/FileUtil.cpp.o.d"
+  "/root/repo/src/commons/HeaderSummarizer.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/HeaderSummarizer.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/HeaderSummarizer.cpp.o.d"
+  "/root/repo/src/commons/KSeqWrapper.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/KSeqWrapper.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/KSeqWrapper.cpp.o.d"
+  "/root/repo/src/commons/LibraryReader.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/LibraryReader.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/LibraryReader.cpp.o.d"
+  "/root/repo/src/commons/MMseqsMPI.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/MMseqsMPI.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/MMseqsMPI.cpp.o.d"
+  "/root/repo/src/commons/MemoryMapped.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/MemoryMapped.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/MemoryMapped.cpp.o.d"
+  "/root/repo/src/commons/MemoryTracker.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/MemoryTracker.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/MemoryTracker.cpp.o.d"
+  "/root/repo/src/commons/MultiParam.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/MultiParam.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/MultiParam.cpp.o.d"
+  "/root/repo/src/commons/NucleotideMatrix.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/NucleotideMatrix.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/NucleotideMatrix.cpp.o.d"
+  "/root/repo/src/commons/Numa.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Numa.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Numa.cpp.o.d"
+  "/root/repo/src/commons/Orf.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Orf.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Orf.cpp.o.d"
+  "/root/repo/src/commons/Parameters.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Parameters.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Parameters.cpp.o.d"
+  "/root/repo/src/commons/ProfileStates.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/ProfileStates.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/ProfileStates.cpp.o.d"
+  "/root/repo/src/commons/Sequence.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Sequence.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Sequence.cpp.o.d"
+  "/root/repo/src/commons/SharedMemory.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/SharedMemory.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/SharedMemory.cpp.o.d"
+  "/root/repo/src/commons/SubstitutionMatrix.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/SubstitutionMatrix.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/SubstitutionMatrix.cpp.o.d"
+  "/root/repo/src/commons/UniprotKB.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/UniprotKB.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/UniprotKB.cpp.o.d"
+  "/root/repo/src/commons/Util.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/Util.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/Util.cpp.o.d"
+  "/root/repo/src/commons/tantan.cpp" "src/CMakeFiles/mmseqs-framework.dir/commons/tantan.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/commons/tantan.cpp.o.d"
+  "/root/repo/src/linclust/LinsearchIndexReader.cpp" "src/CMakeFiles/mmseqs-framework.dir/linclust/LinsearchIndexReader.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/linclust/LinsearchIndexReader.cpp.o.d"
+  "/root/repo/src/linclust/kmerindexdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/linclust/kmerindexdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/linclust/kmerindexdb.cpp.o.d"
+  "/root/repo/src/linclust/kmermatcher.cpp" "src/CMakeFiles/mmseqs-framework.dir/linclust/kmermatcher.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/linclust/kmermatcher.cpp.o.d"
+  "/root/repo/src/linclust/kmersearch.cpp" "src/CMakeFiles/mmseqs-framework.dir/linclust/kmersearch.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/linclust/kmersearch.cpp.o.d"
+  "/root/repo/src/multihit/Aggregation.cpp" "src/CMakeFiles/mmseqs-framework.dir/multihit/Aggregation.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/multihit/Aggregation.cpp.o.d"
+  "/root/repo/src/multihit/MultiHitDb.cpp" "src/CMakeFiles/mmseqs-framework.dir/multihit/MultiHitDb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/multihit/MultiHitDb.cpp.o.d"
+  "/root/repo/src/multihit/MultiHitSearch.cpp" "src/CMakeFiles/mmseqs-framework.dir/multihit/MultiHitSearch.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/multihit/MultiHitSearch.cpp.o.d"
+  "/root/repo/src/multihit/besthitperset.cpp" "src/CMakeFiles/mmseqs-framework.dir/multihit/besthitperset.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/multihit/besthitperset.cpp.o.d"
+  "/root/repo/src/multihit/combinepvalperset.cpp" "src/CMakeFiles/mmseqs-framework.dir/multihit/combinepvalperset.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/multihit/combinepvalperset.cpp.o.d"
+  "/root/repo/src/prefiltering/CacheFriendlyOperations.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/CacheFriendlyOperations.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/CacheFriendlyOperations.cpp.o.d"
+  "/root/repo/src/prefiltering/ExtendedSubstitutionMatrix.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/ExtendedSubstitutionMatrix.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/ExtendedSubstitutionMatrix.cpp.o.d"
+  "/root/repo/src/prefiltering/IndexBuilder.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/IndexBuilder.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/IndexBuilder.cpp.o.d"
+  "/root/repo/src/prefiltering/Indexer.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/Indexer.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/Indexer.cpp.o.d"
+  "/root/repo/src/prefiltering/KmerGenerator.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/KmerGenerator.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/KmerGenerator.cpp.o.d"
+  "/root/repo/src/prefiltering/Main.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/Main.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/Main.cpp.o.d"
+  "/root/repo/src/prefiltering/PrefilterServer.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilterServer.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilterServer.cpp.o.d"
+  "/root/repo/src/prefiltering/Prefiltering.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/Prefiltering.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/Prefiltering.cpp.o.d"
+  "/root/repo/src/prefiltering/PrefilteringIndexReader.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilteringIndexReader.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilteringIndexReader.cpp.o.d"
+  "/root/repo/src/prefiltering/QueryMatcher.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/QueryMatcher.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/QueryMatcher.cpp.o.d"
+  "/root/repo/src/prefiltering/ReducedMatrix.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/ReducedMatrix.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/ReducedMatrix.cpp.o.d"
+  "/root/repo/src/prefiltering/SequenceLookup.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/SequenceLookup.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/SequenceLookup.cpp.o.d"
+  "/root/repo/src/prefiltering/UngappedAlignment.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/UngappedAlignment.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/UngappedAlignment.cpp.o.d"
+  "/root/repo/src/prefiltering/ungappedprefilter.cpp" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/ungappedprefilter.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/prefiltering/ungappedprefilter.cpp.o.d"
+  "/root/repo/src/taxonomy/NcbiTaxonomy.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/NcbiTaxonomy.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/NcbiTaxonomy.cpp.o.d"
+  "/root/repo/src/taxonomy/addtaxonomy.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/addtaxonomy.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/addtaxonomy.cpp.o.d"
+  "/root/repo/src/taxonomy/aggregatetax.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/aggregatetax.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/aggregatetax.cpp.o.d"
+  "/root/repo/src/taxonomy/createbintaxonomy.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/createbintaxonomy.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/createbintaxonomy.cpp.o.d"
+  "/root/repo/src/taxonomy/createtaxdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/createtaxdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/createtaxdb.cpp.o.d"
+  "/root/repo/src/taxonomy/filtertaxdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxdb.cpp.o.d"
+  "/root/repo/src/taxonomy/filtertaxseqdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxseqdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxseqdb.cpp.o.d"
+  "/root/repo/src/taxonomy/lca.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/lca.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/lca.cpp.o.d"
+  "/root/repo/src/taxonomy/taxonomyreport.cpp" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/taxonomyreport.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/taxonomy/taxonomyreport.cpp.o.d"
+  "/root/repo/src/util/alignall.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/alignall.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/alignall.cpp.o.d"
+  "/root/repo/src/util/alignbykmer.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/alignbykmer.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/alignbykmer.cpp.o.d"
+  "/root/repo/src/util/apply.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/apply.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/apply.cpp.o.d"
+  "/root/repo/src/util/clusthash.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/clusthash.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/clusthash.cpp.o.d"
+  "/root/repo/src/util/compress.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/compress.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/compress.cpp.o.d"
+  "/root/repo/src/util/convert2fasta.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/convert2fasta.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/convert2fasta.cpp.o.d"
+  "/root/repo/src/util/convertalignments.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/convertalignments.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/convertalignments.cpp.o.d"
+  "/root/repo/src/util/convertca3m.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/convertca3m.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/convertca3m.cpp.o.d"
+  "/root/repo/src/util/convertkb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/convertkb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/convertkb.cpp.o.d"
+  "/root/repo/src/util/convertmsa.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/convertmsa.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/convertmsa.cpp.o.d"
+  "/root/repo/src/util/convertprofiledb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/convertprofiledb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/convertprofiledb.cpp.o.d"
+  "/root/repo/src/util/countkmer.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/countkmer.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/countkmer.cpp.o.d"
+  "/root/repo/src/util/cpmvrmlndb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/cpmvrmlndb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/cpmvrmlndb.cpp.o.d"
+  "/root/repo/src/util/createdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/createdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/createdb.cpp.o.d"
+  "/root/repo/src/util/createseqfiledb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/createseqfiledb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/createseqfiledb.cpp.o.d"
+  "/root/repo/src/util/createsubdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/createsubdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/createsubdb.cpp.o.d"
+  "/root/repo/src/util/createtsv.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/createtsv.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/createtsv.cpp.o.d"
+  "/root/repo/src/util/dbtype.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/dbtype.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/dbtype.cpp.o.d"
+  "/root/repo/src/util/diffseqdbs.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/diffseqdbs.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/diffseqdbs.cpp.o.d"
+  "/root/repo/src/util/diskspaceavail.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/diskspaceavail.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/diskspaceavail.cpp.o.d"
+  "/root/repo/src/util/expandaln.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/expandaln.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/expandaln.cpp.o.d"
+  "/root/repo/src/util/extractalignedregion.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/extractalignedregion.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/extractalignedregion.cpp.o.d"
+  "/root/repo/src/util/extractdomains.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/extractdomains.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/extractdomains.cpp.o.d"
+  "/root/repo/src/util/extractframes.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/extractframes.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/extractframes.cpp.o.d"
+  "/root/repo/src/util/extractorfs.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/extractorfs.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/extractorfs.cpp.o.d"
+  "/root/repo/src/util/filterdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/filterdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/filterdb.cpp.o.d"
+  "/root/repo/src/util/gff2db.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/gff2db.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/gff2db.cpp.o.d"
+  "/root/repo/src/util/indexdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/indexdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/indexdb.cpp.o.d"
+  "/root/repo/src/util/loadidx.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/loadidx.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/loadidx.cpp.o.d"
+  "/root/repo/src/util/maskbygff.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/maskbygff.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/maskbygff.cpp.o.d"
+  "/root/repo/src/util/masksequence.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/masksequence.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/masksequence.cpp.o.d"
+  "/root/repo/src/util/mergeclusters.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/mergeclusters.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/mergeclusters.cpp.o.d"
+  "/root/repo/src/util/mergedbs.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/mergedbs.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/mergedbs.cpp.o.d"
+  "/root/repo/src/util/mergeresultsbyset.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/mergeresultsbyset.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/mergeresultsbyset.cpp.o.d"
+  "/root/repo/src/util/msa2profile.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/msa2profile.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/msa2profile.cpp.o.d"
+  "/root/repo/src/util/msa2result.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/msa2result.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/msa2result.cpp.o.d"
+  "/root/repo/src/util/nrtotaxmapping.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/nrtotaxmapping.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/nrtotaxmapping.cpp.o.d"
+  "/root/repo/src/util/offsetalignment.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/offsetalignment.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/offsetalignment.cpp.o.d"
+  "/root/repo/src/util/orftocontig.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/orftocontig.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/orftocontig.cpp.o.d"
+  "/root/repo/src/util/prefixid.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/prefixid.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/prefixid.cpp.o.d"
+  "/root/repo/src/util/profile2cs.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/profile2cs.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/profile2cs.cpp.o.d"
+  "/root/repo/src/util/profile2pssm.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/profile2pssm.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/profile2pssm.cpp.o.d"
+  "/root/repo/src/util/profile2seq.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/profile2seq.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/profile2seq.cpp.o.d"
+  "/root/repo/src/util/proteinaln2nucl.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/proteinaln2nucl.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/proteinaln2nucl.cpp.o.d"
+  "/root/repo/src/util/renamedbkeys.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/renamedbkeys.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/renamedbkeys.cpp.o.d"
+  "/root/repo/src/util/result2dnamsa.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2dnamsa.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2dnamsa.cpp.o.d"
+  "/root/repo/src/util/result2flat.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2flat.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2flat.cpp.o.d"
+  "/root/repo/src/util/result2msa.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2msa.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2msa.cpp.o.d"
+  "/root/repo/src/util/result2pp.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2pp.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2pp.cpp.o.d"
+  "/root/repo/src/util/result2profile.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2profile.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2profile.cpp.o.d"
+  "/root/repo/src/util/result2rbh.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2rbh.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2rbh.cpp.o.d"
+  "/root/repo/src/util/result2repseq.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2repseq.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2repseq.cpp.o.d"
+  "/root/repo/src/util/result2stats.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/result2stats.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/result2stats.cpp.o.d"
+  "/root/repo/src/util/reverseseq.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/reverseseq.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/reverseseq.cpp.o.d"
+  "/root/repo/src/util/sortresult.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/sortresult.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/sortresult.cpp.o.d"
+  "/root/repo/src/util/splitdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/splitdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/splitdb.cpp.o.d"
+  "/root/repo/src/util/splitsequence.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/splitsequence.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/splitsequence.cpp.o.d"
+  "/root/repo/src/util/subtractdbs.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/subtractdbs.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/subtractdbs.cpp.o.d"
+  "/root/repo/src/util/summarizealis.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/summarizealis.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/summarizealis.cpp.o.d"
+  "/root/repo/src/util/summarizeheaders.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/summarizeheaders.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/summarizeheaders.cpp.o.d"
+  "/root/repo/src/util/summarizeresult.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/summarizeresult.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/summarizeresult.cpp.o.d"
+  "/root/repo/src/util/summarizetabs.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/summarizetabs.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/summarizetabs.cpp.o.d"
+  "/root/repo/src/util/swapresults.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/swapresults.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/swapresults.cpp.o.d"
+  "/root/repo/src/util/tar2db.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/tar2db.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/tar2db.cpp.o.d"
+  "/root/repo/src/util/touchdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/touchdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/touchdb.cpp.o.d"
+  "/root/repo/src/util/transitivealign.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/transitivealign.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/transitivealign.cpp.o.d"
+  "/root/repo/src/util/translateaa.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/translateaa.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/translateaa.cpp.o.d"
+  "/root/repo/src/util/translatenucs.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/translatenucs.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/translatenucs.cpp.o.d"
+  "/root/repo/src/util/tsv2db.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/tsv2db.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/tsv2db.cpp.o.d"
+  "/root/repo/src/util/unpackdb.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/unpackdb.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/unpackdb.cpp.o.d"
+  "/root/repo/src/util/versionstring.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/versionstring.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/versionstring.cpp.o.d"
+  "/root/repo/src/util/view.cpp" "src/CMakeFiles/mmseqs-framework.dir/util/view.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/util/view.cpp.o.d"
+  "/root/repo/src/workflow/Cluster.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Cluster.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Cluster.cpp.o.d"
+  "/root/repo/src/workflow/ClusterUpdate.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/ClusterUpdate.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/ClusterUpdate.cpp.o.d"
+  "/root/repo/src/workflow/CreateIndex.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/CreateIndex.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/CreateIndex.cpp.o.d"
+  "/root/repo/src/workflow/Databases.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Databases.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Databases.cpp.o.d"
+  "/root/repo/src/workflow/EasyCluster.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyCluster.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyCluster.cpp.o.d"
+  "/root/repo/src/workflow/EasyLinclust.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyLinclust.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyLinclust.cpp.o.d"
+  "/root/repo/src/workflow/EasyRbh.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyRbh.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyRbh.cpp.o.d"
+  "/root/repo/src/workflow/EasySearch.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasySearch.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasySearch.cpp.o.d"
+  "/root/repo/src/workflow/EasyTaxonomy.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyTaxonomy.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/EasyTaxonomy.cpp.o.d"
+  "/root/repo/src/workflow/Enrich.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Enrich.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Enrich.cpp.o.d"
+  "/root/repo/src/workflow/Linclust.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Linclust.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Linclust.cpp.o.d"
+  "/root/repo/src/workflow/Linsearch.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Linsearch.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Linsearch.cpp.o.d"
+  "/root/repo/src/workflow/Map.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Map.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Map.cpp.o.d"
+  "/root/repo/src/workflow/Rbh.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Rbh.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Rbh.cpp.o.d"
+  "/root/repo/src/workflow/Search.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Search.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Search.cpp.o.d"
+  "/root/repo/src/workflow/Taxonomy.cpp" "src/CMakeFiles/mmseqs-framework.dir/workflow/Taxonomy.cpp.o" "gcc" "src/CMakeFiles/mmseqs-framework.dir/workflow/Taxonomy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/lib/tinyexpr/CMakeFiles/tinyexpr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/zstd/build/cmake/lib/CMakeFiles/libzstd_static.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/microtar/CMakeFiles/microtar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
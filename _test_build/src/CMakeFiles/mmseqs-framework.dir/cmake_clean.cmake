@@ -0,0 +1,339 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmseqs-framework.dir/MMseqsBase.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/MMseqsBase.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/Alignment.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/Alignment.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/BandedNucleotideAligner.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/BandedNucleotideAligner.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/CompressedA3M.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/CompressedA3M.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/Main.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/Main.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/Matcher.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/Matcher.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/MsaFilter.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/MsaFilter.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/MultipleAlignment.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/MultipleAlignment.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/PSSMCalculator.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/PSSMCalculator.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/StripedSmithWaterman.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/StripedSmithWaterman.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/prefilteralign.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/prefilteralign.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/alignment/rescorediagonal.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/alignment/rescorediagonal.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/clustering/AlignmentSymmetry.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/clustering/AlignmentSymmetry.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/clustering/Clustering.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/clustering/Clustering.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/clustering/ClusteringAlgorithms.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/clustering/ClusteringAlgorithms.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/clustering/Main.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/clustering/Main.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/A3MReader.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/A3MReader.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Application.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Application.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/BaseMatrix.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/BaseMatrix.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Command.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Command.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/CommandCaller.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/CommandCaller.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/DBConcat.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/DBConcat.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/DBReader.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/DBReader.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/DBWriter.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/DBWriter.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Debug.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Debug.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/ExpressionParser.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/ExpressionParser.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/FileUtil.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/FileUtil.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/HeaderSummarizer.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/HeaderSummarizer.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/KSeqWrapper.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/KSeqWrapper.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/LibraryReader.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/LibraryReader.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/MMseqsMPI.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/MMseqsMPI.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/MemoryMapped.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/MemoryMapped.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/MemoryTracker.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/MemoryTracker.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/MultiParam.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/MultiParam.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/NucleotideMatrix.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/NucleotideMatrix.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Numa.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Numa.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Orf.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Orf.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Parameters.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Parameters.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/ProfileStates.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/ProfileStates.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Sequence.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Sequence.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/SharedMemory.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/SharedMemory.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/SubstitutionMatrix.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/SubstitutionMatrix.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/UniprotKB.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/UniprotKB.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/Util.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/Util.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/commons/tantan.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/commons/tantan.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/linclust/LinsearchIndexReader.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/linclust/LinsearchIndexReader.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/linclust/kmerindexdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/linclust/kmerindexdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/linclust/kmermatcher.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/linclust/kmermatcher.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/linclust/kmersearch.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/linclust/kmersearch.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/multihit/Aggregation.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/multihit/Aggregation.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/multihit/MultiHitDb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/multihit/MultiHitDb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/multihit/MultiHitSearch.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/multihit/MultiHitSearch.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/multihit/besthitperset.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/multihit/besthitperset.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/multihit/combinepvalperset.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/multihit/combinepvalperset.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/CacheFriendlyOperations.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/CacheFriendlyOperations.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/ExtendedSubstitutionMatrix.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/ExtendedSubstitutionMatrix.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/IndexBuilder.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/IndexBuilder.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/Indexer.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/Indexer.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/KmerGenerator.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/KmerGenerator.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/Main.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/Main.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilterServer.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilterServer.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/Prefiltering.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/Prefiltering.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilteringIndexReader.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/PrefilteringIndexReader.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/QueryMatcher.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/QueryMatcher.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/ReducedMatrix.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/ReducedMatrix.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/SequenceLookup.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/SequenceLookup.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/UngappedAlignment.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/UngappedAlignment.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/ungappedprefilter.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/prefiltering/ungappedprefilter.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/NcbiTaxonomy.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/NcbiTaxonomy.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/addtaxonomy.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/addtaxonomy.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/aggregatetax.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/aggregatetax.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/createbintaxonomy.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/createbintaxonomy.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/createtaxdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/createtaxdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxseqdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/filtertaxseqdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/lca.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/lca.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/taxonomyreport.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/taxonomy/taxonomyreport.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/alignall.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/alignall.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/alignbykmer.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/alignbykmer.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/apply.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/apply.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/clusthash.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/clusthash.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/compress.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/compress.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/convert2fasta.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/convert2fasta.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/convertalignments.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/convertalignments.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/convertca3m.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/convertca3m.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/convertkb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/convertkb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/convertmsa.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/convertmsa.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/convertprofiledb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/convertprofiledb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/countkmer.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/countkmer.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/cpmvrmlndb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/cpmvrmlndb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/createdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/createdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/createseqfiledb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/createseqfiledb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/createsubdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/createsubdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/createtsv.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/createtsv.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/dbtype.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/dbtype.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/diffseqdbs.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/diffseqdbs.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/diskspaceavail.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/diskspaceavail.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/expandaln.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/expandaln.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/extractalignedregion.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/extractalignedregion.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/extractdomains.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/extractdomains.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/extractframes.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/extractframes.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/extractorfs.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/extractorfs.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/filterdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/filterdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/gff2db.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/gff2db.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/indexdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/indexdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/loadidx.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/loadidx.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/maskbygff.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/maskbygff.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/masksequence.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/masksequence.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/mergeclusters.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/mergeclusters.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/mergedbs.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/mergedbs.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/mergeresultsbyset.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/mergeresultsbyset.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/msa2profile.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/msa2profile.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/msa2result.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/msa2result.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/nrtotaxmapping.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/nrtotaxmapping.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/offsetalignment.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/offsetalignment.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/orftocontig.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/orftocontig.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/prefixid.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/prefixid.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/profile2cs.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/profile2cs.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/profile2pssm.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/profile2pssm.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/profile2seq.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/profile2seq.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/proteinaln2nucl.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/proteinaln2nucl.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/renamedbkeys.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/renamedbkeys.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2dnamsa.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2dnamsa.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2flat.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2flat.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2msa.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2msa.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2pp.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2pp.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2profile.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2profile.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2rbh.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2rbh.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2repseq.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2repseq.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/result2stats.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/result2stats.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/reverseseq.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/reverseseq.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/sortresult.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/sortresult.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/splitdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/splitdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/splitsequence.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/splitsequence.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/subtractdbs.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/subtractdbs.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizealis.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizealis.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizeheaders.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizeheaders.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizeresult.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizeresult.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizetabs.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/summarizetabs.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/swapresults.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/swapresults.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/tar2db.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/tar2db.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/touchdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/touchdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/transitivealign.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/transitivealign.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/translateaa.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/translateaa.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/translatenucs.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/translatenucs.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/tsv2db.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/tsv2db.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/unpackdb.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/unpackdb.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/versionstring.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/versionstring.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/util/view.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/util/view.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Cluster.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Cluster.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/ClusterUpdate.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/ClusterUpdate.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/CreateIndex.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/CreateIndex.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Databases.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Databases.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyCluster.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyCluster.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyLinclust.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyLinclust.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyRbh.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyRbh.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasySearch.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasySearch.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyTaxonomy.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/EasyTaxonomy.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Enrich.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Enrich.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Linclust.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Linclust.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Linsearch.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Linsearch.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Map.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Map.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Rbh.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Rbh.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Search.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Search.cpp.o.d"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Taxonomy.cpp.o"
+  "CMakeFiles/mmseqs-framework.dir/workflow/Taxonomy.cpp.o.d"
+  "libmmseqs-framework.a"
+  "libmmseqs-framework.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mmseqs-framework.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
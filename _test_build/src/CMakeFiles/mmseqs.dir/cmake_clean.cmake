@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mmseqs.dir/mmseqs.cpp.o"
+  "CMakeFiles/mmseqs.dir/mmseqs.cpp.o.d"
+  "mmseqs"
+  "mmseqs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mmseqs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
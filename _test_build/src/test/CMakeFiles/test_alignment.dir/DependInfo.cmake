@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/test/TestAlignment.cpp" "src/test/CMakeFiles/test_alignment.dir/TestAlignment.cpp.o" "gcc" "src/test/CMakeFiles/test_alignment.dir/TestAlignment.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/src/CMakeFiles/mmseqs-framework.dir/DependInfo.cmake"
+  "/root/repo/_test_build/src/version/CMakeFiles/version.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/tinyexpr/CMakeFiles/tinyexpr.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/zstd/build/cmake/lib/CMakeFiles/libzstd_static.dir/DependInfo.cmake"
+  "/root/repo/_test_build/lib/microtar/CMakeFiles/microtar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_alignment.dir/TestAlignment.cpp.o"
+  "CMakeFiles/test_alignment.dir/TestAlignment.cpp.o.d"
+  "test_alignment"
+  "test_alignment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_alignment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_alignmentperformance.dir/TestAlignmentPerformance.cpp.o"
+  "CMakeFiles/test_alignmentperformance.dir/TestAlignmentPerformance.cpp.o.d"
+  "test_alignmentperformance"
+  "test_alignmentperformance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_alignmentperformance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
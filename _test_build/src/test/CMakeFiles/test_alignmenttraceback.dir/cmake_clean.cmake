@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_alignmenttraceback.dir/TestAlignmentTraceback.cpp.o"
+  "CMakeFiles/test_alignmenttraceback.dir/TestAlignmentTraceback.cpp.o.d"
+  "test_alignmenttraceback"
+  "test_alignmenttraceback.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_alignmenttraceback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
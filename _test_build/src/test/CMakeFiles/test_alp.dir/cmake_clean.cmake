@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_alp.dir/TestAlp.cpp.o"
+  "CMakeFiles/test_alp.dir/TestAlp.cpp.o.d"
+  "test_alp"
+  "test_alp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_alp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
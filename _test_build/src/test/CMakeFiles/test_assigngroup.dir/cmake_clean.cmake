@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_assigngroup.dir/TestAssignGroup.cpp.o"
+  "CMakeFiles/test_assigngroup.dir/TestAssignGroup.cpp.o.d"
+  "test_assigngroup"
+  "test_assigngroup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_assigngroup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
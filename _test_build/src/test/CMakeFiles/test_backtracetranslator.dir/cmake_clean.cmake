@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_backtracetranslator.dir/TestBacktraceTranslator.cpp.o"
+  "CMakeFiles/test_backtracetranslator.dir/TestBacktraceTranslator.cpp.o.d"
+  "test_backtracetranslator"
+  "test_backtracetranslator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_backtracetranslator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
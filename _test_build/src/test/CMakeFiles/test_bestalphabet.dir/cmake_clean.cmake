@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bestalphabet.dir/TestBestAlphabet.cpp.o"
+  "CMakeFiles/test_bestalphabet.dir/TestBestAlphabet.cpp.o.d"
+  "test_bestalphabet"
+  "test_bestalphabet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bestalphabet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_binaryalignment.dir/TestBinaryAlignment.cpp.o"
+  "CMakeFiles/test_binaryalignment.dir/TestBinaryAlignment.cpp.o.d"
+  "test_binaryalignment"
+  "test_binaryalignment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_binaryalignment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
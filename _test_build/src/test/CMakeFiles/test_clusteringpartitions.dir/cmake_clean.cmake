@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_clusteringpartitions.dir/TestClusteringPartitions.cpp.o"
+  "CMakeFiles/test_clusteringpartitions.dir/TestClusteringPartitions.cpp.o.d"
+  "test_clusteringpartitions"
+  "test_clusteringpartitions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_clusteringpartitions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
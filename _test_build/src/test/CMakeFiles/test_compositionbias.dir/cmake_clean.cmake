@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_compositionbias.dir/TestCompositionBias.cpp.o"
+  "CMakeFiles/test_compositionbias.dir/TestCompositionBias.cpp.o.d"
+  "test_compositionbias"
+  "test_compositionbias.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_compositionbias.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
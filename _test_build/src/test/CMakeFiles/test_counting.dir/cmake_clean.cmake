@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_counting.dir/TestCounting.cpp.o"
+  "CMakeFiles/test_counting.dir/TestCounting.cpp.o.d"
+  "test_counting"
+  "test_counting.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_counting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
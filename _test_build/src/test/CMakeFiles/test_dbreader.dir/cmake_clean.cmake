@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dbreader.dir/TestDBReader.cpp.o"
+  "CMakeFiles/test_dbreader.dir/TestDBReader.cpp.o.d"
+  "test_dbreader"
+  "test_dbreader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dbreader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
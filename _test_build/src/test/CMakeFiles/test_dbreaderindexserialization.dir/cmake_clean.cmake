@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dbreaderindexserialization.dir/TestDBReaderIndexSerialization.cpp.o"
+  "CMakeFiles/test_dbreaderindexserialization.dir/TestDBReaderIndexSerialization.cpp.o.d"
+  "test_dbreaderindexserialization"
+  "test_dbreaderindexserialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dbreaderindexserialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dbreaderzstd.dir/TestDBReaderZstd.cpp.o"
+  "CMakeFiles/test_dbreaderzstd.dir/TestDBReaderZstd.cpp.o.d"
+  "test_dbreaderzstd"
+  "test_dbreaderzstd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dbreaderzstd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_diagonalscoring.dir/TestDiagonalScoring.cpp.o"
+  "CMakeFiles/test_diagonalscoring.dir/TestDiagonalScoring.cpp.o.d"
+  "test_diagonalscoring"
+  "test_diagonalscoring.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_diagonalscoring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_diagonalscoringperformance.dir/TestDiagonalScoringPerformance.cpp.o"
+  "CMakeFiles/test_diagonalscoringperformance.dir/TestDiagonalScoringPerformance.cpp.o.d"
+  "test_diagonalscoringperformance"
+  "test_diagonalscoringperformance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_diagonalscoringperformance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_indextable.dir/TestIndexTable.cpp.o"
+  "CMakeFiles/test_indextable.dir/TestIndexTable.cpp.o.d"
+  "test_indextable"
+  "test_indextable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_indextable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
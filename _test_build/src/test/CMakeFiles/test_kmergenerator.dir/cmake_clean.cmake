@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kmergenerator.dir/TestKmerGenerator.cpp.o"
+  "CMakeFiles/test_kmergenerator.dir/TestKmerGenerator.cpp.o.d"
+  "test_kmergenerator"
+  "test_kmergenerator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_kmergenerator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
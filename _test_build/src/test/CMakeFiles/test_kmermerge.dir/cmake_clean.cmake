@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kmermerge.dir/TestKmerMerge.cpp.o"
+  "CMakeFiles/test_kmermerge.dir/TestKmerMerge.cpp.o.d"
+  "test_kmermerge"
+  "test_kmermerge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_kmermerge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kmernucl.dir/TestKmerNucl.cpp.o"
+  "CMakeFiles/test_kmernucl.dir/TestKmerNucl.cpp.o.d"
+  "test_kmernucl"
+  "test_kmernucl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_kmernucl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
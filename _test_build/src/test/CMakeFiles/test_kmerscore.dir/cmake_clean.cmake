@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kmerscore.dir/TestKmerScore.cpp.o"
+  "CMakeFiles/test_kmerscore.dir/TestKmerScore.cpp.o.d"
+  "test_kmerscore"
+  "test_kmerscore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_kmerscore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
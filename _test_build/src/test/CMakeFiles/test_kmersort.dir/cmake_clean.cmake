@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kmersort.dir/TestKmerSort.cpp.o"
+  "CMakeFiles/test_kmersort.dir/TestKmerSort.cpp.o.d"
+  "test_kmersort"
+  "test_kmersort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_kmersort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
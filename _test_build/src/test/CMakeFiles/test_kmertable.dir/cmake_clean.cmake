@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kmertable.dir/TestKmerTable.cpp.o"
+  "CMakeFiles/test_kmertable.dir/TestKmerTable.cpp.o.d"
+  "test_kmertable"
+  "test_kmertable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_kmertable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ksw2.dir/TestKsw2.cpp.o"
+  "CMakeFiles/test_ksw2.dir/TestKsw2.cpp.o.d"
+  "test_ksw2"
+  "test_ksw2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ksw2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_kwaymerge.dir/TestKwayMerge.cpp.o"
+  "CMakeFiles/test_kwaymerge.dir/TestKwayMerge.cpp.o.d"
+  "test_kwaymerge"
+  "test_kwaymerge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_kwaymerge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
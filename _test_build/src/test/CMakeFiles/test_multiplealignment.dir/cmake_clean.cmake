@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_multiplealignment.dir/TestMultipleAlignment.cpp.o"
+  "CMakeFiles/test_multiplealignment.dir/TestMultipleAlignment.cpp.o.d"
+  "test_multiplealignment"
+  "test_multiplealignment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_multiplealignment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_prefilterpaths.dir/TestPrefilterPaths.cpp.o"
+  "CMakeFiles/test_prefilterpaths.dir/TestPrefilterPaths.cpp.o.d"
+  "test_prefilterpaths"
+  "test_prefilterpaths.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_prefilterpaths.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_profilealignment.dir/TestProfileAlignment.cpp.o"
+  "CMakeFiles/test_profilealignment.dir/TestProfileAlignment.cpp.o.d"
+  "test_profilealignment"
+  "test_profilealignment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_profilealignment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
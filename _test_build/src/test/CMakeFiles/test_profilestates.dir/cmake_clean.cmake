@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_profilestates.dir/TestProfileStates.cpp.o"
+  "CMakeFiles/test_profilestates.dir/TestProfileStates.cpp.o.d"
+  "test_profilestates"
+  "test_profilestates.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_profilestates.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pssm.dir/TestPSSM.cpp.o"
+  "CMakeFiles/test_pssm.dir/TestPSSM.cpp.o.d"
+  "test_pssm"
+  "test_pssm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pssm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pssmprune.dir/TestPSSMPrune.cpp.o"
+  "CMakeFiles/test_pssmprune.dir/TestPSSMPrune.cpp.o.d"
+  "test_pssmprune"
+  "test_pssmprune.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pssmprune.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_reducematrix.dir/TestReduceMatrix.cpp.o"
+  "CMakeFiles/test_reducematrix.dir/TestReduceMatrix.cpp.o.d"
+  "test_reducematrix"
+  "test_reducematrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reducematrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
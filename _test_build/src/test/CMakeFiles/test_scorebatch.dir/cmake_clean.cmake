@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_scorebatch.dir/TestScoreBatch.cpp.o"
+  "CMakeFiles/test_scorebatch.dir/TestScoreBatch.cpp.o.d"
+  "test_scorebatch"
+  "test_scorebatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scorebatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
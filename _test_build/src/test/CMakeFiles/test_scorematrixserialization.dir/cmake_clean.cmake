@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_scorematrixserialization.dir/TestScoreMatrixSerialization.cpp.o"
+  "CMakeFiles/test_scorematrixserialization.dir/TestScoreMatrixSerialization.cpp.o.d"
+  "test_scorematrixserialization"
+  "test_scorematrixserialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scorematrixserialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sequenceindex.dir/TestSequenceIndex.cpp.o"
+  "CMakeFiles/test_sequenceindex.dir/TestSequenceIndex.cpp.o.d"
+  "test_sequenceindex"
+  "test_sequenceindex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sequenceindex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tantan.dir/TestTanTan.cpp.o"
+  "CMakeFiles/test_tantan.dir/TestTanTan.cpp.o.d"
+  "test_tantan"
+  "test_tantan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tantan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
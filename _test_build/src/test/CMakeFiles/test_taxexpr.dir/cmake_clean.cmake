@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_taxexpr.dir/TestTaxExpr.cpp.o"
+  "CMakeFiles/test_taxexpr.dir/TestTaxExpr.cpp.o.d"
+  "test_taxexpr"
+  "test_taxexpr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_taxexpr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
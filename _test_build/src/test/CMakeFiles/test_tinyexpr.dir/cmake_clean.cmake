@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tinyexpr.dir/TestTinyExpr.cpp.o"
+  "CMakeFiles/test_tinyexpr.dir/TestTinyExpr.cpp.o.d"
+  "test_tinyexpr"
+  "test_tinyexpr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tinyexpr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
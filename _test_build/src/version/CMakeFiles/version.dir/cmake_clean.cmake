@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/version.dir/Version.cpp.o"
+  "CMakeFiles/version.dir/Version.cpp.o.d"
+  "libversion.a"
+  "libversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
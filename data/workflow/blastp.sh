@@ -27,6 +27,15 @@ ALN_RES_MERGE="$TMP_PATH/aln_0"
 while [ "$STEP" -lt "$STEPS" ]; do
     SENS_PARAM=SENSE_${STEP}
     eval SENS="\$$SENS_PARAM"
+    # align the prefilter hits in memory, there is no prefilter result DB
+    if [ -n "$FUSED_ALIGN_PAR" ]; then
+        if notExists "$3.dbtype"; then
+            # shellcheck disable=SC2086
+            $RUNNER "$MMSEQS" prefilteralign "$INPUT" "$TARGET" "$3" $FUSED_ALIGN_PAR \
+                || fail "Prefilteralign died"
+        fi
+        break
+    fi
     # call prefilter module
     if notExists "$TMP_PATH/pref_$STEP.dbtype"; then
         # shellcheck disable=SC2086
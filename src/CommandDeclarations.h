@@ -21,6 +21,7 @@ extern int convertca3m(int argc, const char **argv, const Command& command);
 extern int convertkb(int argc, const char **argv, const Command& command);
 extern int convertmsa(int argc, const char **argv, const Command& command);
 extern int convertprofiledb(int argc, const char **argv, const Command& command);
+extern int createclustgraph(int argc, const char **argv, const Command& command);
 extern int createdb(int argc, const char **argv, const Command& command);
 extern int createindex(int argc, const char **argv, const Command& command);
 extern int createlinindex(int argc, const char **argv, const Command& command);
@@ -76,7 +77,11 @@ extern int nrtotaxmapping(int argc, const char **argv, const Command& command);
 extern int offsetalignment(int argc, const char **argv, const Command& command);
 extern int orftocontig(int argc, const char **argv, const Command& command);
 extern int touchdb(int argc, const char **argv, const Command& command);
+extern int loadidx(int argc, const char **argv, const Command& command);
+extern int unloadidx(int argc, const char **argv, const Command& command);
 extern int prefilter(int argc, const char **argv, const Command& command);
+extern int prefilteralign(int argc, const char **argv, const Command& command);
+extern int prefilterserver(int argc, const char **argv, const Command& command);
 extern int prefixid(int argc, const char **argv, const Command& command);
 extern int profile2cs(int argc, const char **argv, const Command& command);
 extern int profile2pssm(int argc, const char **argv, const Command& command);
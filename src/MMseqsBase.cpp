@@ -328,7 +328,7 @@ std::vector<Command> baseCommands = {
                 "<i:queryDb> <i:targetDb> <i:alignmentDB> <o:alignmentFile>",
                 CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::NEED_HEADER, &DbValidator::sequenceDb },
                                           {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::NEED_HEADER, &DbValidator::sequenceDb },
-                                          {"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentDb },
+                                          {"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentOrBinaryDb },
                                           {"alignmentFile", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::flatfile}}},
         {"createtsv",            createtsv,            &par.createtsv,            COMMAND_FORMAT_CONVERSION,
                 "Convert result DB to tab-separated flat file",
@@ -551,6 +551,16 @@ std::vector<Command> baseCommands = {
                                                            {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                                            {"prefilterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::prefilterDb }}},
 
+        {"prefilterserver",      prefilterserver,      &par.onlyverbosity,        COMMAND_PREFILTER | COMMAND_EXPERT,
+                "Keep a target index in memory and serve prefilter calls over a UNIX socket",
+                "# Load the index once, it is stopped with SIGINT or SIGTERM\n"
+                "mmseqs prefilterserver targetDB prefilter.sock &\n\n"
+                "# Every prefilter call with --prefilter-server is run by the server\n"
+                "mmseqs prefilter queryDB targetDB prefilterDB --prefilter-server prefilter.sock\n",
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:targetDB> <i:socketPath>",
+                CITATION_MMSEQS2, {{"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                                          {"socketPath", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::flatfile }}},
         {"ungappedprefilter",    ungappedprefilter,    &par.ungappedprefilter,    COMMAND_PREFILTER,
                 "Optimal diagonal score search",
                 NULL,
@@ -584,6 +594,15 @@ std::vector<Command> baseCommands = {
 
 
 
+        {"prefilteralign",       prefilteralign,       &par.prefilteralign,       COMMAND_ALIGNMENT | COMMAND_EXPERT,
+                "Prefilter and gapped local alignment without an intermediate prefilter DB",
+                "# The prefilter hits of each query are aligned right away, only alignments are written\n"
+                "mmseqs prefilteralign queryDB targetDB alignmentDB -s 7.5\n",
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:queryDB> <i:targetDB> <o:alignmentDB>",
+                CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                                                           {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                                                           {"alignmentDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::alignmentDb }}},
         {"align",                align,                &par.align,                COMMAND_ALIGNMENT,
                 "Optimal gapped local alignment",
                 NULL,
@@ -637,8 +656,18 @@ std::vector<Command> baseCommands = {
                 "Martin Steinegger <martin.steinegger@snu.ac.kr> & Lars von den Driesch & Maria Hauser",
                 "<i:sequenceDB> <i:resultDB> <o:clusterDB>",
                 CITATION_MMSEQS2|CITATION_MMSEQS1,{{"sequenceDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
-                                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultDb },
+                                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultOrClusterGraphDb },
                                                           {"clusterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::clusterDb }}},
+        {"createclustgraph",     createclustgraph,     &par.createclustgraph,     COMMAND_CLUSTER | COMMAND_EXPERT,
+                "Store a symmetric alignment graph that clust maps instead of parsing the result DB",
+                "# The graph is read once, later clust runs on the same sequenceDB map it directly\n"
+                "mmseqs createclustgraph sequenceDB alignmentDB graphDB\n"
+                "mmseqs clust sequenceDB graphDB clusterDB\n",
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:sequenceDB> <i:resultDB> <o:graphDB>",
+                CITATION_MMSEQS2, {{"sequenceDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultOrBinaryDb },
+                                                          {"graphDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::clusterGraphDb }}},
         {"clusthash",            clusthash,            &par.clusthash,            COMMAND_CLUSTER,
                 "Hash-based clustering of equal length sequences",
                 NULL,
@@ -711,6 +740,22 @@ std::vector<Command> baseCommands = {
                 "Martin Steinegger <martin.steinegger@snu.ac.kr> ",
                 "<i:DB>",
                 CITATION_MMSEQS2, {{"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::allDb }}},
+        {"loadidx",              loadidx,              &par.onlyverbosity,        COMMAND_STORAGE,
+                "Load the index of a DB into shared memory for all processes on this node",
+                "# Load the index once, later searches against targetDB map it instead of reading it\n"
+                "mmseqs loadidx targetDB\n"
+                "mmseqs search queryDB targetDB.idx resultDB tmp\n\n"
+                "# Free the shared memory again\n"
+                "mmseqs unloadidx targetDB\n",
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:DB>",
+                CITATION_MMSEQS2, {{"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::allDb }}},
+        {"unloadidx",            unloadidx,            &par.onlyverbosity,        COMMAND_STORAGE,
+                "Remove the index of a DB from shared memory",
+                NULL,
+                "Martin Steinegger <martin.steinegger@snu.ac.kr>",
+                "<i:DB>",
+                CITATION_MMSEQS2, {{"DB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::allDb }}},
 
 
         {"createsubdb",          createsubdb,          &par.createsubdb,          COMMAND_SET,
@@ -900,7 +945,7 @@ std::vector<Command> baseCommands = {
                 "<i:queryDB> <i:targetDB> <i:resultDB> <o:sequenceDB>",
                 CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                           {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
-                                          {"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentDb },
+                                          {"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentOrBinaryDb },
                                           {"sequenceDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::sequenceDb}}},
 
 
@@ -999,7 +1044,7 @@ std::vector<Command> baseCommands = {
                 NULL,
                 "Martin Steinegger <martin.steinegger@snu.ac.kr>",
                 "<i:alignmentDB> <o:summerizedDB>",
-                CITATION_MMSEQS2|CITATION_UNICLUST, {{"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentDb },
+                CITATION_MMSEQS2|CITATION_UNICLUST, {{"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentOrBinaryDb },
                                           {"summerizedDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::genericDb }}},
         {"summarizeresult",      summarizeresult,      &par.summarizeresult,      COMMAND_RESULT,
                 "Extract annotations from alignment DB",
@@ -1018,7 +1063,7 @@ std::vector<Command> baseCommands = {
                 "<i:queryDB> <i:targetDB> <i:resultDB> <o:profileDB>",
                 CITATION_MMSEQS2,{{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                                            {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
-                                                           {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultDb },
+                                                           {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultOrBinaryDb },
                                                            {"profileDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::profileDb }}},
         {"msa2result",          msa2result,            &par.msa2profile,          COMMAND_PROFILE | COMMAND_EXPERT,
                 "Convert a MSA DB to a profile DB",
@@ -1110,8 +1155,8 @@ std::vector<Command> baseCommands = {
                 "<i:queryDB> <i:targetDB> <i:resultDB> <i:resultDB|ca3mDB> <o:alignmentDB>",
                 CITATION_MMSEQS2, {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
                                           {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
-                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultDb },
-                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultDb },
+                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultOrBinaryDb },
+                                          {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultOrBinaryDb },
                                           {"alignmentDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::alignmentDb }}},
         {"expand2profile",      expand2profile,        &par.expand2profile,       COMMAND_PROFILE_PROFILE,
                 "Expand an alignment result based on another and create a profile",
@@ -12,6 +12,8 @@
 #include "Parameters.h"
 #include "FastSort.h"
 #include "Sequence.h"
+#include "Numa.h"
+#include "Timer.h"
 
 #ifdef OPENMP
 #include <omp.h>
@@ -23,8 +25,8 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
         covThr(par.covThr), canCovThr(par.covThr), covMode(par.covMode), seqIdMode(par.seqIdMode), evalThr(par.evalThr), seqIdThr(par.seqIdThr),
         alnLenThr(par.alnLenThr), includeIdentity(par.includeIdentity), addBacktrace(par.addBacktrace), realign(par.realign), scoreBias(par.scoreBias), realignScoreBias(par.realignScoreBias), realignMaxSeqs(par.realignMaxSeqs),
         threads(static_cast<unsigned int>(par.threads)), compressed(par.compressed), outDB(outDB), outDBIndex(outDBIndex),
-        maxSeqLen(par.maxSeqLen), compBiasCorrection(par.compBiasCorrection), altAlignment(par.altAlignment), alignmentOutputMode(par.alignmentOutputMode),
-        maxAccept(static_cast<unsigned int>(par.maxAccept)), maxReject(static_cast<unsigned int>(par.maxRejected)), wrappedScoring(par.wrappedScoring),
+        maxSeqLen(par.maxSeqLen), compBiasCorrection(par.compBiasCorrection), altAlignment(par.altAlignment), alignmentOutputMode(par.alignmentOutputMode), binaryAlignment(par.binaryAlignment),
+        maxAccept(static_cast<unsigned int>(par.maxAccept)), maxReject(static_cast<unsigned int>(par.maxRejected)), wrappedScoring(par.wrappedScoring), numa(par.numa),
         lcaAlign(lcaAlign), qdbr(NULL), qDbrIdx(NULL), tdbr(NULL), tDbrIdx(NULL) {
     unsigned int alignmentMode = par.alignmentMode;
     if (alignmentMode == Parameters::ALIGNMENT_MODE_UNGAPPED) {
@@ -56,7 +58,14 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
     }
 
     bool touch = (par.preloadMode != Parameters::PRELOAD_MODE_MMAP);
+    // every thread reads random targets, spread them over all nodes instead of the node of the loading thread
+    if (numa) {
+        Numa::setInterleavePolicy();
+    }
     tDbrIdx = new IndexReader(targetSeqDB, par.threads, IndexReader::SEQUENCES, (touch) ? (IndexReader::PRELOAD_INDEX | IndexReader::PRELOAD_DATA) : 0);
+    if (numa) {
+        Numa::setDefaultPolicy();
+    }
     tdbr = tDbrIdx->sequenceReader;
     targetSeqType = tdbr->getDbtype();
     sameQTDB = (targetSeqDB.compare(querySeqDB) == 0);
@@ -140,9 +149,14 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
     Debug(Debug::INFO) << "Query database size: "  << qdbr->getSize() << " type: " << Parameters::getDbTypeName(querySeqType) << "\n";
     Debug(Debug::INFO) << "Target database size: " << tdbr->getSize() << " type: " << Parameters::getDbTypeName(targetSeqType) << "\n";
 
-    prefdbr = new DBReader<unsigned int>(prefDB.c_str(), prefDBIndex.c_str(), threads, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
-    prefdbr->open(DBReader<unsigned int>::LINEAR_ACCCESS);
-    reversePrefilterResult = Parameters::isEqualDbtype(prefdbr->getDbtype(), Parameters::DBTYPE_PREFILTER_REV_RES);
+    // a fused prefilter hands its hits over in memory
+    prefdbr = NULL;
+    reversePrefilterResult = false;
+    if (prefDB.empty() == false) {
+        prefdbr = new DBReader<unsigned int>(prefDB.c_str(), prefDBIndex.c_str(), threads, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+        prefdbr->open(DBReader<unsigned int>::LINEAR_ACCCESS);
+        reversePrefilterResult = Parameters::isEqualDbtype(prefdbr->getDbtype(), Parameters::DBTYPE_PREFILTER_REV_RES);
+    }
 
     if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
         m = new NucleotideMatrix(par.scoringMatrixFile.nucleotides, 1.0, scoreBias);
@@ -169,6 +183,13 @@ Alignment::Alignment(const std::string &querySeqDB, const std::string &targetSeq
             realign_m = new SubstitutionMatrix(par.scoringMatrixFile.aminoacids, 2.0, scoreBias + realignScoreBias);
         }
     }
+
+    evaluer = new EvalueComputation(tdbr->getAminoAcidDBSize(), m, gapOpen, gapExtend);
+}
+
+size_t Alignment::getMaxMatcherSeqLen() {
+    return Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)
+           ? maxSeqLen : std::max(tdbr->getMaxSeqLen(), qdbr->getMaxSeqLen());
 }
 
 unsigned int Alignment::initSWMode(unsigned int alignmentMode, float covThr, float seqIdThr) {
@@ -198,6 +219,7 @@ unsigned int Alignment::initSWMode(unsigned int alignmentMode, float covThr, flo
 }
 
 Alignment::~Alignment() {
+    delete evaluer;
     if (realign_m != NULL) {
         delete realign_m;
     }
@@ -219,8 +241,10 @@ Alignment::~Alignment() {
         }
     }
 
-    prefdbr->close();
-    delete prefdbr;
+    if (prefdbr != NULL) {
+        prefdbr->close();
+        delete prefdbr;
+    }
 }
 
 void Alignment::run(const unsigned int mpiRank, const unsigned int mpiNumProc) {
@@ -252,12 +276,40 @@ void Alignment::run() {
     run(outDB, outDBIndex, 0, prefdbr->getSize(), false);
 }
 
-void Alignment::run(const std::string &outDB, const std::string &outDBIndex, const size_t dbFrom, const size_t dbSize, bool merge) {
-    int dbtype = Parameters::DBTYPE_ALIGNMENT_RES;
-    if(alignmentOutputMode == Parameters::ALIGNMENT_OUTPUT_CLUSTER){
-        dbtype =  Parameters::DBTYPE_CLUSTER_RES;
+int Alignment::getOutputDbtype() {
+    if (alignmentOutputMode == Parameters::ALIGNMENT_OUTPUT_CLUSTER) {
+        return Parameters::DBTYPE_CLUSTER_RES;
+    }
+    if (binaryAlignment) {
+        return Parameters::DBTYPE_BINARY_ALIGNMENT_RES;
+    }
+    return Parameters::DBTYPE_ALIGNMENT_RES;
+}
+
+void Alignment::printStatistics(size_t alignmentsNum, size_t totalPassedNum, size_t querySize, const RejectedHits &rejectedHits,
+                                const SmithWaterman::PassCounts &passCounts) {
+    Debug(Debug::INFO) << alignmentsNum << " alignments calculated\n";
+    Debug(Debug::INFO) << "Rejected hits by stage: " << rejectedHits.length << " length, "
+                       << rejectedHits.scoreBound << " score bound, " << rejectedHits.evalue << " e-value, "
+                       << rejectedHits.coverage << " coverage, " << rejectedHits.seqId << " sequence identity or alignment length\n";
+    Debug(Debug::INFO) << "Alignment passes: " << passCounts.byteScore << " 8-bit score, " << passCounts.wordScore << " 16-bit score, "
+                       << passCounts.saturatedScore << " 8-bit and 16-bit score, " << passCounts.identity << " identity, "
+                       << passCounts.startPos << " start position, " << passCounts.traceback << " traceback\n";
+    Debug(Debug::INFO) << totalPassedNum << " sequence pairs passed the thresholds";
+    if (alignmentsNum > 0) {
+        Debug(Debug::INFO) << " (" << ((float) totalPassedNum / (float) alignmentsNum) << " of overall calculated)";
     }
-    DBWriter dbw(outDB.c_str(), outDBIndex.c_str(), threads, compressed, dbtype);
+    Debug(Debug::INFO) << "\n";
+    if (querySize > 0) {
+        size_t hits = totalPassedNum / querySize;
+        size_t hits_rest = totalPassedNum % querySize;
+        float hits_f = ((float) hits) + ((float) hits_rest) / (float) querySize;
+        Debug(Debug::INFO) << hits_f << " hits per query sequence\n";
+    }
+}
+
+void Alignment::run(const std::string &outDB, const std::string &outDBIndex, const size_t dbFrom, const size_t dbSize, bool merge) {
+    DBWriter dbw(outDB.c_str(), outDBIndex.c_str(), threads, compressed, getOutputDbtype());
     dbw.open();
 
     // handle no alignment case early, below would divide by 0 otherwise
@@ -266,8 +318,6 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
         return;
     }
 
-    EvalueComputation evaluer(tdbr->getAminoAcidDBSize(), this->m, gapOpen, gapExtend);
-
     size_t totalMemory = Util::getTotalSystemMemory();
     size_t flushSize = 1000000;
     if (totalMemory > prefdbr->getTotalDataSize()) {
@@ -277,275 +327,428 @@ void Alignment::run(const std::string &outDB, const std::string &outDBIndex, con
 
     size_t alignmentsNum = 0;
     size_t totalPassedNum = 0;
+    RejectedHits rejectedHits;
+    SmithWaterman::PassCounts passCounts;
+    std::vector<size_t> queriesPerNode(numa ? Numa::getNodeCount() : 1, 0);
+    Timer timer;
+    // threads take blocks of queries, the same chunks as the OpenMP schedule(dynamic, 5) handed out per query
+    const size_t queriesPerBlock = 5;
     for (size_t i = 0; i < iterations; i++) {
         size_t start = dbFrom + (i * flushSize);
         size_t bucketSize = std::min(dbSize - (i * flushSize), flushSize);
         Debug::Progress progress(bucketSize);
 
-#pragma omp parallel num_threads(threads)
+        // with NUMA placement every node works on its own contiguous part of the queries first
+        NumaWorkQueue queue(start, start + bucketSize, queriesPerBlock, threads);
+
+#pragma omp parallel num_threads(threads) reduction(+: alignmentsNum, totalPassedNum)
         {
             unsigned int thread_idx = 0;
 #ifdef OPENMP
             thread_idx = static_cast<unsigned int>(omp_get_thread_num());
 #endif
+            int node = 0;
+            if (numa) {
+                node = Numa::pinThread(thread_idx, threads);
+            }
+            size_t nodeQueries = 0;
             std::string alnResultsOutString;
             alnResultsOutString.reserve(1024*1024);
-            char buffer[1024 + 32768*4];
-            Sequence qSeq(maxSeqLen, querySeqType, m, 0, false, compBiasCorrection);
-            Sequence dbSeq(maxSeqLen, targetSeqType, m, 0, false, compBiasCorrection);
-
-
-            const size_t maxMatcherSeqLen = Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)
-                                            ? maxSeqLen : std::max(tdbr->getMaxSeqLen(), qdbr->getMaxSeqLen());
-
-            std::vector<Matcher::result_t> swResults;
-            swResults.reserve(300);
-            Matcher matcher(querySeqType, maxMatcherSeqLen, m, &evaluer, compBiasCorrection, gapOpen, gapExtend, zdrop);
-
-            std::vector<Matcher::result_t> swRealignResults;
-            Matcher *realigner = NULL;
-            if (realign == true) {
-                swRealignResults.reserve(300);
-                realigner = &matcher;
-                if (realign_m != NULL) {
-                    realigner = new Matcher(querySeqType, maxMatcherSeqLen, realign_m, &evaluer, compBiasCorrection, gapOpen, gapExtend, zdrop);
+            QueryAligner *aligner = new QueryAligner(*this, thread_idx);
+
+            std::vector<size_t> targetIds;
+            auto alignBlock = [&](size_t blockStart, size_t blockEnd) {
+                // the targets of a block are read ahead in file order instead of one random read per hit
+                targetIds.clear();
+                for (size_t id = blockStart; id < blockEnd; id++) {
+                    char *data = prefdbr->getData(id, thread_idx);
+                    while (*data != '\0') {
+                        size_t targetId = tdbr->getId(Util::fast_atoi<unsigned int>(data));
+                        if (targetId != UINT_MAX) {
+                            targetIds.push_back(targetId);
+                        }
+                        data = Util::skipLine(data);
+                    }
+                }
+                tdbr->prefetchData(targetIds);
+
+                for (size_t id = blockStart; id < blockEnd; id++) {
+                    progress.updateProgress();
+                    nodeQueries++;
+
+                    // get the prefiltering list
+                    char *data = prefdbr->getData(id, thread_idx);
+                    unsigned int queryDbKey = prefdbr->getDbKey(id);
+                    aligner->align(queryDbKey, data, NULL, 0, alnResultsOutString);
+                    dbw.writeData(alnResultsOutString.c_str(), alnResultsOutString.length(), queryDbKey, thread_idx);
+                    alnResultsOutString.clear();
                 }
+            };
+            if (numa) {
+                size_t blockStart, blockEnd;
+                while (queue.next(node, blockStart, blockEnd)) {
+                    alignBlock(blockStart, blockEnd);
+                }
+            } else {
+#pragma omp for schedule(dynamic, 1)
+                for (size_t blockStart = start; blockStart < start + bucketSize; blockStart += queriesPerBlock) {
+                    alignBlock(blockStart, std::min(blockStart + queriesPerBlock, start + bucketSize));
+                }
+            }
+            __sync_fetch_and_add(&(queriesPerNode[node]), nodeQueries);
+            alignmentsNum += aligner->alignmentsNum;
+            totalPassedNum += aligner->passedNum;
+#pragma omp critical(rejected_hits)
+            {
+                rejectedHits.add(aligner->rejectedHits);
+                aligner->addPassCounts(passCounts);
             }
+            delete aligner;
+            if (numa) {
+                Numa::unpinThread();
+            }
+            // only remap if we have more than one iteration and we are not at the last iteration
+            if (i != (iterations - 1)) {
+#pragma omp barrier
+                if (thread_idx == 0) {
+                    prefdbr->remapData();
+                }
+#pragma omp barrier
+            }
+        }
+    }
+    if (numa) {
+        Numa::printThroughput(queriesPerNode, timer.getTimediff(), "queries");
+    }
+    dbw.close(merge);
 
-            std::string queryToWrap;
-            queryToWrap.reserve(maxSeqLen * 2);
-
-            const char* words[10];
-
-#pragma omp for schedule(dynamic, 5) reduction(+: alignmentsNum, totalPassedNum)
-            for (size_t id = start; id < (start + bucketSize); id++) {
-                progress.updateProgress();
-
-                // get the prefiltering list
-                char *data, *origData;
-                data = origData = prefdbr->getData(id, thread_idx);
-                unsigned int queryDbKey = prefdbr->getDbKey(id);
-                size_t origQueryLen = 0;
-                // only load query data if data != \0
-                if (*data != '\0') {
-                    size_t qId = qdbr->getId(queryDbKey);
-                    char *querySeqData = qdbr->getData(qId, thread_idx);
-                    if (querySeqData == NULL) {
-                        Debug(Debug::ERROR) << "Query sequence " << queryDbKey
-                                            << " is required in the prefiltering, but is not contained in the query sequence database.\nPlease check your database.\n";
-                        EXIT(EXIT_FAILURE);
-                    }
-                    size_t queryLen = qdbr->getSeqLen(qId);
-                    origQueryLen = queryLen;
-                    if (wrappedScoring) {
-                        queryToWrap = std::string(querySeqData, queryLen);
-                        queryToWrap = queryToWrap + queryToWrap;
-                        querySeqData = (char*)(queryToWrap).c_str();
-                        queryLen = origQueryLen*2;
-                    }
+    printStatistics(alignmentsNum, totalPassedNum, dbSize, rejectedHits, passCounts);
+}
 
-                    qSeq.mapSequence(qId, queryDbKey, querySeqData, queryLen);
-                    matcher.initQuery(&qSeq);
-                }
+Alignment::QueryAligner::QueryAligner(Alignment &aln, unsigned int thread_idx) :
+        alignmentsNum(0), passedNum(0), aln(aln), thread_idx(thread_idx), queryCount(0), screenedHits(0), failedHits(0),
+        qSeq(aln.maxSeqLen, aln.querySeqType, aln.m, 0, false, aln.compBiasCorrection),
+        dbSeq(aln.maxSeqLen, aln.targetSeqType, aln.m, 0, false, aln.compBiasCorrection),
+        matcher(aln.querySeqType, aln.getMaxMatcherSeqLen(), aln.m, aln.evaluer, aln.compBiasCorrection, aln.gapOpen, aln.gapExtend, aln.zdrop),
+        realigner(NULL) {
+    swResults.reserve(300);
+    if (aln.realign == true) {
+        swRealignResults.reserve(300);
+        realigner = &matcher;
+        if (aln.realign_m != NULL) {
+            realigner = new Matcher(aln.querySeqType, aln.getMaxMatcherSeqLen(), aln.realign_m, aln.evaluer, aln.compBiasCorrection, aln.gapOpen, aln.gapExtend, aln.zdrop);
+        }
+    }
+    queryToWrap.reserve(aln.maxSeqLen * 2);
+}
 
-                // parse the prefiltering list and calculate a Smith-Waterman alignment for each sequence in the list
-                size_t passedNum = 0;
-                unsigned int rejected = 0;
-                while (*data != '\0' && passedNum < maxAccept && rejected < maxReject) {
-                    Util::parseKey(data, buffer);
-                    const unsigned int dbKey = (unsigned int) strtoul(buffer, NULL, 10);
-                    size_t elements = Util::getWordsOfLine(data, words, 10);
-
-                    short diagonal = 0;
-                    bool isReverse = false;
-                    // Prefilter result (need to make this better)
-                    if (elements == 3) {
-                        hit_t hit = QueryMatcher::parsePrefilterHit(data);
-                        isReverse = reversePrefilterResult && (hit.prefScore < 0);
-                        diagonal = static_cast<short>(hit.diagonal);
-                    }
-                    data = Util::skipLine(data);
+Alignment::QueryAligner::~QueryAligner() {
+    if (realigner != NULL && realigner != &matcher) {
+        delete realigner;
+    }
+}
 
-                    size_t dbId = tdbr->getId(dbKey);
-                    char *dbSeqData = tdbr->getData(dbId, thread_idx);
-                    if (dbSeqData == NULL) {
-                        Debug(Debug::ERROR) << "Sequence " << dbKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
-                        EXIT(EXIT_FAILURE);
-                    }
-                    dbSeq.mapSequence(dbId, dbKey, dbSeqData, tdbr->getSeqLen(dbId));
+bool Alignment::QueryAligner::nextHit(char *&data, const hit_t *hits, size_t hitCount, size_t &hitIdx,
+                                      unsigned int &dbKey, short &diagonal, bool &isReverse, int &prefScore) {
+    diagonal = 0;
+    isReverse = false;
+    prefScore = 0;
+    if (data != NULL) {
+        if (*data == '\0') {
+            return false;
+        }
+        Util::parseKey(data, buffer);
+        dbKey = (unsigned int) strtoul(buffer, NULL, 10);
+        size_t elements = Util::getWordsOfLine(data, words, 10);
+        // Prefilter result (need to make this better)
+        if (elements == 3) {
+            hit_t hit = QueryMatcher::parsePrefilterHit(data);
+            isReverse = aln.reversePrefilterResult && (hit.prefScore < 0);
+            diagonal = static_cast<short>(hit.diagonal);
+            prefScore = abs(hit.prefScore);
+        }
+        data = Util::skipLine(data);
+        return true;
+    }
+    if (hitIdx >= hitCount) {
+        return false;
+    }
+    const hit_t &hit = hits[hitIdx++];
+    dbKey = hit.seqId;
+    isReverse = aln.reversePrefilterResult && (hit.prefScore < 0);
+    diagonal = static_cast<short>(hit.diagonal);
+    prefScore = abs(hit.prefScore);
+    return true;
+}
 
-                    // check if the sequences could pass the coverage threshold
-                    if (Util::canBeCovered(canCovThr, covMode, static_cast<float>(origQueryLen), static_cast<float>(dbSeq.L)) == false) {
-                        rejected++;
-                        continue;
-                    }
+void Alignment::QueryAligner::addPassCounts(SmithWaterman::PassCounts &counts) const {
+    matcher.addPassCounts(counts);
+    if (realigner != NULL && realigner != &matcher) {
+        realigner->addPassCounts(counts);
+    }
+}
 
-                    const bool isIdentity = (queryDbKey == dbKey && (includeIdentity || sameQTDB)) ? true : false;
+size_t Alignment::QueryAligner::nextHits(char *&data, const hit_t *hits, size_t hitCount, size_t &hitIdx,
+                                         unsigned int queryDbKey, size_t origQueryLen, size_t windowSize, bool checkEvalue) {
+    pending.clear();
+    pendingResidues.clear();
+    checkHits.clear();
+    checkLengths.clear();
+    PendingHit hit;
+    while (pending.size() < windowSize && nextHit(data, hits, hitCount, hitIdx, hit.dbKey, hit.diagonal, hit.isReverse, hit.prefScore)) {
+        mapTarget(hit.dbKey);
+        // check if the sequences could pass the coverage threshold
+        hit.isCovered = Util::canBeCovered(aln.canCovThr, aln.covMode, static_cast<float>(origQueryLen), static_cast<float>(dbSeq.L));
+        hit.isIdentity = (queryDbKey == hit.dbKey && (aln.includeIdentity || aln.sameQTDB)) ? true : false;
+        hit.canPass = true;
+        hit.dbId = dbSeq.getId();
+        hit.residueOffset = pendingResidues.size();
+        hit.length = dbSeq.L;
+        if (checkEvalue) {
+            // align maps the targets of the window from these residues instead of mapping them again
+            pendingResidues.insert(pendingResidues.end(), dbSeq.numSequence, dbSeq.numSequence + dbSeq.L);
+            if (hit.isCovered && hit.isIdentity == false) {
+                checkHits.push_back(pending.size());
+                checkLengths.push_back(dbSeq.L);
+            }
+        }
+        pending.push_back(hit);
+    }
+    if (checkHits.empty() == false) {
+        checkSeqs.resize(checkHits.size());
+        checkScores.resize(checkHits.size());
+        for (size_t i = 0; i < checkHits.size(); i++) {
+            checkSeqs[i] = pendingResidues.data() + pending[checkHits[i]].residueOffset;
+        }
+        matcher.computeScoreBounds(checkSeqs.data(), checkLengths.data(), checkHits.size(), checkScores.data());
+        for (size_t i = 0; i < checkHits.size(); i++) {
+            pending[checkHits[i]].canPass = matcher.canPassEvalue(checkScores[i], aln.evalThr);
+        }
+    }
+    return pending.size();
+}
 
-                    // calculate Smith-Waterman alignment
-                    Matcher::result_t res = matcher.getSWResult(&dbSeq, static_cast<int>(diagonal), isReverse, covMode, covThr, evalThr, swMode, seqIdMode, isIdentity, wrappedScoring);
-                    alignmentsNum++;
+void Alignment::QueryAligner::mapTarget(unsigned int dbKey) {
+    size_t dbId = aln.tdbr->getId(dbKey);
+    char *dbSeqData = aln.tdbr->getData(dbId, thread_idx);
+    if (dbSeqData == NULL) {
+        Debug(Debug::ERROR) << "Sequence " << dbKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
+        EXIT(EXIT_FAILURE);
+    }
+    dbSeq.mapSequence(dbId, dbKey, dbSeqData, aln.tdbr->getSeqLen(dbId));
+}
 
-                    if (isIdentity) {
-                        // set coverage and seqid of identity
-                        res.qcov = 1.0f;
-                        res.dbcov = 1.0f;
-                        res.seqId = 1.0f;
-                    }
+void Alignment::QueryAligner::align(unsigned int queryDbKey, char *data, const hit_t *hits, size_t hitCount, std::string &out) {
+    char *origData = data;
+    size_t origQueryLen = 0;
+    // only load query data if there are hits
+    const bool hasHits = (data != NULL) ? (*data != '\0') : (hitCount > 0);
+    if (hasHits) {
+        size_t qId = aln.qdbr->getId(queryDbKey);
+        char *querySeqData = aln.qdbr->getData(qId, thread_idx);
+        if (querySeqData == NULL) {
+            Debug(Debug::ERROR) << "Query sequence " << queryDbKey
+                                << " is required in the prefiltering, but is not contained in the query sequence database.\nPlease check your database.\n";
+            EXIT(EXIT_FAILURE);
+        }
+        size_t queryLen = aln.qdbr->getSeqLen(qId);
+        origQueryLen = queryLen;
+        if (aln.wrappedScoring) {
+            queryToWrap = std::string(querySeqData, queryLen);
+            queryToWrap = queryToWrap + queryToWrap;
+            querySeqData = (char*)(queryToWrap).c_str();
+            queryLen = origQueryLen*2;
+        }
 
-                    if (checkCriteria(res, isIdentity, evalThr, seqIdThr, alnLenThr, covMode, covThr)) {
-                        swResults.emplace_back(res);
-                        passedNum++;
-                        totalPassedNum++;
-                        rejected = 0;
-                    } else {
-                        rejected++;
-                    }
-                }
+        qSeq.mapSequence(qId, queryDbKey, querySeqData, queryLen);
+        matcher.initQuery(&qSeq);
+    }
 
-                if (altAlignment > 0 && realign == false && wrappedScoring == false) {
-                    computeAlternativeAlignment(queryDbKey, dbSeq, swResults, matcher, covThr, evalThr, swMode, thread_idx);
+    // walk through the prefiltering list and calculate a Smith-Waterman alignment for each sequence in the list
+    size_t queryPassedNum = 0;
+    unsigned int rejected = 0;
+    size_t hitIdx = 0;
+    // the inter-sequence kernel only pays off if the e-value threshold rejects most hits, every few queries
+    // the hits are screened regardless, so a thread notices if this changes
+    bool checkEvalue = hasHits && aln.wrappedScoring == false && Parameters::isEqualDbtype(aln.targetSeqType, Parameters::DBTYPE_AMINO_ACIDS)
+                       && matcher.canComputeScoreBounds() && matcher.canPassEvalue(1, aln.evalThr) == false
+                       && (screenedHits < MIN_SCREENED_HITS || failedHits * 2 >= screenedHits || queryCount % 16 == 0);
+    queryCount++;
+    // the window grows, so an early stop through --max-accept or --max-rejected does not waste much work
+    size_t windowSize = checkEvalue ? Matcher::BATCH_SIZE : 1;
+    size_t pendingCount = 0;
+    size_t pendingIdx = 0;
+    while (queryPassedNum < aln.maxAccept && rejected < aln.maxReject) {
+        if (pendingIdx == pendingCount) {
+            pendingCount = nextHits(data, hits, hitCount, hitIdx, queryDbKey, origQueryLen, windowSize, checkEvalue);
+            pendingIdx = 0;
+            if (pendingCount == 0) {
+                break;
+            }
+            if (checkEvalue) {
+                windowSize *= 2;
+                for (size_t i = 0; i < pendingCount; i++) {
+                    failedHits += (pending[i].canPass == false);
                 }
-
-                if (swResults.size() > 1) {
-                    SORT_SERIAL(swResults.begin(), swResults.end(), Matcher::compareHits);
+                screenedHits += pendingCount;
+                // older queries count less
+                if (screenedHits > 8 * MIN_SCREENED_HITS) {
+                    screenedHits /= 2;
+                    failedHits /= 2;
                 }
+            }
+        }
+        const PendingHit &hit = pending[pendingIdx];
+        pendingIdx++;
 
-                std::vector<Matcher::result_t> *returnRes = &swResults;
-                if (realign == true) {
-                    realigner->initQuery(&qSeq);
-                    int realignAccepted = 0;
-                    for (size_t result = 0; result < swResults.size() && realignAccepted < realignMaxSeqs; result++) {
-                        size_t dbId = tdbr->getId(swResults[result].dbKey);
-                        char *dbSeqData = tdbr->getData(dbId, thread_idx);
-                        if (dbSeqData == NULL) {
-                            Debug(Debug::ERROR) << "Sequence " << swResults[result].dbKey <<" is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
-                            EXIT(EXIT_FAILURE);
-                        }
-                        dbSeq.mapSequence(dbId, swResults[result].dbKey, dbSeqData, tdbr->getSeqLen(dbId));
-
-                        // recompute alignment boundaries (without changing evalue)
-                        const bool isIdentity = (queryDbKey == swResults[result].dbKey && (includeIdentity || sameQTDB)) ? true : false;
-                        Matcher::result_t res = realigner->getSWResult(&dbSeq, INT_MAX, false, realignCov, covThr, FLT_MAX, realignSwMode, seqIdMode, isIdentity);
-
-                        const bool covOK = Util::hasCoverage(realignCov, covMode, res.qcov, res.dbcov);
-                        if (covOK == true || isIdentity) {
-                            res.score = swResults[result].score;
-                            res.eval  = swResults[result].eval;
-                            swRealignResults.emplace_back(res);
-                            realignAccepted++;
-                        }
-                    }
+        if (hit.isCovered == false) {
+            rejectedHits.length++;
+            rejected++;
+            continue;
+        }
 
-                    if (altAlignment > 0) {
-                        computeAlternativeAlignment(queryDbKey, dbSeq, swRealignResults, *realigner, realignCov, FLT_MAX, realignSwMode, thread_idx);
-                    }
+        const bool isIdentity = hit.isIdentity;
+        // the upper bound of the score already misses the e-value threshold
+        if (hit.canPass == false) {
+            rejectedHits.scoreBound++;
+            rejected++;
+            continue;
+        }
+        alignmentsNum++;
 
-                    if (swRealignResults.size() > 1) {
-                        SORT_SERIAL(swRealignResults.begin(), swRealignResults.end(), Matcher::compareHits);
-                    }
+        if (pendingCount > 1) {
+            // dbSeq holds the last target of the window
+            dbSeq.mapSequence(hit.dbId, hit.dbKey, std::make_pair(pendingResidues.data() + hit.residueOffset, static_cast<unsigned int>(hit.length)));
+        }
+        // calculate Smith-Waterman alignment
+        Matcher::result_t res = matcher.getSWResult(&dbSeq, static_cast<int>(hit.diagonal), hit.isReverse, aln.covMode, aln.covThr, aln.evalThr, aln.swMode, aln.seqIdMode, isIdentity, aln.wrappedScoring, aln.seqIdThr, hit.prefScore);
+
+        if (isIdentity) {
+            // set coverage and seqid of identity
+            res.qcov = 1.0f;
+            res.dbcov = 1.0f;
+            res.seqId = 1.0f;
+        }
 
-                    returnRes = &swRealignResults;
-                }
+        if (checkCriteria(res, isIdentity, aln.evalThr, aln.seqIdThr, aln.alnLenThr, aln.covMode, aln.covThr)) {
+            swResults.emplace_back(res);
+            queryPassedNum++;
+            passedNum++;
+            rejected = 0;
+        } else {
+            // checkCriteria passes identities, so the stages are checked in the order getSWResult computes them
+            if (res.eval > aln.evalThr) {
+                rejectedHits.evalue++;
+            } else if (Util::hasCoverage(aln.covThr, aln.covMode, res.qcov, res.dbcov) == false) {
+                rejectedHits.coverage++;
+            } else {
+                rejectedHits.seqId++;
+            }
+            rejected++;
+        }
+    }
 
-                if (lcaAlign == true && swRealignResults.size() > 0) {
-                    Matcher::result_t& topHit = swRealignResults[0];
-                    const unsigned int topHitKey = topHit.dbKey;
-                    size_t dbId = tdbr->getId(topHitKey);
-                    char *qSeqData = tdbr->getData(dbId, thread_idx);
-                    if (qSeqData == NULL) {
-                        Debug(Debug::ERROR) << "Sequence " << topHitKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
-                        EXIT(EXIT_FAILURE);
-                    }
-                    qSeq.mapSequence(dbId, topHitKey, qSeqData + topHit.dbStartPos, topHit.dbEndPos - topHit.dbStartPos + 1);
-                    realigner->initQuery(&qSeq);
-
-                    const double topHitEval = topHit.eval;
-                    swRealignResults.clear();
-
-                    data = origData;
-                    unsigned int rejected = 0;
-                    while (*data != '\0' && rejected < maxReject) {
-                        Util::parseKey(data, buffer);
-                        const unsigned int dbKey = (unsigned int) strtoul(buffer, NULL, 10);
-//                        size_t elements = Util::getWordsOfLine(data, words, 10);
-//                        short diagonal = 0;
-//                        bool isReverse = false;
-//                        // Prefilter result (need to make this better)
-//                        if (elements == 3) {
-//                            hit_t hit = QueryMatcher::parsePrefilterHit(data);
-//                            isReverse = reversePrefilterResult && (hit.prefScore < 0);
-//                            diagonal = static_cast<short>(hit.diagonal);
-//                        }
-                        data = Util::skipLine(data);
+    if (aln.altAlignment > 0 && aln.realign == false && aln.wrappedScoring == false) {
+        aln.computeAlternativeAlignment(queryDbKey, dbSeq, swResults, matcher, aln.covThr, aln.evalThr, aln.swMode, thread_idx);
+    }
 
-                        dbId = tdbr->getId(dbKey);
-                        char* dbSeqData = tdbr->getData(dbId, thread_idx);
-                        if (dbSeqData == NULL) {
-                            Debug(Debug::ERROR) << "Sequence " << dbKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
-                            EXIT(EXIT_FAILURE);
-                        }
-                        dbSeq.mapSequence(dbId, dbKey, dbSeqData, tdbr->getSeqLen(dbId));
+    if (swResults.size() > 1) {
+        SORT_SERIAL(swResults.begin(), swResults.end(), Matcher::compareHits);
+    }
+
+    std::vector<Matcher::result_t> *returnRes = &swResults;
+    if (aln.realign == true) {
+        realigner->initQuery(&qSeq);
+        int realignAccepted = 0;
+        for (size_t result = 0; result < swResults.size() && realignAccepted < aln.realignMaxSeqs; result++) {
+            mapTarget(swResults[result].dbKey);
+
+            // recompute alignment boundaries (without changing evalue)
+            const bool isIdentity = (queryDbKey == swResults[result].dbKey && (aln.includeIdentity || aln.sameQTDB)) ? true : false;
+            Matcher::result_t res = realigner->getSWResult(&dbSeq, INT_MAX, false, aln.realignCov, aln.covThr, FLT_MAX, aln.realignSwMode, aln.seqIdMode, isIdentity);
+
+            const bool covOK = Util::hasCoverage(aln.realignCov, aln.covMode, res.qcov, res.dbcov);
+            if (covOK == true || isIdentity) {
+                res.score = swResults[result].score;
+                res.eval  = swResults[result].eval;
+                swRealignResults.emplace_back(res);
+                realignAccepted++;
+            }
+        }
 
-                        Matcher::result_t res = realigner->getSWResult(&dbSeq, INT_MAX, false, covMode, realignCov, topHitEval, lcaSwMode, seqIdMode, false);
+        if (aln.altAlignment > 0) {
+            aln.computeAlternativeAlignment(queryDbKey, dbSeq, swRealignResults, *realigner, aln.realignCov, FLT_MAX, aln.realignSwMode, thread_idx);
+        }
 
-                        if (checkCriteria(res, false, topHitEval, seqIdThr, alnLenThr, covMode, realignCov)) {
-                            swRealignResults.emplace_back(res);
-                            rejected = 0;
-                        } else {
-                            rejected++;
-                        }
-                    }
+        if (swRealignResults.size() > 1) {
+            SORT_SERIAL(swRealignResults.begin(), swRealignResults.end(), Matcher::compareHits);
+        }
 
-                    if (swRealignResults.size() > 1) {
-                        SORT_SERIAL(swRealignResults.begin(), swRealignResults.end(), Matcher::compareHits);
-                    }
+        returnRes = &swRealignResults;
+    }
 
-                    returnRes = &swRealignResults;
-                }
-                if(alignmentOutputMode == Parameters::ALIGNMENT_OUTPUT_CLUSTER) {
-                    for (size_t result = 0; result < returnRes->size(); result++) {
-                        alnResultsOutString.append(SSTR((*returnRes)[result].dbKey));
-                        alnResultsOutString.push_back('\n');
-                    }
-                }else{
-                    for (size_t result = 0; result < returnRes->size(); result++) {
-                        size_t len = Matcher::resultToBuffer(buffer, (*returnRes)[result], addBacktrace);
-                        alnResultsOutString.append(buffer, len);
-                    }
-                }
-                dbw.writeData(alnResultsOutString.c_str(), alnResultsOutString.length(), queryDbKey, thread_idx);
-                alnResultsOutString.clear();
-                swResults.clear();
-                swRealignResults.clear();
-            }
-            if (realigner != NULL && realigner != &matcher) {
-                delete realigner;
-            }
-            // only remap if we have more than one iteration and we are not at the last iteration
-            if (i != (iterations - 1)) {
-#pragma omp barrier
-                if (thread_idx == 0) {
-                    prefdbr->remapData();
-                }
-#pragma omp barrier
+    if (aln.lcaAlign == true && swRealignResults.size() > 0) {
+        Matcher::result_t& topHit = swRealignResults[0];
+        const unsigned int topHitKey = topHit.dbKey;
+        size_t dbId = aln.tdbr->getId(topHitKey);
+        char *qSeqData = aln.tdbr->getData(dbId, thread_idx);
+        if (qSeqData == NULL) {
+            Debug(Debug::ERROR) << "Sequence " << topHitKey << " is required in the prefiltering, but is not contained in the target sequence database!\nPlease check your database.\n";
+            EXIT(EXIT_FAILURE);
+        }
+        qSeq.mapSequence(dbId, topHitKey, qSeqData + topHit.dbStartPos, topHit.dbEndPos - topHit.dbStartPos + 1);
+        realigner->initQuery(&qSeq);
+
+        const double topHitEval = topHit.eval;
+        swRealignResults.clear();
+
+        data = origData;
+        hitIdx = 0;
+        rejected = 0;
+        unsigned int dbKey;
+        short diagonal;
+        bool isReverse;
+        int prefScore;
+        while (rejected < aln.maxReject && nextHit(data, hits, hitCount, hitIdx, dbKey, diagonal, isReverse, prefScore)) {
+            mapTarget(dbKey);
+
+            Matcher::result_t res = realigner->getSWResult(&dbSeq, INT_MAX, false, aln.covMode, aln.realignCov, topHitEval, aln.lcaSwMode, aln.seqIdMode, false);
+
+            if (checkCriteria(res, false, topHitEval, aln.seqIdThr, aln.alnLenThr, aln.covMode, aln.realignCov)) {
+                swRealignResults.emplace_back(res);
+                rejected = 0;
+            } else {
+                rejected++;
             }
         }
-    }
-    dbw.close(merge);
 
-    Debug(Debug::INFO) << alignmentsNum << " alignments calculated\n";
-    Debug(Debug::INFO) << totalPassedNum << " sequence pairs passed the thresholds";
-    if (alignmentsNum > 0) {
-        Debug(Debug::INFO) << " (" << ((float) totalPassedNum / (float) alignmentsNum) << " of overall calculated)";
+        if (swRealignResults.size() > 1) {
+            SORT_SERIAL(swRealignResults.begin(), swRealignResults.end(), Matcher::compareHits);
+        }
+
+        returnRes = &swRealignResults;
     }
-    Debug(Debug::INFO) << "\n";
-    if (dbSize > 0) {
-        size_t hits = totalPassedNum / dbSize;
-        size_t hits_rest = totalPassedNum % dbSize;
-        float hits_f = ((float) hits) + ((float) hits_rest) / (float) dbSize;
-        Debug(Debug::INFO) << hits_f << " hits per query sequence\n";
+    if (aln.alignmentOutputMode == Parameters::ALIGNMENT_OUTPUT_CLUSTER) {
+        for (size_t result = 0; result < returnRes->size(); result++) {
+            out.append(SSTR((*returnRes)[result].dbKey));
+            out.push_back('\n');
+        }
+    } else if (aln.binaryAlignment) {
+        Matcher::resultsToBinary(out, *returnRes, aln.addBacktrace);
+    } else {
+        for (size_t result = 0; result < returnRes->size(); result++) {
+            char *lineBuffer = buffer;
+            const size_t maxLen = Matcher::resultToBufferSize((*returnRes)[result], aln.addBacktrace);
+            if (maxLen > sizeof(buffer)) {
+                longBuffer.resize(maxLen);
+                lineBuffer = &longBuffer[0];
+            }
+            size_t len = Matcher::resultToBuffer(lineBuffer, (*returnRes)[result], aln.addBacktrace);
+            out.append(lineBuffer, len);
+        }
     }
+    swResults.clear();
+    swRealignResults.clear();
 }
 
 size_t Alignment::estimateHDDMemoryConsumption(int dbSize, int maxSeqs) {
@@ -595,7 +798,7 @@ void Alignment::computeAlternativeAlignment(unsigned int queryDbKey, Sequence &d
         }
         bool nextAlignment = true;
         for (int altAli = 0; altAli < altAlignment && nextAlignment; altAli++) {
-            Matcher::result_t res = matcher.getSWResult(&dbSeq, INT_MAX, false, covMode, covThr, evalThr, swMode, seqIdMode, isIdentity);
+            Matcher::result_t res = matcher.getSWResult(&dbSeq, INT_MAX, false, covMode, covThr, evalThr, swMode, seqIdMode, isIdentity, false, seqIdThr);
             nextAlignment = checkCriteria(res, isIdentity, evalThr, seqIdThr, alnLenThr, covMode, covThr);
             if (nextAlignment == true) {
                 swResults.emplace_back(res);
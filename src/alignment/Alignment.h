@@ -6,6 +6,9 @@
 #include "Parameters.h"
 #include "BaseMatrix.h"
 #include "Matcher.h"
+#include "Sequence.h"
+
+struct hit_t;
 
 class Alignment {
 public:
@@ -29,6 +32,107 @@ public:
 
     static unsigned int initSWMode(unsigned int alignmentMode, float covThr, float seqIdThr);
 
+    int getOutputDbtype();
+
+    // hits rejected by each stage of the alignment, from the cheapest to the most expensive stage
+    struct RejectedHits {
+        // the sequence lengths cannot reach the coverage threshold
+        size_t length;
+        // the score bound of the inter-sequence kernel misses the e-value threshold
+        size_t scoreBound;
+        // the score of the forward pass misses the e-value threshold
+        size_t evalue;
+        size_t coverage;
+        // sequence identity or alignment length
+        size_t seqId;
+
+        RejectedHits() : length(0), scoreBound(0), evalue(0), coverage(0), seqId(0) {}
+
+        void add(const RejectedHits &other) {
+            length += other.length;
+            scoreBound += other.scoreBound;
+            evalue += other.evalue;
+            coverage += other.coverage;
+            seqId += other.seqId;
+        }
+    };
+
+    static void printStatistics(size_t alignmentsNum, size_t totalPassedNum, size_t querySize, const RejectedHits &rejectedHits,
+                                const SmithWaterman::PassCounts &passCounts);
+
+    // per thread state to align a query against its prefilter hits
+    class QueryAligner {
+    public:
+        QueryAligner(Alignment &aln, unsigned int thread_idx);
+        ~QueryAligner();
+
+        // hits are read from the prefilter result lines in data or, if data is NULL, from the hits of a fused prefilter
+        // the accepted alignments are appended to out
+        void align(unsigned int queryDbKey, char *data, const hit_t *hits, size_t hitCount, std::string &out);
+
+        size_t alignmentsNum;
+        size_t passedNum;
+        RejectedHits rejectedHits;
+
+        void addPassCounts(SmithWaterman::PassCounts &counts) const;
+
+    private:
+        Alignment &aln;
+        unsigned int thread_idx;
+
+        // hits of the recent queries of this thread that were screened by the inter-sequence kernel and how many of them failed
+        static const size_t MIN_SCREENED_HITS = 256;
+        size_t queryCount;
+        size_t screenedHits;
+        size_t failedHits;
+
+        Sequence qSeq;
+        Sequence dbSeq;
+        Matcher matcher;
+        Matcher *realigner;
+
+        std::vector<Matcher::result_t> swResults;
+        std::vector<Matcher::result_t> swRealignResults;
+        std::string queryToWrap;
+
+        char buffer[1024 + 32768*4];
+        // result lines with a backtrace that does not fit into buffer, e.g. from the linear memory traceback
+        std::string longBuffer;
+        const char *words[10];
+
+        struct PendingHit {
+            unsigned int dbKey;
+            short diagonal;
+            bool isReverse;
+            int prefScore;
+            bool isCovered;
+            bool isIdentity;
+            bool canPass;
+            // mapped target in pendingResidues if the e-value threshold is checked
+            size_t dbId;
+            size_t residueOffset;
+            int length;
+        };
+
+        // hits are read ahead, so the inter-sequence kernel can check the e-value threshold of many targets at once
+        std::vector<PendingHit> pending;
+        std::vector<unsigned char> pendingResidues;
+        std::vector<size_t> checkHits;
+        std::vector<int32_t> checkLengths;
+        std::vector<int32_t> checkScores;
+        std::vector<const unsigned char *> checkSeqs;
+
+        // prefScore is the absolute prefilter score or 0 if data does not hold prefilter results
+        bool nextHit(char *&data, const hit_t *hits, size_t hitCount, size_t &hitIdx,
+                     unsigned int &dbKey, short &diagonal, bool &isReverse, int &prefScore);
+
+        // reads up to windowSize hits into pending and returns their count
+        size_t nextHits(char *&data, const hit_t *hits, size_t hitCount, size_t &hitIdx,
+                        unsigned int queryDbKey, size_t origQueryLen, size_t windowSize, bool checkEvalue);
+
+        void mapTarget(unsigned int dbKey);
+    };
+
 private:
     // sequence coverage threshold
     double covThr;
@@ -87,10 +191,13 @@ private:
 
     int altAlignment;
     int alignmentOutputMode;
+    // writes fixed-width binary records instead of text lines
+    const bool binaryAlignment;
 
     const unsigned int maxAccept;
     const unsigned int maxReject;
     const bool wrappedScoring;
+    const bool numa;
 
     BaseMatrix *m;
     // costs to open a gap
@@ -105,6 +212,8 @@ private:
     // needed for realignment
     BaseMatrix *realign_m;
 
+    EvalueComputation *evaluer;
+
     DBReader<unsigned int> *qdbr;
     IndexReader * qDbrIdx;
 
@@ -117,6 +226,8 @@ private:
 
     static size_t estimateHDDMemoryConsumption(int dbSize, int maxSeqs);
 
+    size_t getMaxMatcherSeqLen();
+
     void computeAlternativeAlignment(unsigned int queryDbKey, Sequence &dbSeq,
                                      std::vector<Matcher::result_t> &vector, Matcher &matcher,
                                      float covThr, float evalThr, int swMode, int thread_idx);
@@ -58,9 +58,23 @@ void Matcher::initQuery(Sequence* query){
 }
 
 
+bool Matcher::canComputeScoreBounds() {
+    // the kernel looks up the scores of at most 32 residues with byte shuffles
+    return Parameters::isEqualDbtype(currentQuery->getSequenceType(), Parameters::DBTYPE_AMINO_ACIDS) && m->alphabetSize <= 32;
+}
+
+void Matcher::computeScoreBounds(const unsigned char **dbSeqs, const int32_t *dbLengths, size_t count, int32_t *scores) {
+    aligner->ssw_score_batch(dbSeqs, dbLengths, count, gapOpen, gapExtend, scores);
+}
+
+bool Matcher::canPassEvalue(int32_t scoreBound, const double evalThr) {
+    // ssw_align does not compute an e-value if nothing aligned, leave these to getSWResult
+    return scoreBound == 0 || evaluer->computeEvalue(scoreBound, currentQuery->L) <= evalThr;
+}
+
 Matcher::result_t Matcher::getSWResult(Sequence* dbSeq, const int diagonal, bool isReverse, const int covMode, const float covThr,
                                        const double evalThr, unsigned int alignmentMode, unsigned int seqIdMode, bool isIdentity,
-                                       bool wrappedScoring){
+                                       bool wrappedScoring, float seqIdThr, int expectedScore){
     // calculation of the score and traceback of the alignment
     int32_t maskLen = currentQuery->L / 2;
     int origQueryLen = wrappedScoring? currentQuery->L / 2 : currentQuery->L ;
@@ -86,7 +100,9 @@ Matcher::result_t Matcher::getSWResult(Sequence* dbSeq, const int diagonal, bool
         alignment = nuclaligner->align(dbSeq, diagonal, isReverse, backtrace, aaIds, evaluer, wrappedScoring);
         alignmentMode = Matcher::SCORE_COV_SEQID;
     }else{ if(isIdentity==false){
-            alignment = aligner->ssw_align(dbSeq->numSequence, dbSeq->L, gapOpen, gapExtend, alignmentMode, evalThr, evaluer, covMode, covThr, maskLen);
+            // the traceback is skipped for alignments that cannot reach seqIdThr, the wrapped query is twice as long as the sequence identity assumes
+            alignment = aligner->ssw_align(dbSeq->numSequence, dbSeq->L, gapOpen, gapExtend, alignmentMode, evalThr, evaluer, covMode, covThr, maskLen,
+                                           seqIdMode, wrappedScoring ? 0.0f : seqIdThr, expectedScore);
         }else{
             alignment = aligner->scoreIdentical(dbSeq->numSequence, dbSeq->L, evaluer, alignmentMode);
         }
@@ -192,12 +208,77 @@ void Matcher::readAlignmentResults(std::vector<result_t> &result, char *data, bo
         return;
     }
 
+    if (AlignmentRecords::isBinary(data)) {
+        AlignmentRecords records(data);
+        for (size_t i = 0; i < records.size(); i++) {
+            result.emplace_back(recordToResult(records, i, readCompressed));
+        }
+        return;
+    }
+
     while(*data != '\0'){
         result.emplace_back(parseAlignmentRecord(data, readCompressed));
         data = Util::skipLine(data);
     }
 }
 
+Matcher::result_t Matcher::recordToResult(const AlignmentRecords &records, size_t i, bool readCompressed) {
+    const AlignmentRecord &record = records[i];
+    // coverage and alignment length are derived the same way as for text records
+    int adjustQstart = (record.qStartPos == -1) ? 0 : record.qStartPos;
+    int adjustDBstart = (record.dbStartPos == -1) ? 0 : record.dbStartPos;
+    double qCov = SmithWaterman::computeCov(adjustQstart, record.qEndPos, record.qLen);
+    double dbCov = SmithWaterman::computeCov(adjustDBstart, record.dbEndPos, record.dbLen);
+    size_t alnLength = Matcher::computeAlnLength(adjustQstart, record.qEndPos, adjustDBstart, record.dbEndPos);
+
+    std::string backtrace(records.getBacktrace(i), record.backtraceLength);
+    if (readCompressed == false && backtrace.empty() == false) {
+        backtrace = uncompressAlignment(backtrace);
+    }
+    return Matcher::result_t(record.dbKey, record.score, qCov, dbCov, record.seqId, record.eval,
+                             alnLength, record.qStartPos, record.qEndPos, record.qLen,
+                             record.dbStartPos, record.dbEndPos, record.dbLen,
+                             record.queryOrfStartPos, record.queryOrfEndPos,
+                             record.dbOrfStartPos, record.dbOrfEndPos, backtrace);
+}
+
+void Matcher::resultsToBinary(std::string &buffer, const std::vector<result_t> &results, bool addBacktrace, bool compress, bool addOrfPosition) {
+    if (results.empty()) {
+        return;
+    }
+    std::string backtraces;
+    char number[32];
+    AlignmentRecords::writeHeader(buffer, results.size());
+    for (size_t i = 0; i < results.size(); i++) {
+        const result_t &result = results[i];
+        AlignmentRecord record;
+        record.dbKey = result.dbKey;
+        record.score = result.score;
+        // the sequence identity and e-value have the precision of text records, so that both formats give the same results
+        Util::fastSeqIdToBuffer(result.seqId, number);
+        record.seqId = strtod(number, NULL);
+        snprintf(number, sizeof(number), "%.3E", result.eval);
+        record.eval = strtod(number, NULL);
+        record.qStartPos = result.qStartPos;
+        record.qEndPos = result.qEndPos;
+        record.qLen = result.qLen;
+        record.dbStartPos = result.dbStartPos;
+        record.dbEndPos = result.dbEndPos;
+        record.dbLen = result.dbLen;
+        record.queryOrfStartPos = addOrfPosition ? result.queryOrfStartPos : -1;
+        record.queryOrfEndPos = addOrfPosition ? result.queryOrfEndPos : -1;
+        record.dbOrfStartPos = addOrfPosition ? result.dbOrfStartPos : -1;
+        record.dbOrfEndPos = addOrfPosition ? result.dbOrfEndPos : -1;
+        record.backtraceOffset = backtraces.size();
+        if (addBacktrace == true) {
+            backtraces.append(compress ? compressAlignment(result.backtrace) : result.backtrace);
+        }
+        record.backtraceLength = backtraces.size() - record.backtraceOffset;
+        AlignmentRecords::writeRecord(buffer, record);
+    }
+    buffer.append(backtraces);
+}
+
 int Matcher::computeAlnLength(int qStart, int qEnd, int dbStart, int dbEnd) {
     return std::max(abs(qEnd - qStart), abs(dbEnd - dbStart)) + 1;
 }
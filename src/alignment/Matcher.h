@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <vector>
 #include "itoa.h"
+#include "AlignmentRecord.h"
 
 #include "Sequence.h"
 #include "BaseMatrix.h"
@@ -150,7 +151,27 @@ public:
 
     // run SSE2 parallelized Smith-Waterman alignment calculation and traceback
     result_t getSWResult(Sequence* dbSeq, const int diagonal, bool isReverse, const int covMode, const float covThr, const double evalThr,
-                         unsigned int alignmentMode, unsigned int seqIdMode, bool isIdentical, bool wrappedScoring=false);
+                         unsigned int alignmentMode, unsigned int seqIdMode, bool isIdentical, bool wrappedScoring=false, float seqIdThr=0.0f,
+                         int expectedScore=0);
+
+    // adds the passes of all getSWResult calls so far, nucleotide alignments are not counted
+    void addPassCounts(SmithWaterman::PassCounts &counts) const {
+        if (aligner != NULL) {
+            counts.add(aligner->getPassCounts());
+        }
+    }
+
+    // targets that should at least be passed to computeScoreBounds at once, so no lane of the kernel is idle for long
+    static const int BATCH_SIZE = 4 * SmithWaterman::BATCH_LANES;
+
+    // only amino acid sequence queries can be aligned with the inter-sequence kernel
+    bool canComputeScoreBounds();
+
+    // upper bounds of the getSWResult scores of count targets, computed with the inter-sequence kernel
+    void computeScoreBounds(const unsigned char **dbSeqs, const int32_t *dbLengths, size_t count, int32_t *scores);
+
+    // false if getSWResult would reject every target with at most this score on the e-value threshold
+    bool canPassEvalue(int32_t scoreBound, const double evalThr);
 
     // need for sorting the results
     static bool compareHits(const result_t &first, const result_t &second) {
@@ -206,6 +227,9 @@ public:
 
     static result_t parseAlignmentRecord(const char *data, bool readCompressed=false);
 
+    static result_t recordToResult(const AlignmentRecords &records, size_t i, bool readCompressed = false);
+
+    // reads text as well as binary alignment entries
     static void readAlignmentResults(std::vector<result_t> &result, char *data, bool readCompressed = false);
 
     static float estimateSeqIdByScorePerCol(uint16_t score, unsigned int qLen, unsigned int tLen);
@@ -217,6 +241,14 @@ public:
 
     static size_t resultToBuffer(char * buffer, const result_t &result, bool addBacktrace, bool compress  = true, bool addOrfPosition = false);
 
+    // upper bound of the bytes resultToBuffer writes, a compressed backtrace has at most two chars per column
+    static size_t resultToBufferSize(const result_t &result, bool addBacktrace) {
+        return 1024 + (addBacktrace ? 2 * result.backtrace.size() : 0);
+    }
+
+    // appends the results as one binary alignment entry, nothing is written for an empty result list
+    static void resultsToBinary(std::string &buffer, const std::vector<result_t> &results, bool addBacktrace, bool compress = true, bool addOrfPosition = false);
+
     static int computeAlnLength(int anEnd, int start, int dbEnd, int dbStart);
 
     static void updateResultByRescoringBacktrace(const char *querySeq, const char *targetSeq, const char **subMat, EvalueComputation &evaluer,
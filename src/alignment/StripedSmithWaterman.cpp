@@ -30,17 +30,26 @@
 #include "SubstitutionMatrix.h"
 #include "Debug.h"
 
+#include <algorithm>
 #include <iostream>
 
 SmithWaterman::SmithWaterman(size_t maxSequenceLength, int aaSize, bool aaBiasCorrection) {
 	maxSequenceLength += 1;
 	this->aaBiasCorrection = aaBiasCorrection;
+	maxBandedTracebackSize = MAX_BANDED_TRACEBACK_SIZE;
 	const int segSize = (maxSequenceLength+7)/8;
 	vHStore = (simd_int*) mem_align(ALIGN_INT, segSize * sizeof(simd_int));
 	vHLoad  = (simd_int*) mem_align(ALIGN_INT, segSize * sizeof(simd_int));
 	vE      = (simd_int*) mem_align(ALIGN_INT, segSize * sizeof(simd_int));
 	vHmax   = (simd_int*) mem_align(ALIGN_INT, segSize * sizeof(simd_int));
+	batchH = NULL;
+	batchE = NULL;
+	batchBias = NULL;
+	batchCapacity = 0;
+	batchProfile = (simd_int*) mem_align(ALIGN_INT, aaSize * sizeof(simd_int));
+	batchTables = (__m128i*) mem_align(ALIGN_INT, aaSize * 2 * sizeof(__m128i));
 	profile = new s_profile();
+	profileScoreSize = -1;
 	profile->profile_byte = (simd_int*)mem_align(ALIGN_INT, aaSize * segSize * sizeof(simd_int));
 	profile->profile_word = (simd_int*)mem_align(ALIGN_INT, aaSize * segSize * sizeof(simd_int));
 	profile->profile_rev_byte = (simd_int*)mem_align(ALIGN_INT, aaSize * segSize * sizeof(simd_int));
@@ -70,6 +79,11 @@ SmithWaterman::~SmithWaterman(){
 	free(vHLoad);
 	free(vE);
 	free(vHmax);
+	free(batchH);
+	free(batchE);
+	free(batchBias);
+	free(batchProfile);
+	free(batchTables);
 	free(profile->profile_byte);
 	free(profile->profile_word);
 	free(profile->profile_rev_byte);
@@ -136,7 +150,9 @@ s_align SmithWaterman::ssw_align (
 		const double  evalueThr,
 		EvalueComputation * evaluer,
 		const int covMode, const float covThr,
-		const int32_t maskLen) {
+		const int32_t maskLen,
+		const int seqIdMode, const float seqIdThr,
+		const int32_t expectedScore) {
 
 	int32_t word = 0, query_length = profile->query_length;
 	int32_t band_width = 0;
@@ -153,19 +169,28 @@ s_align SmithWaterman::ssw_align (
     std::pair<alignment_end, alignment_end> bests;
     std::pair<alignment_end, alignment_end> bests_reverse;
     // Find the alignment scores and ending positions
-	if (profile->profile_byte) {
+	if (profileScoreSize == 2 && expectedScore + profile->bias >= UCHAR_MAX) {
+		// the 8-bit pass would saturate and has to be repeated with 16 bit
+		bests = sw_sse2_word(db_sequence, 0, db_length, query_length, gap_open, gap_extend, profile->profile_word, USHRT_MAX, maskLen);
+		word = 1;
+		passCounts.wordScore++;
+	} else if (profile->profile_byte) {
 		bests = sw_sse2_byte(db_sequence, 0, db_length, query_length, gap_open, gap_extend, profile->profile_byte, UCHAR_MAX, profile->bias, maskLen);
 
 		if (profile->profile_word && bests.first.score == 255) {
 			bests = sw_sse2_word(db_sequence, 0, db_length, query_length, gap_open, gap_extend, profile->profile_word, USHRT_MAX, maskLen);
 			word = 1;
+			passCounts.saturatedScore++;
 		} else if (bests.first.score == 255) {
 			fprintf(stderr, "Please set 2 to the score_size parameter of the function ssw_init, otherwise the alignment results will be incorrect.\n");
 			EXIT(EXIT_FAILURE);
+		} else {
+			passCounts.byteScore++;
 		}
 	}else if (profile->profile_word) {
 		bests = sw_sse2_word(db_sequence, 0, db_length, query_length, gap_open, gap_extend, profile->profile_word, USHRT_MAX, maskLen);
 		word = 1;
+		passCounts.wordScore++;
 	}else {
 		fprintf(stderr, "Please call the function ssw_init before ssw_align.\n");
 		EXIT(EXIT_FAILURE);
@@ -200,6 +225,7 @@ s_align SmithWaterman::ssw_align (
 	}
 
 	// Find the beginning position of the best alignment.
+	passCounts.startPos++;
 	if (word == 0) {
 		if (isProfile) {
 			createQueryProfile<int8_t, VECSIZE_INT * 4, PROFILE>(profile->profile_rev_byte, profile->query_rev_sequence, NULL, profile->mat_rev,
@@ -242,8 +268,17 @@ s_align SmithWaterman::ssw_align (
     if (alignmentMode == 1 || hasLowerCoverage) {
         return r;
     }
+    // at best every residue of the shorter span is identical and no gap is opened
+    if (seqIdThr > 0.0f) {
+        const int32_t qSpan = r.qEndPos1 - r.qStartPos1 + 1;
+        const int32_t dbSpan = r.dbEndPos1 - r.dbStartPos1 + 1;
+        if (Util::computeSeqId(seqIdMode, std::min(qSpan, dbSpan), query_length, db_length, std::max(qSpan, dbSpan)) < seqIdThr) {
+            return r;
+        }
+    }
 
 	// Generate cigar.
+	passCounts.traceback++;
 	db_length = r.dbEndPos1 - r.dbStartPos1 + 1;
 	query_length = r.qEndPos1 - r.qStartPos1 + 1;
 	band_width = abs(db_length - query_length) + 1;
@@ -271,6 +306,163 @@ s_align SmithWaterman::ssw_align (
 
 
 
+void SmithWaterman::ssw_score_batch(const unsigned char **db_sequences, const int32_t *db_lengths, size_t count,
+									const uint8_t gap_open, const uint8_t gap_extend, int32_t *scores) {
+	const int32_t query_length = profile->query_length;
+	const int32_t alphabetSize = profile->alphabetSize;
+	if (static_cast<size_t>(query_length) > batchCapacity) {
+		free(batchH);
+		free(batchE);
+		free(batchBias);
+		batchCapacity = query_length;
+		batchH = (simd_int*) mem_align(ALIGN_INT, batchCapacity * sizeof(simd_int));
+		batchE = (simd_int*) mem_align(ALIGN_INT, batchCapacity * sizeof(simd_int));
+		batchBias = (simd_int*) mem_align(ALIGN_INT, batchCapacity * sizeof(simd_int));
+	}
+	memset(batchH, 0, query_length * sizeof(simd_int));
+	memset(batchE, 0, query_length * sizeof(simd_int));
+	for (int32_t j = 0; j < query_length; j++) {
+		batchBias[j] = simdi16_set(profile->composition_bias[j]);
+	}
+	// score of every target residue against query residue a, split into residues 0-15 and 16-31 for the byte shuffle
+	int8_t *tables = (int8_t *) batchTables;
+	for (int32_t a = 0; a < alphabetSize; a++) {
+		for (int32_t r = 0; r < 32; r++) {
+			tables[a * 32 + r] = (r < alphabetSize) ? profile->mat[r * alphabetSize + a] : 0;
+		}
+	}
+
+	// longest targets first, so all lanes finish at about the same time
+	batchOrder.resize(count);
+	for (size_t t = 0; t < count; t++) {
+		batchOrder[t] = t;
+	}
+	std::sort(batchOrder.begin(), batchOrder.end(), [db_lengths](size_t a, size_t b) {
+		return db_lengths[a] > db_lengths[b];
+	});
+
+	// every lane works through its own targets, a lane takes the next target as soon as its current one ends
+	const size_t NO_TARGET = SIZE_MAX;
+	static const unsigned char idleResidue = 0;
+	size_t laneTarget[BATCH_LANES];
+	int32_t laneLeft[BATCH_LANES];
+	const unsigned char *laneResidue[BATCH_LANES];
+	int32_t laneStep[BATCH_LANES];
+	short reset[BATCH_LANES] __attribute__((aligned(ALIGN_INT)));
+	short idle[BATCH_LANES] __attribute__((aligned(ALIGN_INT)));
+	short maxScores[BATCH_LANES] __attribute__((aligned(ALIGN_INT)));
+	unsigned char residues[16] __attribute__((aligned(16))) = { 0 };
+	size_t next = 0;
+	for (int k = 0; k < BATCH_LANES; k++) {
+		laneTarget[k] = NO_TARGET;
+		laneLeft[k] = 0;
+	}
+
+	const int8_t *query = profile->query_sequence;
+	const __m128i v15 = _mm_set1_epi8(15);
+	simd_int vGapO = simdi16_set(gap_open);
+	simd_int vGapE = simdi16_set(gap_extend);
+	simd_int vMaxScore = simdi_setzero();
+	while (true) {
+		bool hasReset = false;
+		bool maxStored = false;
+		int32_t steps = INT_MAX;
+		for (int k = 0; k < BATCH_LANES; k++) {
+			reset[k] = 0;
+			while (laneLeft[k] == 0) {
+				if (laneTarget[k] != NO_TARGET) {
+					if (maxStored == false) {
+						simdi_store((simd_int *) maxScores, vMaxScore);
+						maxStored = true;
+					}
+					// an empty target that was taken in this column did not align anything
+					scores[laneTarget[k]] = reset[k] ? 0 : maxScores[k];
+					laneTarget[k] = NO_TARGET;
+				}
+				if (next == count) {
+					break;
+				}
+				laneTarget[k] = batchOrder[next++];
+				laneLeft[k] = db_lengths[laneTarget[k]];
+				laneResidue[k] = db_sequences[laneTarget[k]];
+				laneStep[k] = 1;
+				reset[k] = -1;
+				hasReset = true;
+			}
+			if (laneTarget[k] == NO_TARGET) {
+				// idle lanes get a score that ends every alignment
+				idle[k] = SHRT_MIN;
+				laneResidue[k] = &idleResidue;
+				laneStep[k] = 0;
+				continue;
+			}
+			idle[k] = 0;
+			steps = std::min(steps, laneLeft[k]);
+		}
+		if (steps == INT_MAX) {
+			break;
+		}
+		for (int k = 0; k < BATCH_LANES; k++) {
+			laneLeft[k] -= laneStep[k] * steps;
+		}
+
+		// no lane changes its target during the next steps columns
+		simd_int vIdle = simdi_load((simd_int *) idle);
+		for (int32_t i = 0; i < steps; i++) {
+			for (int k = 0; k < BATCH_LANES; k++) {
+				residues[k] = *laneResidue[k];
+				laneResidue[k] += laneStep[k];
+			}
+			__m128i vResidues = _mm_load_si128((__m128i *) residues);
+			__m128i vHighResidue = _mm_cmpgt_epi8(vResidues, v15);
+			for (int32_t a = 0; a < alphabetSize; a++) {
+				__m128i vScores = _mm_blendv_epi8(_mm_shuffle_epi8(batchTables[2 * a], vResidues),
+												  _mm_shuffle_epi8(batchTables[2 * a + 1], vResidues), vHighResidue);
+#ifdef AVX2
+				simd_int vScoresWord = _mm256_cvtepi8_epi16(vScores);
+#else
+				simd_int vScoresWord = _mm_cvtepi8_epi16(vScores);
+#endif
+				simdi_store(batchProfile + a, simdi_or(vScoresWord, vIdle));
+			}
+
+			if (i == 0 && hasReset) {
+				// lanes that start a new target begin with an empty column
+				simd_int vReset = simdi_load((simd_int *) reset);
+				vMaxScore = simdi_andnot(vReset, vMaxScore);
+				for (int32_t j = 0; LIKELY(j < query_length); j++) {
+					simdi_store(batchH + j, simdi_andnot(vReset, simdi_load(batchH + j)));
+					simdi_store(batchE + j, simdi_andnot(vReset, simdi_load(batchE + j)));
+				}
+			}
+
+			// E and F are never negative, so they also serve as the zero of the local alignment
+			simd_int vF = simdi_setzero();
+			simd_int vHDiagonal = simdi_setzero();
+			simd_int* pvH = batchH;
+			simd_int* pvE = batchE;
+			const simd_int* pvBias = batchBias;
+			const simd_int* pvProfile = batchProfile;
+			for (int32_t j = 0; LIKELY(j < query_length); j++) {
+				simd_int vScore = simdi16_adds(simdi_load(pvProfile + query[j]), simdi_load(pvBias + j));
+				simd_int vH = simdi16_adds(vHDiagonal, vScore);
+				vHDiagonal = simdi_load(pvH + j);
+				simd_int e = simdi_load(pvE + j);
+				vH = simdi16_max(vH, e);
+				vH = simdi16_max(vH, vF);
+				vMaxScore = simdi16_max(vMaxScore, vH);
+				simdi_store(pvH + j, vH);
+
+				vH = simdui16_subs(vH, vGapO);
+				e = simdui16_subs(e, vGapE);
+				simdi_store(pvE + j, simdi16_max(e, vH));
+				vF = simdui16_subs(vF, vGapE);
+				vF = simdi16_max(vF, vH);
+			}
+		}
+	}
+}
+
 char SmithWaterman::cigar_int_to_op(uint32_t cigar_int) {
 	uint8_t letter_code = cigar_int & 0xfU;
 	static const char map[] = {
@@ -690,6 +882,7 @@ void SmithWaterman::ssw_init(const Sequence* q,
 							 const int8_t* mat,
 							 const BaseMatrix *m,
 							 const int8_t score_size) {
+	profileScoreSize = score_size;
 
 	profile->bias = 0;
 	profile->sequence_type = q->getSequenceType();
@@ -818,6 +1011,16 @@ SmithWaterman::cigar * SmithWaterman::banded_sw(const unsigned char *db_sequence
 			h_c = (int32_t*)realloc(h_c, s1 * sizeof(int32_t));
 		}
 		int64_t targetSize = width_d * query_length * 3;
+		if (targetSize > maxBandedTracebackSize) {
+			free(direction);
+			free(h_c);
+			free(e_b);
+			free(h_b);
+			free(c);
+			delete result;
+			return linear_sw<type>(db_sequence, query_sequence, compositionBias, db_length, query_length, queryStart,
+								   gap_open, gap_extend, mat, n);
+		}
 		while (targetSize >= s2) {
 			++s2;
 			kroundup32(s2);
@@ -983,6 +1186,165 @@ SmithWaterman::cigar * SmithWaterman::banded_sw(const unsigned char *db_sequence
 #undef set_d
 }
 
+template <const unsigned int type>
+SmithWaterman::cigar * SmithWaterman::linear_sw(const unsigned char *db_sequence, const int8_t *query_sequence, const int8_t * compositionBias,
+												int32_t db_length, int32_t query_length, int32_t queryStart,
+												const uint32_t gap_open, const uint32_t gap_extend, const int8_t *mat, int32_t n) {
+	LinearSwState state;
+	state.db_sequence = db_sequence;
+	state.query_sequence = query_sequence;
+	state.compositionBias = compositionBias;
+	state.queryStart = queryStart;
+	state.mat = mat;
+	state.n = n;
+	state.gapOpen = static_cast<int32_t>(gap_open) - static_cast<int32_t>(gap_extend);
+	state.gapExtend = gap_extend;
+	state.H.resize(db_length + 1);
+	state.E.resize(db_length + 1);
+	state.reverseH.resize(db_length + 1);
+	state.reverseE.resize(db_length + 1);
+	state.ops.reserve(query_length + db_length);
+	linear_sw_region<type>(state, 0, query_length, 0, db_length, state.gapOpen, state.gapOpen);
+
+	cigar* result = new cigar();
+	int32_t length = 0;
+	for (size_t i = 0; i < state.ops.size(); i++) {
+		if (i == 0 || state.ops[i] != state.ops[i - 1]) {
+			length++;
+		}
+	}
+	result->seq = new uint32_t[length];
+	result->length = length;
+	int32_t l = 0;
+	uint32_t count = 0;
+	for (size_t i = 0; i < state.ops.size(); i++) {
+		count++;
+		if (i + 1 == state.ops.size() || state.ops[i + 1] != state.ops[i]) {
+			result->seq[l++] = to_cigar_int(count, state.ops[i]);
+			count = 0;
+		}
+	}
+	return result;
+}
+
+template <const unsigned int type>
+void SmithWaterman::linear_sw_region(LinearSwState &state, int32_t qBegin, int32_t qLength, int32_t dbBegin, int32_t dbLength,
+									 int32_t gapBegin, int32_t gapEnd) {
+	const int32_t go = state.gapOpen;
+	const int32_t ge = state.gapExtend;
+	if (dbLength == 0) {
+		state.ops.insert(state.ops.end(), qLength, 'I');
+		return;
+	}
+	if (qLength == 0) {
+		state.ops.insert(state.ops.end(), dbLength, 'D');
+		return;
+	}
+	if (qLength == 1) {
+		// the insertion can continue the gap on the cheaper side
+		int32_t best = -(std::min(gapBegin, gapEnd) + ge) - (go + ge * dbLength);
+		int32_t bestJ = -1;
+		for (int32_t j = 0; j < dbLength; j++) {
+			int32_t score = linear_sw_score<type>(state, qBegin, dbBegin + j);
+			score -= (j > 0) ? go + ge * j : 0;
+			score -= (dbLength - 1 - j > 0) ? go + ge * (dbLength - 1 - j) : 0;
+			if (score > best) {
+				best = score;
+				bestJ = j;
+			}
+		}
+		if (bestJ == -1) {
+			if (gapBegin <= gapEnd) {
+				state.ops.push_back('I');
+				state.ops.insert(state.ops.end(), dbLength, 'D');
+			} else {
+				state.ops.insert(state.ops.end(), dbLength, 'D');
+				state.ops.push_back('I');
+			}
+		} else {
+			state.ops.insert(state.ops.end(), bestJ, 'D');
+			state.ops.push_back('M');
+			state.ops.insert(state.ops.end(), dbLength - 1 - bestJ, 'D');
+		}
+		return;
+	}
+
+	const int32_t mid = qLength / 2;
+	int32_t *H = state.H.data();
+	int32_t *E = state.E.data();
+	// scores of query residues up to mid against the target prefixes, E ends with an insertion
+	H[0] = 0;
+	for (int32_t j = 1; j <= dbLength; j++) {
+		H[j] = -(go + ge * j);
+		E[j] = H[j] - go;
+	}
+	for (int32_t i = 1; i <= mid; i++) {
+		int32_t diagonal = H[0];
+		H[0] = -(gapBegin + ge * i);
+		E[0] = H[0];
+		int32_t f = H[0] - go;
+		const int32_t queryPos = qBegin + i - 1;
+		for (int32_t j = 1; j <= dbLength; j++) {
+			const int32_t e = std::max(E[j] - ge, H[j] - go - ge);
+			f = std::max(f - ge, H[j - 1] - go - ge);
+			const int32_t h = std::max(diagonal + linear_sw_score<type>(state, queryPos, dbBegin + j - 1), std::max(e, f));
+			diagonal = H[j];
+			H[j] = h;
+			E[j] = e;
+		}
+	}
+
+	// scores of the remaining query residues against the target suffixes, reverseE starts with an insertion
+	int32_t *reverseH = state.reverseH.data();
+	int32_t *reverseE = state.reverseE.data();
+	reverseH[dbLength] = 0;
+	for (int32_t j = dbLength - 1; j >= 0; j--) {
+		reverseH[j] = -(go + ge * (dbLength - j));
+		reverseE[j] = reverseH[j] - go;
+	}
+	for (int32_t i = qLength - 1; i >= mid; i--) {
+		int32_t diagonal = reverseH[dbLength];
+		reverseH[dbLength] = -(gapEnd + ge * (qLength - i));
+		reverseE[dbLength] = reverseH[dbLength];
+		int32_t f = reverseH[dbLength] - go;
+		const int32_t queryPos = qBegin + i;
+		for (int32_t j = dbLength - 1; j >= 0; j--) {
+			const int32_t e = std::max(reverseE[j] - ge, reverseH[j] - go - ge);
+			f = std::max(f - ge, reverseH[j + 1] - go - ge);
+			const int32_t h = std::max(diagonal + linear_sw_score<type>(state, queryPos, dbBegin + j), std::max(e, f));
+			diagonal = reverseH[j];
+			reverseH[j] = h;
+			reverseE[j] = e;
+		}
+	}
+
+	// the halves either meet between two residues or share an insertion that spans residues mid and mid + 1
+	int32_t best = H[0] + reverseH[0];
+	int32_t bestJ = 0;
+	bool gapJoin = false;
+	for (int32_t j = 0; j <= dbLength; j++) {
+		if (H[j] + reverseH[j] > best) {
+			best = H[j] + reverseH[j];
+			bestJ = j;
+			gapJoin = false;
+		}
+		if (E[j] + reverseE[j] + go > best) {
+			best = E[j] + reverseE[j] + go;
+			bestJ = j;
+			gapJoin = true;
+		}
+	}
+	if (gapJoin) {
+		linear_sw_region<type>(state, qBegin, mid - 1, dbBegin, bestJ, gapBegin, 0);
+		state.ops.push_back('I');
+		state.ops.push_back('I');
+		linear_sw_region<type>(state, qBegin + mid + 1, qLength - mid - 1, dbBegin + bestJ, dbLength - bestJ, 0, gapEnd);
+	} else {
+		linear_sw_region<type>(state, qBegin, mid, dbBegin, bestJ, gapBegin, go);
+		linear_sw_region<type>(state, qBegin + mid, qLength - mid, dbBegin + bestJ, dbLength - bestJ, go, gapEnd);
+	}
+}
+
 uint32_t SmithWaterman::to_cigar_int (uint32_t length, char op_letter)
 {
 	uint32_t res;
@@ -1088,6 +1450,7 @@ s_align SmithWaterman::scoreIdentical(unsigned char *dbSeq, int L, EvalueComputa
 	}
 	r.score1=score;
 	r.evalue = evaluer->computeEvalue(r.score1, profile->query_length);
+	passCounts.identity++;
 
 	return r;
 }
@@ -32,6 +32,7 @@
 #define SMITH_WATERMAN_SSE2_H
 
 #include <climits>
+#include <vector>
 
 #include <cstdio>
 #include <cstdlib>
@@ -123,6 +124,12 @@ public:
      reference loci nearby (mask length = maskLen) the best alignment ending position and locates the second largest
      score from the unmasked elements.
 
+     @param	seqIdMode	sequence identity definition of seqIdThr, see Util::computeSeqId
+
+     @param	seqIdThr	the cigar is not computed if the alignment cannot reach this sequence identity
+
+     @param	expectedScore	predicted score, e.g. of the prefilter; the 8-bit pass is skipped if it would saturate
+
      @return	pointer to the alignment result structure
 
      @note	Whatever the parameter flag is setted, this function will at least return the optimal and sub-optimal alignment score,
@@ -138,8 +145,71 @@ public:
                         const double filters,
                         EvalueComputation * filterd,
                         const int covMode, const float covThr,
-                        const int32_t maskLen);
+                        const int32_t maskLen,
+                        const int seqIdMode = 0, const float seqIdThr = 0.0f,
+                        const int32_t expectedScore = 0);
+
+    // passes run by ssw_align and scoreIdentical, a call counts once for the score and once for every further pass it runs
+    struct PassCounts {
+        // 8-bit score only
+        size_t byteScore;
+        // 16-bit score right away
+        size_t wordScore;
+        // 8-bit score saturated and was repeated with 16 bit
+        size_t saturatedScore;
+        // identical sequences are scored along the main diagonal only
+        size_t identity;
+        size_t startPos;
+        size_t traceback;
+
+        PassCounts() : byteScore(0), wordScore(0), saturatedScore(0), identity(0), startPos(0), traceback(0) {}
+
+        void add(const PassCounts &other) {
+            byteScore += other.byteScore;
+            wordScore += other.wordScore;
+            saturatedScore += other.saturatedScore;
+            identity += other.identity;
+            startPos += other.startPos;
+            traceback += other.traceback;
+        }
+    };
+
+    const PassCounts &getPassCounts() const {
+        return passCounts;
+    }
+
+    // direction matrices of banded_sw above this size in bytes are replaced by the linear memory traceback of linear_sw
+    static const int64_t MAX_BANDED_TRACEBACK_SIZE = 128 * 1024 * 1024;
 
+    // replaces MAX_BANDED_TRACEBACK_SIZE, tests lower it to compare both tracebacks
+    void setMaxBandedTracebackSize(int64_t size) {
+        maxBandedTracebackSize = size;
+    }
+
+
+    // number of targets ssw_score_batch aligns at once, one target per 16 bit lane
+    static const int BATCH_LANES = VECSIZE_INT * 2;
+
+    /*!	@function	Inter-sequence Smith-Waterman, aligns the query against BATCH_LANES targets at once (SWIPE layout).
+     A lane continues with the next target as soon as its target ends.
+
+     @param	db_sequences	pointers to count target sequences; only amino acid sequence queries are supported, not profiles
+
+     @param	scores	receives the best local alignment score of each target
+
+     @note	Only the score is computed. Unlike ssw_align adjacent insertions and deletions are not excluded, so the
+     score is an upper bound of the ssw_align score. Scores saturate at SHRT_MAX.
+
+     @note	The width is fixed at compile time like in ssw_align, it is not part of the runtime dispatch. The target
+     residues are scored with SSSE3/SSE4.1 byte shuffles and blends, builds for older instruction sets use the
+     SIMDe versions of them.
+     */
+    void ssw_score_batch(const unsigned char **db_sequences,
+                         const int32_t *db_lengths,
+                         size_t count,
+                         const uint8_t gap_open,
+                         const uint8_t gap_extend,
+                         int32_t *scores);
 
     /*!	@function computed ungapped alignment score
 
@@ -169,6 +239,9 @@ public:
    -2 -2  2 -2 //G
    -2 -2 -2  2 //T
    mat is the pointer to the array {2, -2, -2, -2, -2, 2, -2, -2, -2, -2, 2, -2, -2, -2, -2, 2}
+   @note	The profiles are built once per query and reused by every ssw_align and ssw_score_batch call until the
+   next ssw_init. Each Matcher owns its SmithWaterman object, so all alignments of a query in one Matcher, e.g.
+   the alternative alignments, share the profiles. A realignment Matcher uses its own matrix and builds its own.
    */
     void ssw_init(const Sequence *q, const int8_t *mat, const BaseMatrix *m, const int8_t score_size);
 
@@ -225,12 +298,28 @@ private:
         uint8_t bias;
         short ** profile_word_linear;
     };
+    // score_size of the last ssw_init
+    int8_t profileScoreSize;
+
+    PassCounts passCounts;
+
     simd_int* vHStore;
     simd_int* vHLoad;
     simd_int* vE;
     simd_int* vHmax;
     uint8_t * maxColumn;
 
+    // ssw_score_batch buffers, one vector per query position
+    simd_int* batchH;
+    simd_int* batchE;
+    simd_int* batchBias;
+    size_t batchCapacity;
+    // scores of the current target residue of every lane, one vector per query residue
+    simd_int* batchProfile;
+    // byte scores of all target residues, two vectors per query residue
+    __m128i* batchTables;
+    std::vector<size_t> batchOrder;
+
     typedef struct {
         uint16_t score;
         int32_t ref;	 //0-based position
@@ -274,9 +363,50 @@ private:
                                  uint16_t terminate,
                                  int32_t maskLen);
 
+    int64_t maxBandedTracebackSize;
+
+    // score rows and output of linear_sw, allocated once per alignment
+    struct LinearSwState {
+        const unsigned char *db_sequence;
+        const int8_t *query_sequence;
+        const int8_t *compositionBias;
+        int32_t queryStart;
+        const int8_t *mat;
+        int32_t n;
+        // a gap of length k costs gapOpen + k * gapExtend
+        int32_t gapOpen;
+        int32_t gapExtend;
+        std::vector<int32_t> H;
+        std::vector<int32_t> E;
+        std::vector<int32_t> reverseH;
+        std::vector<int32_t> reverseE;
+        std::vector<char> ops;
+    };
+
     template <const unsigned int type>
     SmithWaterman::cigar *banded_sw(const unsigned char *db_sequence, const int8_t *query_sequence, const int8_t * compositionBias, int32_t db_length, int32_t query_length, int32_t queryStart, int32_t score, const uint32_t gap_open, const uint32_t gap_extend, int32_t band_width, const int8_t *mat, int32_t n);
 
+    /*!	@function	Global alignment of the region between the start and end positions in linear memory (Myers-Miller).
+     Each recursion step computes the scores of the upper half forward and of the lower half backward
+     and splits the region where the two halves meet with the highest score.
+     @return	cigar of the alignment, the same format as banded_sw
+     */
+    template <const unsigned int type>
+    SmithWaterman::cigar *linear_sw(const unsigned char *db_sequence, const int8_t *query_sequence, const int8_t * compositionBias, int32_t db_length, int32_t query_length, int32_t queryStart, const uint32_t gap_open, const uint32_t gap_extend, const int8_t *mat, int32_t n);
+
+    // aligns query residues qBegin to qBegin + qLength with target residues dbBegin to dbBegin + dbLength,
+    // a leading or trailing insertion costs gapBegin or gapEnd to open
+    template <const unsigned int type>
+    void linear_sw_region(LinearSwState &state, int32_t qBegin, int32_t qLength, int32_t dbBegin, int32_t dbLength, int32_t gapBegin, int32_t gapEnd);
+
+    template <const unsigned int type>
+    static inline int32_t linear_sw_score(const LinearSwState &state, int32_t i, int32_t j) {
+        if (type == PROFILE) {
+            return state.mat[state.db_sequence[j] * state.n + (state.queryStart + i)];
+        }
+        return state.mat[state.query_sequence[i] * state.n + state.db_sequence[j]] + state.compositionBias[i];
+    }
+
     /*!	@function		Produce CIGAR 32-bit unsigned integer from CIGAR operation and CIGAR length
      @param	length		length of CIGAR
      @param	op_letter	CIGAR operation character ('M', 'I', etc)
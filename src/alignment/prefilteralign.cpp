@@ -0,0 +1,48 @@
+#include "Alignment.h"
+#include "Prefiltering.h"
+#include "PrefilteringIndexReader.h"
+#include "Parameters.h"
+#include "FileUtil.h"
+#include "Debug.h"
+#include "Util.h"
+
+int prefilteralign(int argc, const char **argv, const Command& command) {
+    Parameters& par = Parameters::getInstance();
+    par.parseParameters(argc, argv, command, true, 0, MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_ALIGN);
+
+    // the prefilter uses a precomputed index if there is one
+    std::string targetDB = par.db2;
+    int targetDbType = FileUtil::parseDbType(par.db2.c_str());
+    if (Parameters::isEqualDbtype(targetDbType, Parameters::DBTYPE_INDEX_DB) == false) {
+        std::string indexDB = PrefilteringIndexReader::searchForIndex(par.db2);
+        if (indexDB.empty() == false) {
+            targetDB = indexDB;
+        }
+    }
+    if (Parameters::isEqualDbtype(FileUtil::parseDbType(targetDB.c_str()), Parameters::DBTYPE_INDEX_DB)) {
+        DBReader<unsigned int> dbr(targetDB.c_str(), (targetDB + ".index").c_str(), par.threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+        dbr.open(DBReader<unsigned int>::NOSORT);
+        PrefilteringIndexData data = PrefilteringIndexReader::getMetadata(&dbr);
+        targetDbType = data.seqType;
+        dbr.close();
+    }
+
+    int queryDbType = FileUtil::parseDbType(par.db1.c_str());
+    if (queryDbType == -1 || targetDbType == -1) {
+        Debug(Debug::ERROR) << "Please recreate your database or add a .dbtype file to your sequence/profile database.\n";
+        return EXIT_FAILURE;
+    }
+    if (Parameters::isEqualDbtype(queryDbType, Parameters::DBTYPE_HMM_PROFILE) && Parameters::isEqualDbtype(targetDbType, Parameters::DBTYPE_PROFILE_STATE_SEQ)) {
+        queryDbType = Parameters::DBTYPE_PROFILE_STATE_PROFILE;
+    }
+
+    Prefiltering pref(par.db1, par.db1Index, targetDB, targetDB + ".index", queryDbType, targetDbType, par);
+    // no prefilter result DB, the hits are handed over in memory
+    Alignment aln(par.db1, par.db2, "", "", par.db3, par.db3Index, par, false);
+    pref.setAligner(&aln);
+
+    Debug(Debug::INFO) << "Calculation of prefilter hits and alignments\n";
+    pref.runAllSplits(par.db3, par.db3Index);
+
+    return EXIT_SUCCESS;
+}
@@ -45,81 +45,80 @@ void AlignmentSymmetry::readInData(DBReader<unsigned int>*alnDbr, DBReader<unsig
                 if (*data == '\0') { // check if file contains entry
                     elementLookupTable[i][0] = seqDbr->getId(clusterId);
                     if (elementScoreTable != NULL) {
-                        if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_ALIGNMENT_RES)) {
-                            if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
-                                //column 1 = alignment score
-                                elementScoreTable[i][0] = (unsigned short) (USHRT_MAX);
-                            } else {
-                                //column 2 = sequence identity [0-1]
-                                elementScoreTable[i][0] = (unsigned short) (1.0 * 1000.0f);
-                            }
-                        } else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_RES) ||
-                                   Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_REV_RES)) {
-                            //column 1 = alignment score or sequence identity [0-100]
-                            elementScoreTable[i][0] = (unsigned short) (USHRT_MAX);
-                        } else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_CLUSTER_RES)) {
-                            elementScoreTable[i][0] = (unsigned short) (USHRT_MAX);
-                        }
+                        elementScoreTable[i][0] = getSelfScore(alnType, scoretype);
                     }
                     continue;
                 }
                 size_t setSize = LEN(offsets, i);
                 size_t writePos = 0;
-                while (*data != '\0') {
+                forEachResult(data, alnType, scoretype, elementScoreTable != NULL, [&](unsigned int key, unsigned short score) {
                     if (writePos >= setSize) {
                         Debug(Debug::ERROR) << "Set " << i
                                             << " has more elements than allocated (" << setSize
                                             << ")!\n";
-                        continue;
+                        return;
                     }
-                    char similarity[255 + 1];
-                    char dbKey[255 + 1];
-                    Util::parseKey(data, dbKey);
-                    const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
                     const size_t currElement = seqDbr->getId(key);
                     if (elementScoreTable != NULL) {
-                        if (Parameters::isEqualDbtype(alnType,Parameters::DBTYPE_ALIGNMENT_RES)) {
-                            if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
-                                //column 1 = alignment score
-                                Util::parseByColumnNumber(data, similarity, 1);
-                                elementScoreTable[i][writePos] = (unsigned short) (atof(similarity));
-                            } else {
-                                //column 2 = sequence identity [0-1]
-                                Util::parseByColumnNumber(data, similarity, 2);
-                                elementScoreTable[i][writePos] = (unsigned short) (atof(similarity) * 1000.0f);
-                            }
-                        }
-                        else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_RES) ||
-                                 Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_REV_RES)) {
-                            //column 1 = alignment score or sequence identity [0-100]
-                            Util::parseByColumnNumber(data, similarity, 1);
-                            short sim = atoi(similarity);
-                            elementScoreTable[i][writePos] = (unsigned short) (sim >0 ? sim : -sim);
-                        }
-                        else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_CLUSTER_RES)) {
-                            elementScoreTable[i][writePos] = (unsigned short) (USHRT_MAX);
-                        }
-                        else {
-                            Debug(Debug::ERROR) << "Alignment format is not supported!\n";
-                            EXIT(EXIT_FAILURE);
-                        }
-
+                        elementScoreTable[i][writePos] = score;
                     }
                     if (currElement == UINT_MAX || currElement > seqDbr->getSize()) {
-                        Debug(Debug::ERROR) << "Element " << dbKey
+                        Debug(Debug::ERROR) << "Element " << key
                                             << " contained in some alignment list, but not contained in the sequence database!\n";
                         EXIT(EXIT_FAILURE);
                     }
                     elementLookupTable[i][writePos] = currElement;
                     writePos++;
-                    data = Util::skipLine(data);
-                }
+                });
             }
         }
         alnDbr->remapData();
     }
 }
 
+unsigned short AlignmentSymmetry::getSelfScore(int alnType, int scoretype) {
+    const bool isAlignment = Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_ALIGNMENT_RES)
+                             || Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_BINARY_ALIGNMENT_RES);
+    if (isAlignment && scoretype != Parameters::APC_ALIGNMENTSCORE) {
+        //column 2 = sequence identity [0-1]
+        return (unsigned short) (1.0 * 1000.0f);
+    }
+    return (unsigned short) (USHRT_MAX);
+}
+
+unsigned short AlignmentSymmetry::getScore(char *data, int alnType, int scoretype) {
+    char similarity[255 + 1];
+    if (Parameters::isEqualDbtype(alnType,Parameters::DBTYPE_ALIGNMENT_RES)) {
+        if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
+            //column 1 = alignment score
+            Util::parseByColumnNumber(data, similarity, 1);
+            return (unsigned short) (atof(similarity));
+        } else {
+            //column 2 = sequence identity [0-1]
+            Util::parseByColumnNumber(data, similarity, 2);
+            return (unsigned short) (atof(similarity) * 1000.0f);
+        }
+    } else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_RES) ||
+               Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_PREFILTER_REV_RES)) {
+        //column 1 = alignment score or sequence identity [0-100]
+        Util::parseByColumnNumber(data, similarity, 1);
+        short sim = atoi(similarity);
+        return (unsigned short) (sim >0 ? sim : -sim);
+    } else if (Parameters::isEqualDbtype(alnType, Parameters::DBTYPE_CLUSTER_RES)) {
+        return (unsigned short) (USHRT_MAX);
+    }
+    Debug(Debug::ERROR) << "Alignment format is not supported!\n";
+    EXIT(EXIT_FAILURE);
+}
+
+unsigned short AlignmentSymmetry::getScore(const AlignmentRecord &record, int scoretype) {
+    if (scoretype == Parameters::APC_ALIGNMENTSCORE) {
+        return (unsigned short) record.score;
+    }
+    // seqId holds three decimals like the text column, rounding avoids that the float is just below them
+    return (unsigned short) (record.seqId * 1000.0f + 0.5f);
+}
+
 size_t AlignmentSymmetry::findMissingLinks(unsigned int ** elementLookupTable, size_t * offsetTable, size_t dbSize, int threads) {
     // init memory for parallel merge
     unsigned int * tmpSize = new(std::nothrow) unsigned int[threads * dbSize];
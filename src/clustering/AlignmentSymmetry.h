@@ -10,10 +10,42 @@
 #include <Util.h>
 
 #include "DBReader.h"
+#include "AlignmentRecord.h"
 
 class AlignmentSymmetry {
 public:
     static void readInData(DBReader<unsigned int>*pReader, DBReader<unsigned int>*pDBReader, unsigned int **pInt,unsigned short**elementScoreTable, int scoretype, size_t *offsets);
+    static unsigned short getScore(char *data, int alnType, int scoretype);
+    static unsigned short getScore(const AlignmentRecord &record, int scoretype);
+    // score of the sequence itself for empty result entries
+    static unsigned short getSelfScore(int alnType, int scoretype);
+    // number of hits in a text or binary result entry
+    static size_t countResults(const char *data, size_t dataSize) {
+        if (AlignmentRecords::isBinary(data)) {
+            return AlignmentRecords(data).size();
+        }
+        return Util::countLines(data, dataSize);
+    }
+
+    // calls f(key, score) for each hit of a text or binary result entry, the score is only parsed if needed
+    template <typename F>
+    static void forEachResult(char *data, int alnType, int scoretype, bool needScore, F f) {
+        if (AlignmentRecords::isBinary(data)) {
+            AlignmentRecords records(data);
+            for (size_t i = 0; i < records.size(); i++) {
+                f(records[i].dbKey, needScore ? getScore(records[i], scoretype) : 0);
+            }
+            return;
+        }
+        while (*data != '\0') {
+            char dbKey[255 + 1];
+            Util::parseKey(data, dbKey);
+            const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
+            f(key, needScore ? getScore(data, alnType, scoretype) : 0);
+            data = Util::skipLine(data);
+        }
+    }
+
     template<typename T>
     static void computeOffsetFromCounts(T* elementSizes, size_t dbSize)  {
         size_t prevElementLength = elementSizes[0];
@@ -8,10 +8,13 @@
 Clustering::Clustering(const std::string &seqDB, const std::string &seqDBIndex,
                        const std::string &alnDB, const std::string &alnDBIndex,
                        const std::string &outDB, const std::string &outDBIndex,
-                       unsigned int maxIteration, int similarityScoreType, int threads, int compressed) : maxIteration(maxIteration),
+                       unsigned int maxIteration, int similarityScoreType, int threads, int compressed, size_t memoryLimit,
+                       bool parallelSetCover) : maxIteration(maxIteration),
                                                                similarityScoreType(similarityScoreType),
                                                                threads(threads),
                                                                compressed(compressed),
+                                                               memoryLimit(memoryLimit),
+                                                               parallelSetCover(parallelSetCover),
                                                                outDB(outDB),
                                                                outDBIndex(outDBIndex) {
 
@@ -37,7 +40,8 @@ void Clustering::run(int mode) {
     std::pair<unsigned int, unsigned int> * ret;
     ClusteringAlgorithms *algorithm = new ClusteringAlgorithms(seqDbr, alnDbr,
                                                                threads, similarityScoreType,
-                                                               maxIteration);
+                                                               maxIteration, memoryLimit, outDB + "_graph",
+                                                               parallelSetCover);
 
     if (mode == Parameters::GREEDY) {
         Debug(Debug::INFO) << "Clustering mode: Greedy\n";
@@ -58,7 +62,7 @@ void Clustering::run(int mode) {
 
     Timer timerWrite;
 
-    size_t dbSize = alnDbr->getSize();
+    size_t dbSize = seqDbr->getSize();
     size_t seqDbSize = seqDbr->getSize();
     size_t cluNum = (dbSize > 0) ? 1 : 0;
     for(size_t i = 1; i < dbSize; i++){
@@ -66,7 +70,7 @@ void Clustering::run(int mode) {
     }
     Debug(Debug::INFO) << "Total time: " << timer.lap() << "\n";
     Debug(Debug::INFO) << "\nSize of the sequence database: " << seqDbSize << "\n";
-    Debug(Debug::INFO) << "Size of the alignment database: " << dbSize << "\n";
+    Debug(Debug::INFO) << "Size of the alignment database: " << alnDbr->getSize() << "\n";
     Debug(Debug::INFO) << "Number of clusters: " << cluNum << "\n\n";
 
     Debug(Debug::INFO) << "Writing results ";
@@ -3,6 +3,8 @@
 #include "Debug.h"
 #include "AlignmentSymmetry.h"
 #include "Timer.h"
+#include "Parameters.h"
+#include "FileUtil.h"
 
 #include <queue>
 #include <algorithm>
@@ -15,17 +17,26 @@
 #endif
 
 ClusteringAlgorithms::ClusteringAlgorithms(DBReader<unsigned int>* seqDbr, DBReader<unsigned int>* alnDbr,
-                                           int threads, int scoretype, int maxiterations){
+                                           int threads, int scoretype, int maxiterations,
+                                           size_t memoryLimit, const std::string &tmpPrefix, bool parallelSetCover){
     this->seqDbr=seqDbr;
-    if(seqDbr->getSize() != alnDbr->getSize()){
+    isClusterGraph = Parameters::isEqualDbtype(alnDbr->getDbtype(), Parameters::DBTYPE_CLUSTER_GRAPH);
+    if(isClusterGraph == false && seqDbr->getSize() != alnDbr->getSize()){
         Debug(Debug::ERROR) << "Sequence db size != result db size\n";
         EXIT(EXIT_FAILURE);
     }
     this->alnDbr=alnDbr;
-    this->dbSize=alnDbr->getSize();
+    this->dbSize=seqDbr->getSize();
     this->threads=threads;
     this->scoretype=scoretype;
     this->maxiterations=maxiterations;
+    this->memoryLimit=memoryLimit;
+    this->tmpPrefix=tmpPrefix;
+    this->parallelSetCover=parallelSetCover;
+    // the size buckets are only built for the sequential set cover and connected components
+    this->sorted_clustersizes=NULL;
+    this->clusterid_to_arrayposition=NULL;
+    this->borders_of_set=NULL;
     ///time
     this->clustersizes=new int[dbSize];
     std::fill_n(clustersizes, dbSize, 0);
@@ -44,83 +55,73 @@ std::pair<unsigned int, unsigned int> * ClusteringAlgorithms::execute(int mode)
 
     //time
     if (mode==4 || mode==2) {
+        if (isClusterGraph) {
+            Debug(Debug::ERROR) << "Greedy clustering needs the alignment result DB, the cluster graph is symmetric\n";
+            EXIT(EXIT_FAILURE);
+        }
         greedyIncrementalLowMem(assignedcluster);
     }else {
         size_t elementCount = 0;
-#pragma omp parallel reduction (+:elementCount)
-        {
-            int thread_idx = 0;
-#ifdef OPENMP
-            thread_idx = omp_get_thread_num();
-#endif
-#pragma omp for schedule(dynamic, 10)
-            for (size_t i = 0; i < alnDbr->getSize(); i++) {
-                const char *data = alnDbr->getData(i, thread_idx);
-                const size_t dataSize = alnDbr->getEntryLen(i);
-                elementCount += (*data == '\0') ? 1 : Util::countLines(data, dataSize);
-            }
+        bool useExternalMemory = false;
+        if (isClusterGraph == false) {
+            elementCount = countElements();
+            // readInClusterData keeps the parsed and the symmetric neighbor lists (at most twice as long) at once
+            const size_t memoryNeeded = elementCount * (3 * sizeof(unsigned int) + 2 * sizeof(unsigned short))
+                                        + dbSize * (4 * sizeof(size_t) + sizeof(uint64_t) + 8 * sizeof(unsigned int));
+            useExternalMemory = memoryLimit > 0 && memoryNeeded > memoryLimit;
         }
-        unsigned int * elements = new(std::nothrow) unsigned int[elementCount];
-        Util::checkAllocation(elements, "Can not allocate elements memory in ClusteringAlgorithms::execute");
-        unsigned int ** elementLookupTable = new(std::nothrow) unsigned int*[dbSize];
-        Util::checkAllocation(elementLookupTable, "Can not allocate elementLookupTable memory in ClusteringAlgorithms::execute");
-        unsigned short **scoreLookupTable = new(std::nothrow) unsigned short *[dbSize];
-        Util::checkAllocation(scoreLookupTable, "Can not allocate scoreLookupTable memory in ClusteringAlgorithms::execute");
-        unsigned short *score = NULL;
-        size_t *elementOffsets = new(std::nothrow) size_t[dbSize + 1];
-        Util::checkAllocation(elementOffsets, "Can not allocate elementOffsets memory in ClusteringAlgorithms::execute");
-        elementOffsets[dbSize] = 0;
-        short *bestscore = new(std::nothrow) short[dbSize];
-        Util::checkAllocation(bestscore, "Can not allocate bestscore memory in ClusteringAlgorithms::execute");
-        std::fill_n(bestscore, dbSize, SHRT_MIN);
-
-        readInClusterData(elementLookupTable, elements, scoreLookupTable, score, elementOffsets, elementCount);
-        ClusteringAlgorithms::initClustersizes();
-        if (mode == 1) {
-            setCover(elementLookupTable, scoreLookupTable, assignedcluster, bestscore, elementOffsets);
-        } else if (mode == 3) {
-            Debug(Debug::INFO) << "connected component mode" << "\n";
-            for (int cl_size = dbSize - 1; cl_size >= 0; cl_size--) {
-                unsigned int representative = sorted_clustersizes[cl_size];
-                if (assignedcluster[representative] == UINT_MAX) {
-                    assignedcluster[representative] = representative;
-                    std::queue<int> myqueue;
-                    myqueue.push(representative);
-                    std::queue<int> iterationcutoffs;
-                    iterationcutoffs.push(0);
-                    //delete clusters of members;
-                    while (!myqueue.empty()) {
-                        int currentid = myqueue.front();
-                        int iterationcutoff = iterationcutoffs.front();
-                        assignedcluster[currentid] = representative;
-                        myqueue.pop();
-                        iterationcutoffs.pop();
-                        size_t elementSize = (elementOffsets[currentid + 1] - elementOffsets[currentid]);
-                        for (size_t elementId = 0; elementId < elementSize; elementId++) {
-                            unsigned int elementtodelete = elementLookupTable[currentid][elementId];
-                            if (assignedcluster[elementtodelete] == UINT_MAX && iterationcutoff < maxiterations) {
-                                myqueue.push(elementtodelete);
-                                iterationcutoffs.push((iterationcutoff + 1));
-                            }
-                            assignedcluster[elementtodelete] = representative;
-                        }
-                    }
+        if (useExternalMemory) {
+            clusterExternalMemory(mode, assignedcluster, elementCount);
+        } else {
+            unsigned int * elements = NULL;
+            unsigned int ** elementLookupTable = new(std::nothrow) unsigned int*[dbSize];
+            Util::checkAllocation(elementLookupTable, "Can not allocate elementLookupTable memory in ClusteringAlgorithms::execute");
+            unsigned short **scoreLookupTable = new(std::nothrow) unsigned short *[dbSize];
+            Util::checkAllocation(scoreLookupTable, "Can not allocate scoreLookupTable memory in ClusteringAlgorithms::execute");
+            unsigned short *score = NULL;
+            size_t *elementOffsets = new(std::nothrow) size_t[dbSize + 1];
+            Util::checkAllocation(elementOffsets, "Can not allocate elementOffsets memory in ClusteringAlgorithms::execute");
+            elementOffsets[dbSize] = 0;
+            short *bestscore = new(std::nothrow) short[dbSize];
+            Util::checkAllocation(bestscore, "Can not allocate bestscore memory in ClusteringAlgorithms::execute");
+            std::fill_n(bestscore, dbSize, SHRT_MIN);
 
-                }
+            if (isClusterGraph) {
+                mapClusterGraph(elementLookupTable, scoreLookupTable, elementOffsets);
+            } else {
+                elements = new(std::nothrow) unsigned int[elementCount];
+                Util::checkAllocation(elements, "Can not allocate elements memory in ClusteringAlgorithms::execute");
+                readInClusterData(elementLookupTable, elements, scoreLookupTable, score, elementOffsets, elementCount);
             }
-        }
-        //delete unnecessary datastructures
-        delete [] sorted_clustersizes;
-        delete [] clusterid_to_arrayposition;
-        delete [] borders_of_set;
+            ClusterGraphPartition graph;
+            graph.start = 0;
+            graph.end = dbSize;
+            graph.elementLookupTable = elementLookupTable;
+            graph.scoreLookupTable = scoreLookupTable;
+            graph.elementOffsets = elementOffsets;
+            if (mode == 1 && parallelSetCover) {
+                parallelSetCoverRounds(&graph, assignedcluster, bestscore);
+            } else if (mode == 1) {
+                ClusteringAlgorithms::initClustersizes();
+                setCover(graph, assignedcluster, bestscore);
+            } else if (mode == 3) {
+                Debug(Debug::INFO) << "connected component mode" << "\n";
+                ClusteringAlgorithms::initClustersizes();
+                connectedComponents(&graph, assignedcluster);
+            }
+            //delete unnecessary datastructures
+            delete [] sorted_clustersizes;
+            delete [] clusterid_to_arrayposition;
+            delete [] borders_of_set;
 
 
-        delete [] elementLookupTable;
-        delete [] elements;
-        delete [] elementOffsets;
-        delete [] scoreLookupTable;
-        delete [] score;
-        delete [] bestscore;
+            delete [] elementLookupTable;
+            delete [] elements;
+            delete [] elementOffsets;
+            delete [] scoreLookupTable;
+            delete [] score;
+            delete [] bestscore;
+        }
     }
 
 
@@ -201,29 +202,27 @@ void ClusteringAlgorithms::decreaseClustersize(unsigned int clusterid){
     clustersizes[clusterid]--;
 }
 
-void ClusteringAlgorithms::setCover(unsigned int **elementLookupTable, unsigned short ** elementScoreLookupTable,
-                                    unsigned int *assignedcluster, short *bestscore, size_t *newElementOffsets) {
+void ClusteringAlgorithms::setCover(const ClusterGraphPartition &graph, unsigned int *assignedcluster, short *bestscore) {
+    unsigned int **elementLookupTable = graph.elementLookupTable;
+    unsigned short **elementScoreLookupTable = graph.scoreLookupTable;
+    const size_t *newElementOffsets = graph.elementOffsets;
     for (int64_t cl_size = dbSize - 1; cl_size >= 0; cl_size--) {
         const unsigned int representative = sorted_clustersizes[cl_size];
         if (representative == UINT_MAX) {
             continue;
         }
-//          Debug(Debug::INFO)<<alnDbr->getDbKey(representative)<<"\n";
         removeClustersize(representative);
         assignedcluster[representative] = representative;
         //delete clusters of members;
         size_t elementSize = (newElementOffsets[representative + 1] - newElementOffsets[representative]);
         for (size_t elementId = 0; elementId < elementSize; elementId++) {
             const unsigned int elementtodelete = elementLookupTable[representative][elementId];
-            // float seqId = elementScoreTable[representative][elementId];
             const short seqId = elementScoreLookupTable[representative][elementId];
-            //  Debug(Debug::INFO)<<seqId<<"\t"<<bestscore[elementtodelete]<<"\n";
             // becareful of this criteria
             if (seqId > bestscore[elementtodelete]) {
                 assignedcluster[elementtodelete] = representative;
                 bestscore[elementtodelete] = seqId;
             }
-            //Debug(Debug::INFO)<<bestscore[elementtodelete]<<"\n";
             if (elementtodelete == representative) {
                 continue;
             }
@@ -268,6 +267,466 @@ void ClusteringAlgorithms::setCover(unsigned int **elementLookupTable, unsigned
     }
 }
 
+
+static inline void updateMaxKey(uint64_t *target, uint64_t key) {
+    uint64_t current;
+    __atomic_load(target, &current, __ATOMIC_RELAXED);
+    while (current < key && !__atomic_compare_exchange(target, &current, &key, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// range of the sorted ids that belong to the partition
+static std::pair<size_t, size_t> getPartitionRange(const std::vector<unsigned int> &ids, const ClusterGraphPartition &partition) {
+    const size_t from = std::lower_bound(ids.begin(), ids.end(), partition.start) - ids.begin();
+    const size_t to = std::lower_bound(ids.begin() + from, ids.end(), partition.end) - ids.begin();
+    return std::make_pair(from, to);
+}
+
+template <typename Function>
+void ClusteringAlgorithms::forEachPartition(ClusterGraphPartition *graph, Function function) {
+    if (graph != NULL) {
+        function(*graph);
+        return;
+    }
+    for (size_t i = 0; i < partitionFiles.size(); i++) {
+        ClusterGraphPartition partition;
+        readGraphPartition(i, partition);
+        function(partition);
+        // the first neighbor list starts at the begin of the partition buffers
+        delete[] partition.elementLookupTable[0];
+        delete[] partition.scoreLookupTable[0];
+        delete[] partition.elementLookupTable;
+        delete[] partition.scoreLookupTable;
+        delete[] partition.elementOffsets;
+    }
+}
+
+// sets are picked by size, ties go to the smaller id, i.e. the longer sequence
+static inline uint64_t getSetCoverKey(int clustersize, unsigned int id) {
+    return (static_cast<uint64_t>(clustersize) << 32) | (UINT_MAX - id);
+}
+
+// a round that picks fewer representatives than this fraction of its candidates ends the rounds
+const size_t MIN_SET_COVER_ROUND_FRACTION = 100;
+
+// Greedy set cover that picks many representatives per round. A candidate is picked once it has the largest key
+// (set size, then the smaller id, i.e. the longer sequence) among all candidates within two edges. Such picks share
+// no member and do not change each others set size, so the result is the same as picking the single largest set one
+// after another. Each step of a round only needs the neighbor lists of a sorted id list, so the graph can be
+// streamed partition by partition.
+// Ties between sets of the same size differ from setCover, which follows the order of its size buckets. That order
+// depends on the order of earlier updates and cannot be reproduced by independent picks, so the rounds are only used
+// with --parallel-set-cover or if the graph does not fit into memory.
+// Long chains of overlapping sets only lose one representative per round. Once a round picks less than
+// 1/MIN_SET_COVER_ROUND_FRACTION of the candidates, the rest is picked by greedySetCover. On disk this needs the
+// neighbor lists of the remaining candidates to fit into memory, otherwise the rounds continue.
+void ClusteringAlgorithms::parallelSetCoverRounds(ClusterGraphPartition *graph, unsigned int *assignedcluster, short *bestscore) {
+    // a sequence is removed once it is a representative or a member of a representative
+    char *removed = new(std::nothrow) char[dbSize];
+    Util::checkAllocation(removed, "Can not allocate removed memory in ClusteringAlgorithms::parallelSetCoverRounds");
+    std::fill_n(removed, dbSize, 0);
+    // largest key of the candidates that contain the sequence
+    uint64_t *neighborMaxKey = new(std::nothrow) uint64_t[dbSize];
+    Util::checkAllocation(neighborMaxKey, "Can not allocate neighborMaxKey memory in ClusteringAlgorithms::parallelSetCoverRounds");
+    std::fill_n(neighborMaxKey, dbSize, 0);
+
+    std::vector<unsigned int> candidates(dbSize);
+    for (unsigned int i = 0; i < dbSize; i++) {
+        candidates[i] = i;
+    }
+    std::vector<unsigned int> representatives;
+    std::vector<unsigned int> members;
+    size_t rounds = 0;
+    while (candidates.empty() == false) {
+        forEachPartition(graph, [&](const ClusterGraphPartition &partition) {
+            const std::pair<size_t, size_t> range = getPartitionRange(candidates, partition);
+#pragma omp parallel for schedule(dynamic, 1000)
+            for (size_t i = range.first; i < range.second; i++) {
+                const unsigned int candidate = candidates[i];
+                const uint64_t key = getSetCoverKey(clustersizes[candidate], candidate);
+                updateMaxKey(&neighborMaxKey[candidate], key);
+                const unsigned int *elements = partition.elementLookupTable[candidate - partition.start];
+                const size_t elementSize = partition.elementOffsets[candidate - partition.start + 1] - partition.elementOffsets[candidate - partition.start];
+                for (size_t elementId = 0; elementId < elementSize; elementId++) {
+                    updateMaxKey(&neighborMaxKey[elements[elementId]], key);
+                }
+            }
+        });
+
+        representatives.clear();
+        forEachPartition(graph, [&](const ClusterGraphPartition &partition) {
+            const std::pair<size_t, size_t> range = getPartitionRange(candidates, partition);
+#pragma omp parallel
+            {
+                std::vector<unsigned int> threadRepresentatives;
+#pragma omp for schedule(dynamic, 1000) nowait
+                for (size_t i = range.first; i < range.second; i++) {
+                    const unsigned int candidate = candidates[i];
+                    const uint64_t key = getSetCoverKey(clustersizes[candidate], candidate);
+                    bool isLargest = (neighborMaxKey[candidate] == key);
+                    const unsigned int *elements = partition.elementLookupTable[candidate - partition.start];
+                    const size_t elementSize = partition.elementOffsets[candidate - partition.start + 1] - partition.elementOffsets[candidate - partition.start];
+                    for (size_t elementId = 0; isLargest && elementId < elementSize; elementId++) {
+                        isLargest = (neighborMaxKey[elements[elementId]] == key);
+                    }
+                    if (isLargest) {
+                        threadRepresentatives.push_back(candidate);
+                    }
+                }
+#pragma omp critical
+                representatives.insert(representatives.end(), threadRepresentatives.begin(), threadRepresentatives.end());
+            }
+        });
+
+        std::fill_n(neighborMaxKey, dbSize, 0);
+
+        // representatives of a round have disjoint members
+        SORT_PARALLEL(representatives.begin(), representatives.end());
+        members.clear();
+        forEachPartition(graph, [&](const ClusterGraphPartition &partition) {
+            const std::pair<size_t, size_t> range = getPartitionRange(representatives, partition);
+#pragma omp parallel
+            {
+                std::vector<unsigned int> threadMembers;
+#pragma omp for schedule(dynamic, 100) nowait
+                for (size_t i = range.first; i < range.second; i++) {
+                    const unsigned int representative = representatives[i];
+                    removed[representative] = 1;
+                    assignedcluster[representative] = representative;
+                    const unsigned int *elements = partition.elementLookupTable[representative - partition.start];
+                    const unsigned short *scores = partition.scoreLookupTable[representative - partition.start];
+                    const size_t elementSize = partition.elementOffsets[representative - partition.start + 1] - partition.elementOffsets[representative - partition.start];
+                    for (size_t elementId = 0; elementId < elementSize; elementId++) {
+                        const unsigned int element = elements[elementId];
+                        const short seqId = scores[elementId];
+                        // becareful of this criteria
+                        if (seqId > bestscore[element]) {
+                            assignedcluster[element] = representative;
+                            bestscore[element] = seqId;
+                        }
+                        if (element == representative || removed[element]) {
+                            continue;
+                        }
+                        removed[element] = 1;
+                        threadMembers.push_back(element);
+                    }
+                }
+#pragma omp critical
+                members.insert(members.end(), threadMembers.begin(), threadMembers.end());
+            }
+        });
+
+        // decrease the set size of remaining candidates that contain a new member
+        SORT_PARALLEL(members.begin(), members.end());
+        forEachPartition(graph, [&](const ClusterGraphPartition &partition) {
+            const std::pair<size_t, size_t> range = getPartitionRange(members, partition);
+#pragma omp parallel for schedule(dynamic, 100)
+            for (size_t i = range.first; i < range.second; i++) {
+                const unsigned int member = members[i];
+                const unsigned int *elements = partition.elementLookupTable[member - partition.start];
+                const size_t elementSize = partition.elementOffsets[member - partition.start + 1] - partition.elementOffsets[member - partition.start];
+                for (size_t elementId = 0; elementId < elementSize; elementId++) {
+                    const unsigned int element = elements[elementId];
+                    if (removed[element] == 0) {
+                        __sync_fetch_and_sub(&clustersizes[element], 1);
+                    }
+                }
+            }
+        });
+
+        const size_t roundCandidates = candidates.size();
+        size_t writePos = 0;
+        for (size_t i = 0; i < candidates.size(); i++) {
+            if (removed[candidates[i]] == 0) {
+                candidates[writePos++] = candidates[i];
+            }
+        }
+        candidates.resize(writePos);
+        rounds++;
+        if (candidates.empty() == false && representatives.size() < roundCandidates / MIN_SET_COVER_ROUND_FRACTION) {
+            if (graph != NULL) {
+                Debug(Debug::INFO) << "Set cover picks the last " << candidates.size() << " candidates one after another\n";
+                greedySetCover(*graph, false, candidates, removed, assignedcluster, bestscore);
+                break;
+            }
+            ClusterGraphPartition candidateGraph;
+            if (readCandidateGraph(candidates, candidateGraph)) {
+                Debug(Debug::INFO) << "Set cover picks the last " << candidates.size() << " candidates one after another\n";
+                greedySetCover(candidateGraph, true, candidates, removed, assignedcluster, bestscore);
+                delete[] candidateGraph.elementLookupTable[0];
+                delete[] candidateGraph.scoreLookupTable[0];
+                delete[] candidateGraph.elementLookupTable;
+                delete[] candidateGraph.scoreLookupTable;
+                delete[] candidateGraph.elementOffsets;
+                break;
+            }
+        }
+    }
+    Debug(Debug::INFO) << "Set cover finished after " << rounds << " rounds\n";
+    delete[] neighborMaxKey;
+    delete[] removed;
+}
+
+// set cover state per sequence that stays in memory next to the graph
+static size_t getSetCoverStateMemory(size_t dbSize) {
+    return dbSize * (sizeof(int) + sizeof(uint64_t) + sizeof(short) + sizeof(char) + 8 * sizeof(unsigned int));
+}
+
+bool ClusteringAlgorithms::readCandidateGraph(const std::vector<unsigned int> &candidates, ClusterGraphPartition &graph) {
+    size_t *offsets = new(std::nothrow) size_t[candidates.size() + 1];
+    Util::checkAllocation(offsets, "Can not allocate offsets memory in ClusteringAlgorithms::readCandidateGraph");
+    offsets[0] = 0;
+    forEachPartition(NULL, [&](const ClusterGraphPartition &partition) {
+        const std::pair<size_t, size_t> range = getPartitionRange(candidates, partition);
+        for (size_t i = range.first; i < range.second; i++) {
+            const size_t id = candidates[i] - partition.start;
+            offsets[i + 1] = partition.elementOffsets[id + 1] - partition.elementOffsets[id];
+        }
+    });
+    for (size_t i = 0; i < candidates.size(); i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    const size_t elementCount = offsets[candidates.size()];
+    // greedySetCover keeps one queue entry per candidate
+    const size_t memoryNeeded = elementCount * (sizeof(unsigned int) + sizeof(unsigned short))
+                                + candidates.size() * (sizeof(size_t) + sizeof(uint64_t) + sizeof(unsigned int *) + sizeof(unsigned short *));
+    if (memoryNeeded + getSetCoverStateMemory(dbSize) > memoryLimit) {
+        delete[] offsets;
+        return false;
+    }
+    unsigned int *elements = new(std::nothrow) unsigned int[elementCount];
+    Util::checkAllocation(elements, "Can not allocate elements memory in ClusteringAlgorithms::readCandidateGraph");
+    unsigned short *scores = new(std::nothrow) unsigned short[elementCount];
+    Util::checkAllocation(scores, "Can not allocate scores memory in ClusteringAlgorithms::readCandidateGraph");
+    forEachPartition(NULL, [&](const ClusterGraphPartition &partition) {
+        const std::pair<size_t, size_t> range = getPartitionRange(candidates, partition);
+        for (size_t i = range.first; i < range.second; i++) {
+            const size_t id = candidates[i] - partition.start;
+            const size_t elementSize = offsets[i + 1] - offsets[i];
+            memcpy(elements + offsets[i], partition.elementLookupTable[id], elementSize * sizeof(unsigned int));
+            memcpy(scores + offsets[i], partition.scoreLookupTable[id], elementSize * sizeof(unsigned short));
+        }
+    });
+    graph.start = 0;
+    graph.end = candidates.size();
+    graph.elementOffsets = offsets;
+    graph.elementLookupTable = new(std::nothrow) unsigned int*[candidates.size()];
+    Util::checkAllocation(graph.elementLookupTable, "Can not allocate elementLookupTable memory in ClusteringAlgorithms::readCandidateGraph");
+    graph.scoreLookupTable = new(std::nothrow) unsigned short*[candidates.size()];
+    Util::checkAllocation(graph.scoreLookupTable, "Can not allocate scoreLookupTable memory in ClusteringAlgorithms::readCandidateGraph");
+    AlignmentSymmetry::setupPointers<unsigned int>(elements, graph.elementLookupTable, offsets, candidates.size(), elementCount);
+    AlignmentSymmetry::setupPointers<unsigned short>(scores, graph.scoreLookupTable, offsets, candidates.size(), elementCount);
+    return true;
+}
+
+void ClusteringAlgorithms::greedySetCover(const ClusterGraphPartition &graph, bool isCandidateGraph, const std::vector<unsigned int> &candidates,
+                                          char *removed, unsigned int *assignedcluster, short *bestscore) {
+    // representatives and new members are always remaining candidates
+    auto getIndex = [&](unsigned int id) -> size_t {
+        if (isCandidateGraph) {
+            return std::lower_bound(candidates.begin(), candidates.end(), id) - candidates.begin();
+        }
+        return id - graph.start;
+    };
+    // set sizes only decrease, an outdated key is pushed again with the current size once it reaches the top
+    std::priority_queue<uint64_t> queue;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        queue.push(getSetCoverKey(clustersizes[candidates[i]], candidates[i]));
+    }
+    std::vector<unsigned int> members;
+    while (queue.empty() == false) {
+        const uint64_t key = queue.top();
+        queue.pop();
+        const unsigned int representative = UINT_MAX - static_cast<unsigned int>(key & UINT_MAX);
+        if (removed[representative]) {
+            continue;
+        }
+        const uint64_t currentKey = getSetCoverKey(clustersizes[representative], representative);
+        if (currentKey != key) {
+            queue.push(currentKey);
+            continue;
+        }
+        removed[representative] = 1;
+        assignedcluster[representative] = representative;
+        const size_t index = getIndex(representative);
+        const unsigned int *elements = graph.elementLookupTable[index];
+        const unsigned short *scores = graph.scoreLookupTable[index];
+        const size_t elementSize = graph.elementOffsets[index + 1] - graph.elementOffsets[index];
+        members.clear();
+        for (size_t elementId = 0; elementId < elementSize; elementId++) {
+            const unsigned int element = elements[elementId];
+            const short seqId = scores[elementId];
+            // becareful of this criteria
+            if (seqId > bestscore[element]) {
+                assignedcluster[element] = representative;
+                bestscore[element] = seqId;
+            }
+            if (element == representative || removed[element]) {
+                continue;
+            }
+            removed[element] = 1;
+            members.push_back(element);
+        }
+        for (size_t i = 0; i < members.size(); i++) {
+            const size_t memberIndex = getIndex(members[i]);
+            const unsigned int *memberElements = graph.elementLookupTable[memberIndex];
+            const size_t memberSize = graph.elementOffsets[memberIndex + 1] - graph.elementOffsets[memberIndex];
+            for (size_t elementId = 0; elementId < memberSize; elementId++) {
+                if (removed[memberElements[elementId]] == 0) {
+                    clustersizes[memberElements[elementId]]--;
+                }
+            }
+        }
+    }
+}
+
+static unsigned int findComponentRoot(unsigned int *parent, unsigned int id) {
+    unsigned int next = __atomic_load_n(&parent[id], __ATOMIC_RELAXED);
+    while (next != id) {
+        // path halving, a failed exchange only skips the shortcut
+        unsigned int nextNext = __atomic_load_n(&parent[next], __ATOMIC_RELAXED);
+        if (nextNext != next) {
+            __atomic_compare_exchange_n(&parent[id], &next, nextNext, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+        id = next;
+        next = __atomic_load_n(&parent[id], __ATOMIC_RELAXED);
+    }
+    return id;
+}
+
+static void uniteComponents(unsigned int *parent, unsigned int first, unsigned int second) {
+    while (true) {
+        first = findComponentRoot(parent, first);
+        second = findComponentRoot(parent, second);
+        if (first == second) {
+            return;
+        }
+        // the smaller id stays the root, linking only succeeds while the larger one is still a root
+        if (first > second) {
+            std::swap(first, second);
+        }
+        unsigned int expected = second;
+        if (__atomic_compare_exchange_n(&parent[second], &expected, first, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+}
+
+// Connected components are found with a concurrent union-find. A breadth first search from the largest set only
+// reaches sequences of its own component, so components are independent of each other. If a component has at most
+// maxiterations + 1 members the depth limit cannot cut it and all members belong to the first representative of
+// the search. Only larger components are searched, each by one thread in the order of the set sizes. The search
+// needs random access to the neighbor lists, with the partitions on disk every component goes to its largest set.
+void ClusteringAlgorithms::connectedComponents(ClusterGraphPartition *graph, unsigned int *assignedcluster) {
+    unsigned int *parent = new(std::nothrow) unsigned int[dbSize];
+    Util::checkAllocation(parent, "Can not allocate parent memory in ClusteringAlgorithms::connectedComponents");
+    unsigned int *componentSize = new(std::nothrow) unsigned int[dbSize];
+    Util::checkAllocation(componentSize, "Can not allocate componentSize memory in ClusteringAlgorithms::connectedComponents");
+    // position of the largest set of the component in sorted_clustersizes
+    unsigned int *firstPosition = new(std::nothrow) unsigned int[dbSize];
+    Util::checkAllocation(firstPosition, "Can not allocate firstPosition memory in ClusteringAlgorithms::connectedComponents");
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < dbSize; i++) {
+        parent[i] = i;
+        componentSize[i] = 0;
+        firstPosition[i] = 0;
+    }
+
+    forEachPartition(graph, [&](const ClusterGraphPartition &partition) {
+#pragma omp parallel for schedule(dynamic, 1000)
+        for (size_t i = partition.start; i < partition.end; i++) {
+            const unsigned int *elements = partition.elementLookupTable[i - partition.start];
+            const size_t elementSize = partition.elementOffsets[i - partition.start + 1] - partition.elementOffsets[i - partition.start];
+            for (size_t elementId = 0; elementId < elementSize; elementId++) {
+                const unsigned int element = elements[elementId];
+                if (element != i) {
+                    uniteComponents(parent, i, element);
+                }
+            }
+        }
+    });
+
+    // without random access to the neighbor lists the depth limit cannot be applied
+    const unsigned int maxSearchFreeSize = (graph != NULL) ? static_cast<unsigned int>(maxiterations) + 1 : UINT_MAX;
+#pragma omp parallel
+    {
+#pragma omp for schedule(static)
+        for (size_t i = 0; i < dbSize; i++) {
+            const unsigned int root = findComponentRoot(parent, i);
+            __sync_fetch_and_add(&componentSize[root], 1);
+            const unsigned int position = clusterid_to_arrayposition[i];
+            unsigned int current = __atomic_load_n(&firstPosition[root], __ATOMIC_RELAXED);
+            while (current < position && !__atomic_compare_exchange_n(&firstPosition[root], &current, position, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+        }
+
+#pragma omp for schedule(static)
+        for (size_t i = 0; i < dbSize; i++) {
+            const unsigned int root = findComponentRoot(parent, i);
+            if (componentSize[root] <= maxSearchFreeSize) {
+                assignedcluster[i] = sorted_clustersizes[firstPosition[root]];
+            }
+        }
+    }
+
+    // collect the sets of the large components in the order of the sequential search
+    std::vector<unsigned int> largeComponents;
+    std::unordered_map<unsigned int, std::vector<unsigned int>> componentSeeds;
+    for (int64_t cl_size = dbSize - 1; cl_size >= 0; cl_size--) {
+        const unsigned int id = sorted_clustersizes[cl_size];
+        const unsigned int root = findComponentRoot(parent, id);
+        if (componentSize[root] > maxSearchFreeSize) {
+            std::vector<unsigned int> &seeds = componentSeeds[root];
+            if (seeds.empty()) {
+                largeComponents.push_back(root);
+            }
+            seeds.push_back(id);
+        }
+    }
+    if (largeComponents.empty() == false) {
+        Debug(Debug::INFO) << largeComponents.size() << " components are larger than the maximum depth\n";
+    }
+    if (graph == NULL) {
+        size_t cutComponents = 0;
+        for (size_t i = 0; i < dbSize; i++) {
+            cutComponents += (parent[i] == i && componentSize[i] > static_cast<unsigned int>(maxiterations) + 1);
+        }
+        if (cutComponents > 0) {
+            Debug(Debug::WARNING) << "--max-iterations is not applied to " << cutComponents << " components since the graph is processed in partitions\n";
+        }
+    }
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (size_t i = 0; i < largeComponents.size(); i++) {
+        const std::vector<unsigned int> &seeds = componentSeeds.at(largeComponents[i]);
+        std::queue<std::pair<unsigned int, int>> myqueue;
+        for (size_t seedIdx = 0; seedIdx < seeds.size(); seedIdx++) {
+            const unsigned int representative = seeds[seedIdx];
+            if (assignedcluster[representative] != UINT_MAX) {
+                continue;
+            }
+            assignedcluster[representative] = representative;
+            myqueue.push(std::make_pair(representative, 0));
+            //delete clusters of members;
+            while (!myqueue.empty()) {
+                const unsigned int currentid = myqueue.front().first;
+                const int iterationcutoff = myqueue.front().second;
+                assignedcluster[currentid] = representative;
+                myqueue.pop();
+                const size_t elementSize = (graph->elementOffsets[currentid + 1] - graph->elementOffsets[currentid]);
+                for (size_t elementId = 0; elementId < elementSize; elementId++) {
+                    const unsigned int elementtodelete = graph->elementLookupTable[currentid][elementId];
+                    if (assignedcluster[elementtodelete] == UINT_MAX && iterationcutoff < maxiterations) {
+                        myqueue.push(std::make_pair(elementtodelete, iterationcutoff + 1));
+                    }
+                    assignedcluster[elementtodelete] = representative;
+                }
+            }
+        }
+    }
+    delete[] firstPosition;
+    delete[] componentSize;
+    delete[] parent;
+}
+
 void ClusteringAlgorithms::greedyIncrementalLowMem( unsigned int *assignedcluster) {
     // two step clustering
     // 1.) we define the rep. sequences by minimizing the ids (smaller ID = longer sequence)
@@ -296,11 +755,7 @@ void ClusteringAlgorithms::greedyIncrementalLowMem( unsigned int *assignedcluste
             const size_t alnId = alnDbr->getId(clusterKey);
             char *data = alnDbr->getData(alnId, thread_idx);
 
-            while (*data != '\0') {
-                char dbKey[255 + 1];
-                Util::parseKey(data, dbKey);
-                const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
-
+            AlignmentSymmetry::forEachResult(data, alnDbr->getDbtype(), 0, false, [&](unsigned int key, unsigned short) {
                 unsigned int currElement = seqDbr->getId(key);
                 unsigned int targetId;
 
@@ -310,12 +765,11 @@ void ClusteringAlgorithms::greedyIncrementalLowMem( unsigned int *assignedcluste
                 } while (!__atomic_compare_exchange(&assignedcluster[currElement],  &targetId,  &clusterId , false,  __ATOMIC_RELAXED, __ATOMIC_RELAXED));
 
                 if (currElement == UINT_MAX || currElement > seqDbr->getSize()) {
-                    Debug(Debug::ERROR) << "Element " << dbKey
+                    Debug(Debug::ERROR) << "Element " << key
                                         << " contained in some alignment list, but not contained in the sequence database!\n";
                     EXIT(EXIT_FAILURE);
                 }
-                data = Util::skipLine(data);
-            }
+            });
         }
     }
 
@@ -331,6 +785,416 @@ void ClusteringAlgorithms::greedyIncrementalLowMem( unsigned int *assignedcluste
 
 }
 
+// edge of the symmetric graph while the partitions are built
+struct ClusterGraphEdge {
+    unsigned int id;
+    unsigned int neighbor;
+    unsigned short score;
+    // 1 if the edge is in the result entry of id, 0 if it was only added to make the graph symmetric
+    unsigned short isResult;
+
+    static bool compareByIdAndNeighbor(const ClusterGraphEdge &first, const ClusterGraphEdge &second) {
+        if (first.id != second.id) {
+            return first.id < second.id;
+        }
+        if (first.neighbor != second.neighbor) {
+            return first.neighbor < second.neighbor;
+        }
+        return first.isResult > second.isResult;
+    }
+};
+
+static size_t getPartition(const std::vector<size_t> &partitionStarts, size_t id) {
+    return std::upper_bound(partitionStarts.begin(), partitionStarts.end(), id) - partitionStarts.begin() - 1;
+}
+
+static void writePartitionData(FILE *file, const void *data, size_t size, const std::string &fileName) {
+    if (size > 0 && fwrite(data, size, 1, file) != 1) {
+        Debug(Debug::ERROR) << "Cannot write to " << fileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+static void readPartitionData(FILE *file, void *data, size_t size, const std::string &fileName) {
+    if (size > 0 && fread(data, size, 1, file) != 1) {
+        Debug(Debug::ERROR) << "Cannot read from " << fileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+// Builds the same symmetric neighbor lists as readInClusterData in partitions of consecutive ids. Every result
+// line is spilled twice, once to the list of the query and once to the list of the target. A partition is then
+// sorted and an added edge is dropped if the same edge is part of the result entry.
+void ClusteringAlgorithms::writeGraphPartitions() {
+    const int alnType = alnDbr->getDbtype();
+    // set cover state per sequence that stays in memory next to a partition
+    const size_t stateMemory = getSetCoverStateMemory(dbSize);
+    if (memoryLimit <= 2 * stateMemory) {
+        Debug(Debug::ERROR) << "Memory limit " << memoryLimit << " is too small to cluster " << dbSize
+                            << " sequences, at least " << 2 * stateMemory << " bytes are needed\n";
+        EXIT(EXIT_FAILURE);
+    }
+    const size_t partitionMemory = memoryLimit - stateMemory;
+
+    // number of edges that are spilled for each sequence
+    unsigned int *edgeCounts = new(std::nothrow) unsigned int[dbSize];
+    Util::checkAllocation(edgeCounts, "Can not allocate edgeCounts memory in ClusteringAlgorithms::writeGraphPartitions");
+    std::fill_n(edgeCounts, dbSize, 0);
+#pragma omp parallel
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+#pragma omp for schedule(dynamic, 100)
+        for (size_t i = 0; i < dbSize; i++) {
+            char *data = alnDbr->getDataByDBKey(seqDbr->getDbKey(i), thread_idx);
+            if (*data == '\0') {
+                __sync_fetch_and_add(&edgeCounts[i], 2);
+                continue;
+            }
+            AlignmentSymmetry::forEachResult(data, alnType, scoretype, false, [&](unsigned int key, unsigned short) {
+                const size_t currElement = seqDbr->getId(key);
+                if (currElement == UINT_MAX || currElement > seqDbr->getSize()) {
+                    Debug(Debug::ERROR) << "Element " << key
+                                        << " contained in some alignment list, but not contained in the sequence database!\n";
+                    EXIT(EXIT_FAILURE);
+                }
+                __sync_fetch_and_add(&edgeCounts[i], 1);
+                __sync_fetch_and_add(&edgeCounts[currElement], 1);
+            });
+        }
+    }
+    alnDbr->remapData();
+
+    const size_t bytesPerEdge = sizeof(ClusterGraphEdge) + sizeof(unsigned int) + sizeof(unsigned short);
+    const size_t bytesPerSequence = sizeof(size_t) + sizeof(unsigned int *) + sizeof(unsigned short *);
+    partitionStarts.push_back(0);
+    size_t currentMemory = 0;
+    for (size_t i = 0; i < dbSize; i++) {
+        const size_t memoryNeeded = edgeCounts[i] * bytesPerEdge + bytesPerSequence;
+        if (currentMemory > 0 && currentMemory + memoryNeeded > partitionMemory) {
+            partitionStarts.push_back(i);
+            currentMemory = 0;
+        }
+        currentMemory += memoryNeeded;
+    }
+    partitionStarts.push_back(dbSize);
+    delete[] edgeCounts;
+    const size_t partitionCount = partitionStarts.size() - 1;
+    Debug(Debug::INFO) << "Split graph into " << partitionCount << " partitions\n";
+
+    FileUtil::fixRlimitNoFile();
+    std::vector<std::string> spillFiles;
+    std::vector<FILE *> spillHandles;
+    for (size_t i = 0; i < partitionCount; i++) {
+        spillFiles.push_back(tmpPrefix + "_" + SSTR(i) + ".edges");
+        spillHandles.push_back(FileUtil::openFileOrDie(spillFiles.back().c_str(), "wb", false));
+    }
+    const size_t bufferSize = std::max(static_cast<size_t>(256), static_cast<size_t>(1048576) / partitionCount);
+#pragma omp parallel
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+        std::vector<std::vector<ClusterGraphEdge>> buffers(partitionCount);
+        auto flushBuffer = [&](size_t partition) {
+#pragma omp critical
+            writePartitionData(spillHandles[partition], buffers[partition].data(),
+                               buffers[partition].size() * sizeof(ClusterGraphEdge), spillFiles[partition]);
+            buffers[partition].clear();
+        };
+        auto addEdge = [&](unsigned int id, unsigned int neighbor, unsigned short score, unsigned short isResult) {
+            const size_t partition = getPartition(partitionStarts, id);
+            ClusterGraphEdge edge;
+            edge.id = id;
+            edge.neighbor = neighbor;
+            edge.score = score;
+            edge.isResult = isResult;
+            buffers[partition].push_back(edge);
+            if (buffers[partition].size() >= bufferSize) {
+                flushBuffer(partition);
+            }
+        };
+#pragma omp for schedule(dynamic, 100)
+        for (size_t i = 0; i < dbSize; i++) {
+            char *data = alnDbr->getDataByDBKey(seqDbr->getDbKey(i), thread_idx);
+            if (*data == '\0') {
+                const unsigned short score = AlignmentSymmetry::getSelfScore(alnType, scoretype);
+                addEdge(i, i, score, 1);
+                addEdge(i, i, score, 0);
+                continue;
+            }
+            AlignmentSymmetry::forEachResult(data, alnType, scoretype, true, [&](unsigned int key, unsigned short score) {
+                const unsigned int currElement = seqDbr->getId(key);
+                addEdge(i, currElement, score, 1);
+                addEdge(currElement, i, score, 0);
+            });
+        }
+        for (size_t i = 0; i < partitionCount; i++) {
+            flushBuffer(i);
+        }
+    }
+    alnDbr->remapData();
+    for (size_t i = 0; i < partitionCount; i++) {
+        if (fclose(spillHandles[i]) != 0) {
+            Debug(Debug::ERROR) << "Cannot close file " << spillFiles[i] << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+
+    maxClustersize = 0;
+    for (size_t partition = 0; partition < partitionCount; partition++) {
+        const size_t start = partitionStarts[partition];
+        const size_t nodeCount = partitionStarts[partition + 1] - start;
+        std::vector<ClusterGraphEdge> edges(FileUtil::getFileSize(spillFiles[partition]) / sizeof(ClusterGraphEdge));
+        FILE *spillFile = FileUtil::openFileOrDie(spillFiles[partition].c_str(), "rb", true);
+        readPartitionData(spillFile, edges.data(), edges.size() * sizeof(ClusterGraphEdge), spillFiles[partition]);
+        fclose(spillFile);
+        FileUtil::remove(spillFiles[partition].c_str());
+        SORT_PARALLEL(edges.begin(), edges.end(), ClusterGraphEdge::compareByIdAndNeighbor);
+
+        std::vector<size_t> offsets(nodeCount + 1, 0);
+        size_t writePos = 0;
+        unsigned int groupId = UINT_MAX;
+        unsigned int groupNeighbor = UINT_MAX;
+        unsigned short groupIsResult = 0;
+        for (size_t i = 0; i < edges.size(); i++) {
+            if (edges[i].id != groupId || edges[i].neighbor != groupNeighbor) {
+                groupId = edges[i].id;
+                groupNeighbor = edges[i].neighbor;
+                groupIsResult = edges[i].isResult;
+            }
+            // an added edge is only kept if the result entry does not contain it
+            if (edges[i].isResult == groupIsResult) {
+                offsets[edges[i].id - start + 1]++;
+                edges[writePos++] = edges[i];
+            }
+        }
+        for (size_t i = 0; i < nodeCount; i++) {
+            const size_t elementCount = offsets[i + 1];
+            clustersizes[start + i] = elementCount;
+            maxClustersize = std::max((unsigned int) elementCount, maxClustersize);
+            offsets[i + 1] += offsets[i];
+        }
+        std::vector<unsigned int> elements(writePos);
+        std::vector<unsigned short> scores(writePos);
+        for (size_t i = 0; i < writePos; i++) {
+            elements[i] = edges[i].neighbor;
+            scores[i] = edges[i].score;
+        }
+        std::vector<ClusterGraphEdge>().swap(edges);
+
+        partitionFiles.push_back(tmpPrefix + "_" + SSTR(partition));
+        FILE *file = FileUtil::openFileOrDie(partitionFiles.back().c_str(), "wb", false);
+        writePartitionData(file, &writePos, sizeof(size_t), partitionFiles.back());
+        writePartitionData(file, offsets.data(), offsets.size() * sizeof(size_t), partitionFiles.back());
+        writePartitionData(file, elements.data(), elements.size() * sizeof(unsigned int), partitionFiles.back());
+        writePartitionData(file, scores.data(), scores.size() * sizeof(unsigned short), partitionFiles.back());
+        if (fclose(file) != 0) {
+            Debug(Debug::ERROR) << "Cannot close file " << partitionFiles.back() << "\n";
+            EXIT(EXIT_FAILURE);
+        }
+    }
+}
+
+void ClusteringAlgorithms::readGraphPartition(size_t partition, ClusterGraphPartition &graph) {
+    graph.start = partitionStarts[partition];
+    graph.end = partitionStarts[partition + 1];
+    const size_t nodeCount = graph.end - graph.start;
+    const std::string &fileName = partitionFiles[partition];
+    FILE *file = FileUtil::openFileOrDie(fileName.c_str(), "rb", true);
+    size_t elementCount = 0;
+    readPartitionData(file, &elementCount, sizeof(size_t), fileName);
+    graph.elementOffsets = new(std::nothrow) size_t[nodeCount + 1];
+    Util::checkAllocation(graph.elementOffsets, "Can not allocate elementOffsets memory in ClusteringAlgorithms::readGraphPartition");
+    unsigned int *elements = new(std::nothrow) unsigned int[elementCount];
+    Util::checkAllocation(elements, "Can not allocate elements memory in ClusteringAlgorithms::readGraphPartition");
+    unsigned short *scores = new(std::nothrow) unsigned short[elementCount];
+    Util::checkAllocation(scores, "Can not allocate scores memory in ClusteringAlgorithms::readGraphPartition");
+    readPartitionData(file, graph.elementOffsets, (nodeCount + 1) * sizeof(size_t), fileName);
+    readPartitionData(file, elements, elementCount * sizeof(unsigned int), fileName);
+    readPartitionData(file, scores, elementCount * sizeof(unsigned short), fileName);
+    fclose(file);
+    graph.elementLookupTable = new(std::nothrow) unsigned int*[nodeCount];
+    Util::checkAllocation(graph.elementLookupTable, "Can not allocate elementLookupTable memory in ClusteringAlgorithms::readGraphPartition");
+    graph.scoreLookupTable = new(std::nothrow) unsigned short*[nodeCount];
+    Util::checkAllocation(graph.scoreLookupTable, "Can not allocate scoreLookupTable memory in ClusteringAlgorithms::readGraphPartition");
+    AlignmentSymmetry::setupPointers<unsigned int>(elements, graph.elementLookupTable, graph.elementOffsets, nodeCount, elementCount);
+    AlignmentSymmetry::setupPointers<unsigned short>(scores, graph.scoreLookupTable, graph.elementOffsets, nodeCount, elementCount);
+}
+
+void ClusteringAlgorithms::clusterExternalMemory(int mode, unsigned int *assignedcluster, size_t elementCount) {
+    Debug(Debug::INFO) << "Result DB with " << elementCount << " entries does not fit into the memory limit\n";
+    writeGraphPartitions();
+    short *bestscore = new(std::nothrow) short[dbSize];
+    Util::checkAllocation(bestscore, "Can not allocate bestscore memory in ClusteringAlgorithms::clusterExternalMemory");
+    std::fill_n(bestscore, dbSize, SHRT_MIN);
+    if (mode == 1) {
+        parallelSetCoverRounds(NULL, assignedcluster, bestscore);
+    } else if (mode == 3) {
+        Debug(Debug::INFO) << "connected component mode" << "\n";
+        initClustersizes();
+        connectedComponents(NULL, assignedcluster);
+    }
+    delete [] sorted_clustersizes;
+    delete [] clusterid_to_arrayposition;
+    delete [] borders_of_set;
+    delete [] bestscore;
+    for (size_t i = 0; i < partitionFiles.size(); i++) {
+        FileUtil::remove(partitionFiles[i].c_str());
+    }
+    partitionFiles.clear();
+    partitionStarts.clear();
+}
+
+size_t ClusteringAlgorithms::countElements() {
+    size_t elementCount = 0;
+#pragma omp parallel reduction (+:elementCount)
+    {
+        int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = omp_get_thread_num();
+#endif
+#pragma omp for schedule(dynamic, 10)
+        for (size_t i = 0; i < alnDbr->getSize(); i++) {
+            const char *data = alnDbr->getData(i, thread_idx);
+            const size_t dataSize = alnDbr->getEntryLen(i);
+            elementCount += (*data == '\0') ? 1 : AlignmentSymmetry::countResults(data, dataSize);
+        }
+    }
+    return elementCount;
+}
+
+// The cluster graph is a single entry that stores the symmetric graph of readInClusterData:
+// header, the sequence key of each node, the offsets of the neighbor lists, the neighbor ids and their scores.
+// Node ids are the ids of the sequence DB sorted by length, as used by clust.
+struct ClusterGraphHeader {
+    char magic[8];
+    uint64_t nodeCount;
+    uint64_t elementCount;
+    int64_t scoreType;
+};
+static const char CLUSTER_GRAPH_MAGIC[8] = {'M', 'M', 'S', 'C', 'G', 'R', '1', '\0'};
+
+static size_t alignClusterGraphOffset(size_t offset) {
+    return (offset + 7) & ~static_cast<size_t>(7);
+}
+
+void ClusteringAlgorithms::writeClusterGraph(DBWriter &graphWriter) {
+    const size_t elementCount = countElements();
+    unsigned int *elements = new(std::nothrow) unsigned int[elementCount];
+    Util::checkAllocation(elements, "Can not allocate elements memory in ClusteringAlgorithms::writeClusterGraph");
+    unsigned int **elementLookupTable = new(std::nothrow) unsigned int*[dbSize];
+    Util::checkAllocation(elementLookupTable, "Can not allocate elementLookupTable memory in ClusteringAlgorithms::writeClusterGraph");
+    unsigned short **scoreLookupTable = new(std::nothrow) unsigned short *[dbSize];
+    Util::checkAllocation(scoreLookupTable, "Can not allocate scoreLookupTable memory in ClusteringAlgorithms::writeClusterGraph");
+    unsigned short *scores = NULL;
+    size_t *elementOffsets = new(std::nothrow) size_t[dbSize + 1];
+    Util::checkAllocation(elementOffsets, "Can not allocate elementOffsets memory in ClusteringAlgorithms::writeClusterGraph");
+    elementOffsets[dbSize] = 0;
+    readInClusterData(elementLookupTable, elements, scoreLookupTable, scores, elementOffsets, elementCount);
+
+    ClusterGraphHeader header;
+    memcpy(header.magic, CLUSTER_GRAPH_MAGIC, sizeof(CLUSTER_GRAPH_MAGIC));
+    header.nodeCount = dbSize;
+    header.elementCount = elementOffsets[dbSize];
+    header.scoreType = scoretype;
+    std::vector<unsigned int> keys(alignClusterGraphOffset(dbSize * sizeof(unsigned int)) / sizeof(unsigned int), 0);
+    for (size_t i = 0; i < dbSize; i++) {
+        keys[i] = seqDbr->getDbKey(i);
+    }
+    const char padding[8] = {0};
+    const size_t elementBytes = header.elementCount * sizeof(unsigned int);
+    graphWriter.writeStart(0);
+    graphWriter.writeAdd(reinterpret_cast<const char *>(&header), sizeof(ClusterGraphHeader), 0);
+    graphWriter.writeAdd(reinterpret_cast<const char *>(keys.data()), keys.size() * sizeof(unsigned int), 0);
+    graphWriter.writeAdd(reinterpret_cast<const char *>(elementOffsets), (dbSize + 1) * sizeof(size_t), 0);
+    graphWriter.writeAdd(reinterpret_cast<const char *>(elements), elementBytes, 0);
+    graphWriter.writeAdd(padding, alignClusterGraphOffset(elementBytes) - elementBytes, 0);
+    graphWriter.writeAdd(reinterpret_cast<const char *>(scores), header.elementCount * sizeof(unsigned short), 0);
+    graphWriter.writeEnd(0, 0, false);
+    Debug(Debug::INFO) << "Cluster graph with " << dbSize << " nodes and " << header.elementCount << " edges\n";
+
+    delete[] elementLookupTable;
+    delete[] elements;
+    delete[] elementOffsets;
+    delete[] scoreLookupTable;
+    delete[] scores;
+}
+
+void ClusteringAlgorithms::mapClusterGraph(unsigned int **elementLookupTable, unsigned short **scoreLookupTable,
+                                           size_t *elementOffsets) {
+    if (alnDbr->getSize() != 1 || alnDbr->getEntryLen(0) < sizeof(ClusterGraphHeader)) {
+        Debug(Debug::ERROR) << "Cluster graph " << alnDbr->getDataFileName() << " is invalid\n";
+        EXIT(EXIT_FAILURE);
+    }
+    const char *data = alnDbr->getData(0, 0);
+    ClusterGraphHeader header;
+    memcpy(&header, data, sizeof(ClusterGraphHeader));
+    if (memcmp(header.magic, CLUSTER_GRAPH_MAGIC, sizeof(CLUSTER_GRAPH_MAGIC)) != 0) {
+        Debug(Debug::ERROR) << "Cluster graph " << alnDbr->getDataFileName() << " is invalid\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (header.nodeCount != dbSize) {
+        Debug(Debug::ERROR) << "Cluster graph has " << header.nodeCount << " nodes, but the sequence DB has " << dbSize << " entries\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (header.scoreType != scoretype) {
+        Debug(Debug::ERROR) << "Cluster graph was created with --similarity-type " << header.scoreType << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    // the columns have to fit into the entry before any offset or element is read
+    const size_t graphSize = sizeof(ClusterGraphHeader) + alignClusterGraphOffset(dbSize * sizeof(unsigned int))
+                             + (dbSize + 1) * sizeof(size_t) + alignClusterGraphOffset(header.elementCount * sizeof(unsigned int))
+                             + header.elementCount * sizeof(unsigned short);
+    if (header.elementCount > alnDbr->getEntryLen(0) || graphSize > alnDbr->getEntryLen(0)) {
+        Debug(Debug::ERROR) << "Cluster graph " << alnDbr->getDataFileName() << " is truncated\n";
+        EXIT(EXIT_FAILURE);
+    }
+    data += sizeof(ClusterGraphHeader);
+    const unsigned int *keys = reinterpret_cast<const unsigned int *>(data);
+    data += alignClusterGraphOffset(dbSize * sizeof(unsigned int));
+    const size_t *offsets = reinterpret_cast<const size_t *>(data);
+    data += (dbSize + 1) * sizeof(size_t);
+    unsigned int *elements = reinterpret_cast<unsigned int *>(const_cast<char *>(data));
+    data += alignClusterGraphOffset(header.elementCount * sizeof(unsigned int));
+    unsigned short *scores = reinterpret_cast<unsigned short *>(const_cast<char *>(data));
+    if (offsets[0] != 0 || offsets[dbSize] != header.elementCount) {
+        Debug(Debug::ERROR) << "Cluster graph " << alnDbr->getDataFileName() << " is invalid\n";
+        EXIT(EXIT_FAILURE);
+    }
+
+    bool keysMatch = true;
+    bool isValid = true;
+#pragma omp parallel for schedule(static) reduction(&&:keysMatch, isValid)
+    for (size_t i = 0; i < dbSize; i++) {
+        keysMatch = keysMatch && (keys[i] == seqDbr->getDbKey(i));
+        isValid = isValid && (offsets[i] <= offsets[i + 1]);
+        for (size_t j = offsets[i]; isValid && j < offsets[i + 1]; j++) {
+            isValid = (elements[j] < dbSize);
+        }
+        elementLookupTable[i] = elements + offsets[i];
+        scoreLookupTable[i] = scores + offsets[i];
+    }
+    if (isValid == false) {
+        Debug(Debug::ERROR) << "Cluster graph " << alnDbr->getDataFileName() << " is invalid\n";
+        EXIT(EXIT_FAILURE);
+    }
+    if (keysMatch == false) {
+        Debug(Debug::ERROR) << "Cluster graph was created with a different sequence DB\n";
+        EXIT(EXIT_FAILURE);
+    }
+    memcpy(elementOffsets, offsets, sizeof(size_t) * (dbSize + 1));
+    maxClustersize = 0;
+    for (size_t i = 0; i < dbSize; i++) {
+        size_t elementCount = offsets[i + 1] - offsets[i];
+        maxClustersize = std::max((unsigned int) elementCount, maxClustersize);
+        clustersizes[i] = elementCount;
+    }
+}
+
 void ClusteringAlgorithms::readInClusterData(unsigned int **elementLookupTable, unsigned int *&elements,
                                              unsigned short **scoreLookupTable, unsigned short *&scores,
                                              size_t *elementOffsets, size_t totalElementCount) {
@@ -347,7 +1211,7 @@ void ClusteringAlgorithms::readInClusterData(unsigned int **elementLookupTable,
             const size_t alnId = alnDbr->getId(clusterId);
             const char *data = alnDbr->getData(alnId, thread_idx);
             const size_t dataSize = alnDbr->getEntryLen(alnId);
-            elementOffsets[i] = (*data == '\0') ? 1 : Util::countLines(data, dataSize);
+            elementOffsets[i] = (*data == '\0') ? 1 : AlignmentSymmetry::countResults(data, dataSize);
         }
     }
 
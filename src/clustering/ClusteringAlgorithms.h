@@ -11,20 +11,41 @@
 #include <unordered_map>
 
 #include "DBReader.h"
+#include "DBWriter.h"
+
+// neighbor lists of the sequences [start, end), the tables are indexed by id - start
+struct ClusterGraphPartition {
+    size_t start;
+    size_t end;
+    unsigned int **elementLookupTable;
+    unsigned short **scoreLookupTable;
+    size_t *elementOffsets;
+};
 
 class ClusteringAlgorithms {
 public:
-    ClusteringAlgorithms(DBReader<unsigned int>* seqDbr, DBReader<unsigned int>* alnDbr, int threads,int scoretype, int maxiterations);
+    // memoryLimit 0 keeps the whole graph in memory, otherwise larger graphs are split into partitions below tmpPrefix
+    // parallelSetCover picks the set cover representatives in rounds, graphs in partitions always use the rounds
+    ClusteringAlgorithms(DBReader<unsigned int>* seqDbr, DBReader<unsigned int>* alnDbr, int threads,int scoretype, int maxiterations,
+                         size_t memoryLimit = 0, const std::string &tmpPrefix = "", bool parallelSetCover = false);
     ~ClusteringAlgorithms();
     std::pair<unsigned int, unsigned int> * execute(int mode);
+    void writeClusterGraph(DBWriter &graphWriter);
 private:
     DBReader<unsigned int>* seqDbr;
 
     DBReader<unsigned int>* alnDbr;
+    bool isClusterGraph;
 
 
     int threads;
     int scoretype;
+    bool parallelSetCover;
+    size_t memoryLimit;
+    std::string tmpPrefix;
+    // partitions of the symmetric graph on disk, used if the graph does not fit into memoryLimit
+    std::vector<std::string> partitionFiles;
+    std::vector<size_t> partitionStarts;
 //datastructures
     unsigned int maxClustersize;
     unsigned int dbSize;
@@ -40,12 +61,35 @@ private:
     void removeClustersize(unsigned int clusterid);
 
     void decreaseClustersize(unsigned int clusterid);
+
 //for connected component
     int maxiterations;
 
 
-    void setCover(unsigned int **elementLookup, unsigned short ** elementScoreLookupTable,
-                  unsigned int *assignedcluster, short *bestscore, size_t *offsets);
+    // picks the largest set of sorted_clustersizes one after another
+    void setCover(const ClusterGraphPartition &graph, unsigned int *assignedcluster, short *bestscore);
+
+    // graph is NULL if the partitions on disk are used
+    void parallelSetCoverRounds(ClusterGraphPartition *graph, unsigned int *assignedcluster, short *bestscore);
+
+    // picks the remaining representatives of parallelSetCoverRounds one after another, the tables of graph are
+    // indexed by the position in candidates if isCandidateGraph is set
+    void greedySetCover(const ClusterGraphPartition &graph, bool isCandidateGraph, const std::vector<unsigned int> &candidates,
+                        char *removed, unsigned int *assignedcluster, short *bestscore);
+
+    // neighbor lists of the candidates if they fit into the memory limit next to the set cover state
+    bool readCandidateGraph(const std::vector<unsigned int> &candidates, ClusterGraphPartition &graph);
+
+    void connectedComponents(ClusterGraphPartition *graph, unsigned int *assignedcluster);
+
+    template <typename Function>
+    void forEachPartition(ClusterGraphPartition *graph, Function function);
+
+    void writeGraphPartitions();
+
+    void readGraphPartition(size_t partition, ClusterGraphPartition &graph);
+
+    void clusterExternalMemory(int mode, unsigned int *assignedcluster, size_t elementCount);
 
     void greedyIncremental(unsigned int **elementLookupTable, size_t *elementOffsets,
                            size_t n, unsigned int *assignedcluster) ;
@@ -54,6 +98,10 @@ private:
     void greedyIncrementalLowMem(unsigned int *assignedcluster) ;
 
 
+    size_t countElements();
+
+    void mapClusterGraph(unsigned int **elementLookupTable, unsigned short **scoreLookupTable, size_t *elementOffsets);
+
     void readInClusterData(unsigned int **elementLookupTable, unsigned int *&elements,
                            unsigned short **scoreLookupTable, unsigned short *&scores,
                            size_t *elementOffsets, size_t totalElementCount)  ;
@@ -1,5 +1,7 @@
 #include "Clustering.h"
+#include "ClusteringAlgorithms.h"
 #include "Parameters.h"
+#include "Util.h"
 
 int clust(int argc, const char **argv, const Command& command) {
     Parameters& par = Parameters::getInstance();
@@ -7,8 +9,29 @@ int clust(int argc, const char **argv, const Command& command) {
 
     Clustering clu(par.db1, par.db1Index, par.db2, par.db2Index,
                    par.db3, par.db3Index, par.maxIteration,
-                   par.similarityScoreType, par.threads, par.compressed);
+                   par.similarityScoreType, par.threads, par.compressed, Util::computeMemory(par.splitMemoryLimit),
+                   par.parallelSetCover);
     clu.run(par.clusteringMode);
     return EXIT_SUCCESS;
 }
 
+int createclustgraph(int argc, const char **argv, const Command& command) {
+    Parameters& par = Parameters::getInstance();
+    par.parseParameters(argc, argv, command, true, 0, 0);
+
+    DBReader<unsigned int> seqDbr(par.db1.c_str(), par.db1Index.c_str(), par.threads, DBReader<unsigned int>::USE_INDEX);
+    seqDbr.open(DBReader<unsigned int>::SORT_BY_LENGTH);
+
+    DBReader<unsigned int> alnDbr(par.db2.c_str(), par.db2Index.c_str(), par.threads, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    alnDbr.open(DBReader<unsigned int>::NOSORT);
+
+    DBWriter graphWriter(par.db3.c_str(), par.db3Index.c_str(), 1, false, Parameters::DBTYPE_CLUSTER_GRAPH);
+    graphWriter.open();
+    ClusteringAlgorithms algorithm(&seqDbr, &alnDbr, par.threads, par.similarityScoreType, par.maxIteration);
+    algorithm.writeClusterGraph(graphWriter);
+    graphWriter.close();
+
+    alnDbr.close();
+    seqDbr.close();
+    return EXIT_SUCCESS;
+}
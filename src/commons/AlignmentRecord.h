@@ -0,0 +1,76 @@
+#ifndef MMSEQS_ALIGNMENTRECORD_H
+#define MMSEQS_ALIGNMENTRECORD_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+// An entry of a binary alignment database (Parameters::DBTYPE_BINARY_ALIGNMENT_RES) consists of
+// a header (magic and record count), the fixed-width records and a backtrace column that holds the
+// compressed backtraces of all records back to back. Entries without hits are empty, like in text
+// result databases, so "*data == '\0'" still identifies them.
+struct __attribute__((__packed__)) AlignmentRecord {
+    unsigned int dbKey;
+    int score;
+    float seqId;
+    double eval;
+    int qStartPos;
+    int qEndPos;
+    unsigned int qLen;
+    int dbStartPos;
+    int dbEndPos;
+    unsigned int dbLen;
+    int queryOrfStartPos;
+    int queryOrfEndPos;
+    int dbOrfStartPos;
+    int dbOrfEndPos;
+    // offset into the backtrace column of the entry
+    unsigned int backtraceOffset;
+    unsigned int backtraceLength;
+};
+
+// Typed view on a binary alignment entry. Records are accessed in place inside the
+// memory mapped (or decompressed) entry without any copy or parsing.
+class AlignmentRecords {
+public:
+    static const size_t HEADER_SIZE = 8;
+
+    explicit AlignmentRecords(const char *data) : data(data), count(0) {
+        if (isBinary(data)) {
+            memcpy(&count, data + 4, sizeof(unsigned int));
+        }
+    }
+
+    // text entries start with a digit or are empty, so the first byte tells them apart
+    static bool isBinary(const char *data) {
+        return data != NULL && data[0] == '\x01' && data[1] == 'A' && data[2] == 'L' && data[3] == 'N';
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    const AlignmentRecord &operator[](size_t i) const {
+        return reinterpret_cast<const AlignmentRecord *>(data + HEADER_SIZE)[i];
+    }
+
+    const char *getBacktrace(size_t i) const {
+        return data + HEADER_SIZE + count * sizeof(AlignmentRecord) + (*this)[i].backtraceOffset;
+    }
+
+    // writes the entry header, records are appended directly after it
+    static void writeHeader(std::string &buffer, unsigned int count) {
+        buffer.append("\x01" "ALN", 4);
+        buffer.append(reinterpret_cast<const char *>(&count), sizeof(unsigned int));
+    }
+
+    static void writeRecord(std::string &buffer, const AlignmentRecord &record) {
+        buffer.append(reinterpret_cast<const char *>(&record), sizeof(AlignmentRecord));
+    }
+
+private:
+    const char *data;
+    unsigned int count;
+};
+
+#endif
@@ -190,6 +190,14 @@ int main(int argc, const char **argv) {
         return EXIT_SUCCESS;
     }
 
+    // a binary built for a newer CPU would otherwise fail later with an illegal instruction
+    if (Util::getCpuSimdLevel() < Util::getCompiledSimdLevel()) {
+        Debug(Debug::ERROR) << binary_name << " was compiled for " << Util::getSimdLevelName(Util::getCompiledSimdLevel())
+                            << " but this CPU only supports " << Util::getSimdLevelName(Util::getCpuSimdLevel())
+                            << ". Please use a build for an older CPU.\n";
+        return EXIT_FAILURE;
+    }
+
     if(validatorUpdate != NULL){
         (*validatorUpdate)();
     }
@@ -50,9 +50,13 @@ struct DbValidator {
     static std::vector<int> taxSequenceDb;
     static std::vector<int> nuclAaDb;
     static std::vector<int> alignmentDb;
+    static std::vector<int> alignmentOrBinaryDb;
     static std::vector<int> prefilterDb;
     static std::vector<int> clusterDb;
     static std::vector<int> resultDb;
+    static std::vector<int> resultOrBinaryDb;
+    static std::vector<int> resultOrClusterGraphDb;
+    static std::vector<int> clusterGraphDb;
     static std::vector<int> ca3mDb;
     static std::vector<int> msaDb;
     static std::vector<int> genericDb;
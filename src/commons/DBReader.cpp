@@ -15,6 +15,7 @@
 #include "Debug.h"
 #include "Util.h"
 #include "FileUtil.h"
+#include "SharedMemory.h"
 #include "itoa.h"
 
 #ifdef OPENMP
@@ -27,7 +28,7 @@ threads(threads), dataMode(dataMode), dataFileName(strdup(dataFileName_)),
         indexFileName(strdup(indexFileName_)), size(0), dataFiles(NULL), dataSizeOffset(NULL), dataFileCnt(0),
         totalDataSize(0), dataSize(0), lastKey(T()), closed(1), dbtype(Parameters::DBTYPE_GENERIC_DB),
         compressedBuffers(NULL), compressedBufferSizes(NULL), index(NULL), id2local(NULL), local2id(NULL),
-        dataMapped(false), accessType(0), externalData(false), didMlock(false)
+        dataMapped(false), accessType(0), externalData(false), didMlock(false), sharedMemory(false)
 {}
 
 template <typename T>
@@ -36,7 +37,7 @@ DBReader<T>::DBReader(DBReader<T>::Index *index, size_t size, size_t dataSize, T
         threads(threads), dataMode(USE_INDEX), dataFileName(NULL), indexFileName(NULL),
         size(size), dataFiles(NULL), dataSizeOffset(NULL), dataFileCnt(0), totalDataSize(0), dataSize(dataSize), lastKey(lastKey),
         maxSeqLen(maxSeqLen), closed(1), dbtype(dbType), compressedBuffers(NULL), compressedBufferSizes(NULL), index(index), sortedByOffset(true),
-        id2local(NULL), local2id(NULL), dataMapped(false), accessType(NOSORT), externalData(true), didMlock(false)
+        id2local(NULL), local2id(NULL), dataMapped(false), accessType(NOSORT), externalData(true), didMlock(false), sharedMemory(false)
 {}
 
 template <typename T>
@@ -121,7 +122,7 @@ template <typename T> bool DBReader<T>::open(int accessType){
                 EXIT(EXIT_FAILURE);
             }
             size_t dataSize;
-            dataFiles[fileIdx] = mmapData(dataFile, &dataSize);
+            dataFiles[fileIdx] = mmapData(dataFile, &dataSize, dataFileNames[fileIdx]);
             dataSizeOffset[fileIdx]=totalDataSize;
             totalDataSize += dataSize;
             if (fclose(dataFile) != 0) {
@@ -399,7 +400,7 @@ void DBReader<unsigned int>::sortIndex(bool isSortedById) {
     }
 }
 
-template <typename T> char* DBReader<T>::mmapData(FILE * file, size_t *dataSize) {
+template <typename T> char* DBReader<T>::mmapData(FILE * file, size_t *dataSize, const std::string &fileName) {
     struct stat sb;
     if (fstat(fileno(file), &sb) < 0) {
         int errsv = errno;
@@ -412,6 +413,13 @@ template <typename T> char* DBReader<T>::mmapData(FILE * file, size_t *dataSize)
 
     char *ret;
     if(*dataSize > 0){
+        if ((dataMode & USE_FREAD) == 0 && (dataMode & USE_SHARED_MEMORY)) {
+            ret = SharedMemory::attach(fileName, *dataSize);
+            if (ret != NULL) {
+                sharedMemory = true;
+                return ret;
+            }
+        }
         if ((dataMode & USE_FREAD) == 0) {
             int mode;
             if (dataMode & USE_WRITABLE) {
@@ -452,7 +460,7 @@ template <typename T> void DBReader<T>::remapData(){
                 EXIT(EXIT_FAILURE);
             }
             size_t dataSize = 0;
-            dataFiles[fileIdx] = mmapData(dataFile, &dataSize);
+            dataFiles[fileIdx] = mmapData(dataFile, &dataSize, dataFileNames[fileIdx]);
             if (fclose(dataFile) != 0) {
                 Debug(Debug::ERROR) << "Cannot close file " << dataFileNames[fileIdx] << "\n";
                 EXIT(EXIT_FAILURE);
@@ -1003,6 +1011,46 @@ void DBReader<T>::setSequentialAdvice() {
 #endif
 }
 
+template<typename T>
+void DBReader<T>::prefetchData(std::vector<size_t> &ids) {
+#ifdef HAVE_POSIX_MADVISE
+    // fread and compressed entries do not read from the mapped data
+    if ((dataMode & USE_DATA) == 0 || (dataMode & USE_FREAD) != 0 || compression == COMPRESSED || ids.empty()) {
+        return;
+    }
+    std::sort(ids.begin(), ids.end(), [this](size_t first, size_t second) {
+        return getOffset(first) < getOffset(second);
+    });
+    const uintptr_t pageMask = ~(static_cast<uintptr_t>(Util::getPageSize()) - 1);
+    uintptr_t rangeStart = 0;
+    uintptr_t rangeEnd = 0;
+    for (size_t i = 0; i < ids.size(); i++) {
+        const size_t entryLen = getEntryLen(ids[i]);
+        if (entryLen == 0) {
+            continue;
+        }
+        const uintptr_t data = reinterpret_cast<uintptr_t>(getDataByOffset(getOffset(ids[i])));
+        const uintptr_t start = data & pageMask;
+        const uintptr_t end = data + entryLen;
+        // entries that share a page with the previous range are added to it
+        if (rangeEnd != 0 && start >= rangeStart && start <= rangeEnd) {
+            rangeEnd = std::max(rangeEnd, end);
+            continue;
+        }
+        if (rangeEnd != 0) {
+            posix_madvise(reinterpret_cast<void *>(rangeStart), rangeEnd - rangeStart, POSIX_MADV_WILLNEED);
+        }
+        rangeStart = start;
+        rangeEnd = end;
+    }
+    if (rangeEnd != 0) {
+        posix_madvise(reinterpret_cast<void *>(rangeStart), rangeEnd - rangeStart, POSIX_MADV_WILLNEED);
+    }
+#else
+    (void) ids;
+#endif
+}
+
 template<typename T>
 void DBReader<T>::readLookup(char *data, size_t dataSize, DBReader::LookupEntry *lookup) {
     size_t i = 0;
@@ -262,6 +262,8 @@ public:
     static const unsigned int USE_FREAD      = 4;
     static const unsigned int USE_LOOKUP     = 8;
     static const unsigned int USE_LOOKUP_REV = 16;
+    // map copies placed in shared memory by loadidx instead of the data files
+    static const unsigned int USE_SHARED_MEMORY = 32;
 
 
     // compressed
@@ -297,7 +299,7 @@ public:
     static void softlinkDb(const std::string &databaseName, const std::string &outDb, DBFiles::Files dbFilesFlags = DBFiles::ALL);
     static void copyDb(const std::string &databaseName, const std::string &outDb, DBFiles::Files dbFilesFlags = DBFiles::ALL);
 
-    char *mmapData(FILE *file, size_t *dataSize);
+    char *mmapData(FILE *file, size_t *dataSize, const std::string &fileName);
 
     bool readIndex(char *data, size_t indexDataSize, Index *index, size_t & dataSize);
 
@@ -411,10 +413,17 @@ public:
         return isCompressed(dbtype);
     }
 
+    bool isSharedMemory(){
+        return sharedMemory;
+    }
+
     static int isCompressed(int dbtype);
 
     void setSequentialAdvice();
 
+    // asks the kernel to read the entries ids ahead in the order of their offsets, ids is sorted by offset
+    void prefetchData(std::vector<size_t> &ids);
+
     void decomposeDomainByAminoAcid(size_t worldRank, size_t worldSize, size_t *startEntry, size_t *numEntries);
 
 private:
@@ -468,6 +477,9 @@ private:
 
     bool didMlock;
 
+    // data is mapped from a shared memory segment
+    bool sharedMemory;
+
     // needed to prevent the compiler from optimizing away the loop
     char magicBytes;
 
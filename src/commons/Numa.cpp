@@ -0,0 +1,242 @@
+#include "Numa.h"
+#include "Debug.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+#ifdef __linux__
+#include <dirent.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
+
+#ifdef __linux__
+// parses lists like 0-3,8-11 from sysfs
+static std::vector<int> readList(const std::string &file) {
+    std::vector<int> values;
+    FILE *handle = fopen(file.c_str(), "r");
+    if (handle == NULL) {
+        return values;
+    }
+    char line[4096];
+    if (fgets(line, sizeof(line), handle) != NULL) {
+        char *pos = line;
+        while (*pos != '\0' && *pos != '\n') {
+            char *end;
+            long first = strtol(pos, &end, 10);
+            if (end == pos) {
+                break;
+            }
+            long last = first;
+            pos = end;
+            if (*pos == '-') {
+                last = strtol(pos + 1, &end, 10);
+                pos = end;
+            }
+            for (long i = first; i <= last; i++) {
+                values.push_back(static_cast<int>(i));
+            }
+            if (*pos == ',') {
+                pos++;
+            }
+        }
+    }
+    fclose(handle);
+    return values;
+}
+#endif
+
+#ifdef __linux__
+// CPUs the process may run on before any thread was pinned
+static const cpu_set_t &getProcessCpus() {
+    static cpu_set_t processCpus;
+    static bool initialized = false;
+#pragma omp critical(numa_process_cpus)
+    {
+        if (initialized == false) {
+            if (sched_getaffinity(0, sizeof(cpu_set_t), &processCpus) != 0) {
+                CPU_ZERO(&processCpus);
+            }
+            initialized = true;
+        }
+    }
+    return processCpus;
+}
+
+// sets the memory policy of the calling thread and of every thread of the OpenMP pool
+static void setPolicyOfAllThreads(int mode, const unsigned long *mask, unsigned long maxNode) {
+    bool failed = false;
+#pragma omp parallel reduction(||: failed)
+    {
+#ifdef SYS_set_mempolicy
+        failed = syscall(SYS_set_mempolicy, mode, mask, maxNode) != 0;
+#endif
+    }
+    if (failed) {
+        Debug(Debug::WARNING) << "Could not set the NUMA memory policy\n";
+    }
+}
+#endif
+
+const std::vector<std::vector<int> > &Numa::getNodeCpus() {
+    static std::vector<std::vector<int> > nodeCpus;
+    static bool initialized = false;
+#pragma omp critical(numa_topology)
+    {
+        if (initialized == false) {
+#ifdef __linux__
+            std::vector<int> nodes;
+            DIR *dir = opendir("/sys/devices/system/node");
+            if (dir != NULL) {
+                struct dirent *entry;
+                while ((entry = readdir(dir)) != NULL) {
+                    if (strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+                        nodes.push_back(atoi(entry->d_name + 4));
+                    }
+                }
+                closedir(dir);
+            }
+            std::sort(nodes.begin(), nodes.end());
+            for (size_t i = 0; i < nodes.size(); i++) {
+                std::vector<int> cpus = readList("/sys/devices/system/node/node" + SSTR(nodes[i]) + "/cpulist");
+                // memory only nodes do not run threads
+                if (cpus.empty() == false) {
+                    nodeCpus.push_back(cpus);
+                }
+            }
+#endif
+            if (nodeCpus.empty()) {
+                nodeCpus.push_back(std::vector<int>());
+            }
+            initialized = true;
+        }
+    }
+    return nodeCpus;
+}
+
+int Numa::getNodeCount() {
+    return static_cast<int>(getNodeCpus().size());
+}
+
+int Numa::getThreadNode(unsigned int threadIdx, unsigned int threadCount) {
+    const size_t nodes = getNodeCpus().size();
+    return static_cast<int>((static_cast<size_t>(threadIdx) * nodes) / std::max(threadCount, 1u));
+}
+
+int Numa::pinThread(unsigned int threadIdx, unsigned int threadCount) {
+    const int node = getThreadNode(threadIdx, threadCount);
+#ifdef __linux__
+    // remember the unpinned affinity before the first thread is restricted
+    getProcessCpus();
+    const std::vector<int> &cpus = getNodeCpus()[node];
+    if (cpus.empty() == false) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (size_t i = 0; i < cpus.size(); i++) {
+            if (cpus[i] < CPU_SETSIZE) {
+                CPU_SET(cpus[i], &set);
+            }
+        }
+        if (sched_setaffinity(0, sizeof(cpu_set_t), &set) != 0) {
+            Debug(Debug::WARNING) << "Could not pin thread " << threadIdx << " to NUMA node " << node << "\n";
+        }
+    }
+#endif
+    return node;
+}
+
+void Numa::unpinThread() {
+#ifdef __linux__
+    const cpu_set_t &cpus = getProcessCpus();
+    if (CPU_COUNT(&cpus) > 0) {
+        sched_setaffinity(0, sizeof(cpu_set_t), &cpus);
+    }
+#endif
+}
+
+void Numa::setInterleavePolicy() {
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    std::vector<int> nodes = readList("/sys/devices/system/node/has_memory");
+    if (nodes.size() < 2) {
+        return;
+    }
+    const size_t bitsPerWord = sizeof(unsigned long) * 8;
+    unsigned long mask[1024 / (sizeof(unsigned long) * 8)];
+    memset(mask, 0, sizeof(mask));
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i] >= 0 && static_cast<size_t>(nodes[i]) < sizeof(mask) * 8) {
+            mask[nodes[i] / bitsPerWord] |= 1UL << (nodes[i] % bitsPerWord);
+        }
+    }
+    setPolicyOfAllThreads(MPOL_INTERLEAVE, mask, sizeof(mask) * 8);
+#endif
+}
+
+void Numa::setDefaultPolicy() {
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    if (readList("/sys/devices/system/node/has_memory").size() < 2) {
+        return;
+    }
+    setPolicyOfAllThreads(MPOL_DEFAULT, NULL, 0);
+#endif
+}
+
+void Numa::printThroughput(const std::vector<size_t> &itemsPerNode, double seconds, const char *unit) {
+    for (size_t i = 0; i < itemsPerNode.size(); i++) {
+        Debug(Debug::INFO) << "NUMA node " << i << ": " << itemsPerNode[i] << " " << unit;
+        if (seconds > 0.0) {
+            Debug(Debug::INFO) << " (" << (static_cast<double>(itemsPerNode[i]) / seconds) << " per second)";
+        }
+        Debug(Debug::INFO) << "\n";
+    }
+}
+
+NumaWorkQueue::NumaWorkQueue(size_t from, size_t to, size_t blockSize, unsigned int threadCount) : blockSize(std::max(blockSize, (size_t)1)) {
+    const int nodes = Numa::getNodeCount();
+    std::vector<size_t> threadsPerNode(nodes, 0);
+    for (unsigned int i = 0; i < threadCount; i++) {
+        threadsPerNode[Numa::getThreadNode(i, threadCount)]++;
+    }
+    parts.resize(nodes);
+    const size_t size = to - from;
+    size_t start = from;
+    size_t threadsBefore = 0;
+    for (int i = 0; i < nodes; i++) {
+        threadsBefore += threadsPerNode[i];
+        // parts start on block boundaries, so only the last block of the whole range can be short
+        size_t end = to;
+        if (i != nodes - 1 && threadCount > 0) {
+            size_t blocks = (size * threadsBefore / threadCount) / this->blockSize;
+            end = std::min(to, from + blocks * this->blockSize);
+        }
+        parts[i].next = start;
+        parts[i].end = std::max(start, end);
+        start = parts[i].end;
+    }
+}
+
+bool NumaWorkQueue::next(int node, size_t &blockStart, size_t &blockEnd) {
+    const size_t nodes = parts.size();
+    for (size_t i = 0; i < nodes; i++) {
+        Part &part = parts[(node + i) % nodes];
+        if (part.next >= part.end) {
+            continue;
+        }
+        size_t start = __sync_fetch_and_add(&(part.next), blockSize);
+        if (start < part.end) {
+            blockStart = start;
+            blockEnd = std::min(start + blockSize, part.end);
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,61 @@
+#ifndef MMSEQS_NUMA_H
+#define MMSEQS_NUMA_H
+
+//
+// NUMA placement for the prefilter and alignment thread teams.
+// The topology is read from /sys/devices/system/node, memory policies are set with
+// set_mempolicy so no libnuma is required. On other systems there is a single node.
+//
+
+#include <cstddef>
+#include <vector>
+
+class Numa {
+public:
+    // number of NUMA nodes with CPUs
+    static int getNodeCount();
+
+    // threads are placed in contiguous blocks, thread threadIdx of threadCount runs on this node
+    static int getThreadNode(unsigned int threadIdx, unsigned int threadCount);
+
+    // restrict the calling thread to the CPUs of its node, returns the node
+    static int pinThread(unsigned int threadIdx, unsigned int threadCount);
+
+    // let the calling thread run on all CPUs of the process again, pool threads are reused by later parallel regions
+    static void unpinThread();
+
+    // pages allocated by the calling thread and all OpenMP worker threads are spread round robin over all nodes,
+    // this includes page cache pages of mapped files. The policy is per thread, so it is set inside a parallel region.
+    static void setInterleavePolicy();
+
+    // allocate pages on the node of the faulting thread again, for the calling thread and all OpenMP worker threads
+    static void setDefaultPolicy();
+
+    static void printThroughput(const std::vector<size_t> &itemsPerNode, double seconds, const char *unit);
+
+private:
+    static const std::vector<std::vector<int> > &getNodeCpus();
+};
+
+// Hands out blocks of a range, every node owns a contiguous part of the range that is proportional to its threads.
+// Threads first work on the part of their own node and then help with the parts of the other nodes.
+class NumaWorkQueue {
+public:
+    NumaWorkQueue(size_t from, size_t to, size_t blockSize, unsigned int threadCount);
+
+    // returns false once the whole range was handed out
+    bool next(int node, size_t &blockStart, size_t &blockEnd);
+
+private:
+    struct Part {
+        size_t next;
+        size_t end;
+        // keep the counters of different nodes on separate cache lines
+        char padding[64 - 2 * sizeof(size_t)];
+    };
+
+    std::vector<Part> parts;
+    size_t blockSize;
+};
+
+#endif
@@ -62,6 +62,12 @@ Parameters::Parameters():
         PARAM_PRELOAD_MODE(PARAM_PRELOAD_MODE_ID, "--db-load-mode", "Preload mode", "Database preload mode 0: auto, 1: fread, 2: mmap, 3: mmap+touch", typeid(int), (void *) &preloadMode, "[0-3]{1}", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
         PARAM_SPACED_KMER_PATTERN(PARAM_SPACED_KMER_PATTERN_ID, "--spaced-kmer-pattern", "Spaced k-mer pattern", "User-specified spaced k-mer pattern", typeid(std::string), (void *) &spacedKmerPattern, "^1[01]*1$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
         PARAM_LOCAL_TMP(PARAM_LOCAL_TMP_ID, "--local-tmp", "Local temporary path", "Path where some of the temporary files will be created", typeid(std::string), (void *) &localTmp, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_PREF_BATCH_SIZE(PARAM_PREF_BATCH_SIZE_ID, "--prefilter-batch-size", "Prefilter batch size", "Match this many queries per thread together, so index table lists are read once per batch (1: no batching)", typeid(int), (void *) &prefilterBatchSize, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_INDEX_COMPRESSION(PARAM_INDEX_COMPRESSION_ID, "--index-compression", "Index compression", "0: store k-mer lists uncompressed; 1: store k-mer lists delta and bit-packed to reduce index memory at some decoding cost", typeid(int), (void *) &indexCompression, "^[0-1]{1}$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_PREFETCH_DISTANCE(PARAM_PREFETCH_DISTANCE_ID, "--prefetch-distance", "Prefetch distance", "Prefetch index table lists this many k-mers ahead. 0: tune automatically per thread", typeid(int), (void *) &prefetchDistance, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_PREFILTER_SERVER(PARAM_PREFILTER_SERVER_ID, "--prefilter-server", "Prefilter server", "Run the prefilter in the prefilterserver listening on this UNIX socket, which keeps the target index in memory", typeid(std::string), (void *) &prefilterServer, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_MAX_KMERS_PER_POS(PARAM_MAX_KMERS_PER_POS_ID, "--max-kmers-per-pos", "Max. k-mers per position", "Raise the k-mer similarity threshold per query until at most this many similar k-mers per residue are matched. 0: use the same threshold for all queries", typeid(float), (void *) &maxKmersPerPos, "^[0-9]*(\\.[0-9]+)?$", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_NUMA(PARAM_NUMA_ID, "--numa", "NUMA placement", "Interleave the index over NUMA nodes, pin threads to nodes and split queries per node", typeid(bool), (void *) &numa, "", MMseqsParameter::COMMAND_PREFILTER | MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         // alignment
         PARAM_ALIGNMENT_MODE(PARAM_ALIGNMENT_MODE_ID, "--alignment-mode", "Alignment mode", "How to compute the alignment:\n0: automatic\n1: only score and end_pos\n2: also start_pos and cov\n3: also seq.id\n4: only ungapped alignment", typeid(int), (void *) &alignmentMode, "^[0-5]{1}$", MMseqsParameter::COMMAND_ALIGN),
         PARAM_ALIGNMENT_OUTPUT_MODE(PARAM_ALIGNMENT_OUTPUT_MODE_ID, "--alignment-output-mode", "Alignment mode", "How to compute the alignment:\n0: automatic\n1: only score and end_pos\n2: also start_pos and cov\n3: also seq.id\n4: only ungapped alignment\n5: score only (output) cluster format", typeid(int), (void *) &alignmentOutputMode, "^[0-1]{1}$", MMseqsParameter::COMMAND_ALIGN),
@@ -72,6 +78,7 @@ Parameters::Parameters():
         PARAM_MAX_REJECTED(PARAM_MAX_REJECTED_ID, "--max-rejected", "Max reject", "Maximum rejected alignments before alignment calculation for a query is stopped", typeid(int), (void *) &maxRejected, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN),
         PARAM_MAX_ACCEPT(PARAM_MAX_ACCEPT_ID, "--max-accept", "Max accept", "Maximum accepted alignments before alignment calculation for a query is stopped", typeid(int), (void *) &maxAccept, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN),
         PARAM_ADD_BACKTRACE(PARAM_ADD_BACKTRACE_ID, "-a", "Add backtrace", "Add backtrace string (convert to alignments with mmseqs convertalis module)", typeid(bool), (void *) &addBacktrace, "", MMseqsParameter::COMMAND_ALIGN),
+        PARAM_BINARY_ALIGNMENT(PARAM_BINARY_ALIGNMENT_ID, "--binary-alignment", "Binary alignment", "Write fixed-width binary alignment records that convertalis, result2profile, expandaln and clust read without parsing", typeid(bool), (void *) &binaryAlignment, "", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_REALIGN(PARAM_REALIGN_ID, "--realign", "Realign hits", "Compute more conservative, shorter alignments (scores and E-values not changed)", typeid(bool), (void *) &realign, "", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         PARAM_MIN_SEQ_ID(PARAM_MIN_SEQ_ID_ID, "--min-seq-id", "Seq. id. threshold", "List matches above this sequence identity (for clustering) (range 0.0-1.0)", typeid(float), (void *) &seqIdThr, "^0(\\.[0-9]+)?|1(\\.0+)?$", MMseqsParameter::COMMAND_ALIGN),
         PARAM_MIN_ALN_LEN(PARAM_MIN_ALN_LEN_ID, "--min-aln-len", "Min alignment length", "Minimum alignment length (range 0-INT_MAX)", typeid(int), (void *) &alnLenThr, "^[0-9]{1}[0-9]*$", MMseqsParameter::COMMAND_ALIGN),
@@ -89,6 +96,7 @@ Parameters::Parameters():
         PARAM_CLUSTER_REASSIGN(PARAM_CLUSTER_REASSIGN_ID, "--cluster-reassign", "Cluster reassign", "Cascaded clustering can cluster sequence that do not fulfill the clustering criteria.\nCluster reassignment corrects these errors", typeid(bool), (void *) &clusterReassignment, "", MMseqsParameter::COMMAND_CLUST),
         // affinity clustering
         PARAM_MAXITERATIONS(PARAM_MAXITERATIONS_ID, "--max-iterations", "Max connected component depth", "Maximum depth of breadth first search in connected component clustering", typeid(int), (void *) &maxIteration, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_PARALLEL_SET_COVER(PARAM_PARALLEL_SET_COVER_ID, "--parallel-set-cover", "Parallel set cover", "Pick set cover representatives in parallel rounds, ties between sets of the same size go to the longer sequence.\nGraphs that do not fit into --split-memory-limit always use the rounds", typeid(bool), (void *) &parallelSetCover, "", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
         PARAM_SIMILARITYSCORE(PARAM_SIMILARITYSCORE_ID, "--similarity-type", "Similarity type", "Type of score used for clustering. 1: alignment score 2: sequence identity", typeid(int), (void *) &similarityScoreType, "^[1-2]{1}$", MMseqsParameter::COMMAND_CLUST | MMseqsParameter::COMMAND_EXPERT),
         // logging
         PARAM_V(PARAM_V_ID, "-v", "Verbosity", "Verbosity level: 0: quiet, 1: +errors, 2: +warnings, 3: +info", typeid(int), (void *) &verbosity, "^[0-3]{1}$", MMseqsParameter::COMMAND_COMMON),
@@ -143,6 +151,7 @@ Parameters::Parameters():
         PARAM_PICK_N_SIMILAR(PARAM_PICK_N_SIMILAR_ID, "--pick-n-sim-kmer", "Add N similar to search", "Add N similar k-mers to search", typeid(int), (void *) &pickNbest, "^[1-9]{1}[0-9]*$", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
         PARAM_ADJUST_KMER_LEN(PARAM_ADJUST_KMER_LEN_ID, "--adjust-kmer-len", "Adjust k-mer length", "Adjust k-mer length based on specificity (only for nucleotides)", typeid(bool), (void *) &adjustKmerLength, "", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
         PARAM_RESULT_DIRECTION(PARAM_RESULT_DIRECTION_ID, "--result-direction", "Result direction", "result is 0: query, 1: target centric", typeid(int), (void *) &resultDirection, "^[0-1]{1}$", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_KMER_TABLE(PARAM_KMER_TABLE_ID, "--kmer-table", "K-mer table", "Path to a sorted k-mer table that is reused and extended by later runs on a database grown with the same keys.\nNot used when the k-mers are split or with --adjust-kmer-len", typeid(std::string), (void *) &kmerTable, "", MMseqsParameter::COMMAND_CLUSTLINEAR | MMseqsParameter::COMMAND_EXPERT),
 
         // workflow
         PARAM_RUNNER(PARAM_RUNNER_ID, "--mpi-runner", "MPI runner", "Use MPI on compute cluster with this MPI command (e.g. \"mpirun -np 42\")", typeid(std::string), (void *) &runner, "", MMseqsParameter::COMMAND_COMMON | MMseqsParameter::COMMAND_EXPERT),
@@ -159,6 +168,7 @@ Parameters::Parameters():
         PARAM_ORF_FILTER_S(PARAM_ORF_FILTER_S_ID, "--orf-filter-s", "ORF filter sensitivity", "Sensitivity used for query ORF prefiltering", typeid(float), (void *) &orfFilterSens, "^[0-9]*(\\.[0-9]+)?$"),
         PARAM_ORF_FILTER_E(PARAM_ORF_FILTER_E_ID, "--orf-filter-e", "ORF filter e-value", "E-value threshold used for query ORF prefiltering", typeid(double), (void *) &orfFilterEval, "^([-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?)|[0-9]*(\\.[0-9]+)?$"),
         PARAM_LCA_SEARCH(PARAM_LCA_SEARCH_ID, "--lca-search", "LCA search mode", "Efficient search for LCA candidates", typeid(bool), (void *) &lcaSearch, "", MMseqsParameter::COMMAND_PROFILE | MMseqsParameter::COMMAND_EXPERT),
+        PARAM_FUSED_ALIGN(PARAM_FUSED_ALIGN_ID, "--fused-align", "Fused prefilter and alignment", "Align the prefilter hits in memory without writing a prefilter result DB (single sensitivity step, index must fit into memory)", typeid(bool), (void *) &fusedAlign, "", MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_EXPERT),
         // easysearch
         PARAM_GREEDY_BEST_HITS(PARAM_GREEDY_BEST_HITS_ID, "--greedy-best-hits", "Greedy best hits", "Choose the best hits greedily to cover the query", typeid(bool), (void *) &greedyBestHits, ""),
         // extractorfs
@@ -337,6 +347,7 @@ Parameters::Parameters():
     // alignment
     align.push_back(&PARAM_SUB_MAT);
     align.push_back(&PARAM_ADD_BACKTRACE);
+    align.push_back(&PARAM_BINARY_ALIGNMENT);
     align.push_back(&PARAM_ALIGNMENT_MODE);
     align.push_back(&PARAM_ALIGNMENT_OUTPUT_MODE);
     align.push_back(&PARAM_WRAPPED_SCORING);
@@ -353,6 +364,7 @@ Parameters::Parameters():
     align.push_back(&PARAM_MAX_ACCEPT);
     align.push_back(&PARAM_INCLUDE_IDENTITY);
     align.push_back(&PARAM_PRELOAD_MODE);
+    align.push_back(&PARAM_NUMA);
     align.push_back(&PARAM_PCA);
     align.push_back(&PARAM_PCB);
     align.push_back(&PARAM_SCORE_BIAS);
@@ -393,6 +405,12 @@ Parameters::Parameters():
     prefilter.push_back(&PARAM_PCB);
     prefilter.push_back(&PARAM_SPACED_KMER_PATTERN);
     prefilter.push_back(&PARAM_LOCAL_TMP);
+    prefilter.push_back(&PARAM_PREF_BATCH_SIZE);
+    prefilter.push_back(&PARAM_INDEX_COMPRESSION);
+    prefilter.push_back(&PARAM_PREFETCH_DISTANCE);
+    prefilter.push_back(&PARAM_PREFILTER_SERVER);
+    prefilter.push_back(&PARAM_MAX_KMERS_PER_POS);
+    prefilter.push_back(&PARAM_NUMA);
     prefilter.push_back(&PARAM_THREADS);
     prefilter.push_back(&PARAM_COMPRESSED);
     prefilter.push_back(&PARAM_V);
@@ -412,11 +430,18 @@ Parameters::Parameters():
     // clustering
     clust.push_back(&PARAM_CLUSTER_MODE);
     clust.push_back(&PARAM_MAXITERATIONS);
+    clust.push_back(&PARAM_PARALLEL_SET_COVER);
     clust.push_back(&PARAM_SIMILARITYSCORE);
+    clust.push_back(&PARAM_SPLIT_MEMORY_LIMIT);
     clust.push_back(&PARAM_THREADS);
     clust.push_back(&PARAM_COMPRESSED);
     clust.push_back(&PARAM_V);
 
+    // createclustgraph
+    createclustgraph.push_back(&PARAM_SIMILARITYSCORE);
+    createclustgraph.push_back(&PARAM_THREADS);
+    createclustgraph.push_back(&PARAM_V);
+
     // rescorediagonal
     rescorediagonal.push_back(&PARAM_SUB_MAT);
     rescorediagonal.push_back(&PARAM_RESCORE_MODE);
@@ -699,6 +724,7 @@ Parameters::Parameters():
     indexdb.push_back(&PARAM_SEARCH_TYPE);
     indexdb.push_back(&PARAM_SPLIT);
     indexdb.push_back(&PARAM_SPLIT_MEMORY_LIMIT);
+    indexdb.push_back(&PARAM_INDEX_COMPRESSION);
     indexdb.push_back(&PARAM_V);
     indexdb.push_back(&PARAM_THREADS);
 
@@ -881,6 +907,7 @@ Parameters::Parameters():
     kmermatcher.push_back(&PARAM_SPLIT_MEMORY_LIMIT);
     kmermatcher.push_back(&PARAM_INCLUDE_ONLY_EXTENDABLE);
     kmermatcher.push_back(&PARAM_IGNORE_MULTI_KMER);
+    kmermatcher.push_back(&PARAM_KMER_TABLE);
     kmermatcher.push_back(&PARAM_THREADS);
     kmermatcher.push_back(&PARAM_COMPRESSED);
     kmermatcher.push_back(&PARAM_V);
@@ -1123,6 +1150,8 @@ Parameters::Parameters():
     sortresult.push_back(&PARAM_V);
 
     // WORKFLOWS
+    prefilteralign = combineList(prefilter, align);
+
     searchworkflow = combineList(align, prefilter);
     searchworkflow = combineList(searchworkflow, rescorediagonal);
     searchworkflow = combineList(searchworkflow, result2profile);
@@ -1139,6 +1168,7 @@ Parameters::Parameters():
     searchworkflow.push_back(&PARAM_EXHAUSTIVE_SEARCH_FILTER);
     searchworkflow.push_back(&PARAM_STRAND);
     searchworkflow.push_back(&PARAM_LCA_SEARCH);
+    searchworkflow.push_back(&PARAM_FUSED_ALIGN);
     searchworkflow.push_back(&PARAM_DISK_SPACE_LIMIT);
     searchworkflow.push_back(&PARAM_RUNNER);
     searchworkflow.push_back(&PARAM_REUSELATEST);
@@ -1152,6 +1182,8 @@ Parameters::Parameters():
     linsearchworkflow.push_back(&PARAM_RUNNER);
     linsearchworkflow.push_back(&PARAM_REUSELATEST);
     linsearchworkflow.push_back(&PARAM_REMOVE_TMP_FILES);
+    // the alignments are always swapped and swapresults reads text results
+    linsearchworkflow = removeParameter(linsearchworkflow, PARAM_BINARY_ALIGNMENT);
 
     // easyslinsearch
     easylinsearchworkflow = combineList(createlinindex, linsearchworkflow);
@@ -1213,6 +1245,7 @@ Parameters::Parameters():
     taxonomy = removeParameter(taxonomy, PARAM_NUM_ITERATIONS);
     taxonomy = removeParameter(taxonomy, PARAM_START_SENS);
     taxonomy = removeParameter(taxonomy, PARAM_SENS_STEPS);
+    taxonomy = removeParameter(taxonomy, PARAM_BINARY_ALIGNMENT);
 
     // easy taxonomy
     easytaxonomy = combineList(taxonomy, addtaxonomy);
@@ -1231,9 +1264,14 @@ Parameters::Parameters():
 
     // multi hit search
     multihitsearch = combineList(searchworkflow, besthitbyset);
+    multihitsearch = removeParameter(multihitsearch, PARAM_BINARY_ALIGNMENT);
 
     clusterUpdateSearch = removeParameter(searchworkflow, PARAM_MAX_SEQS);
     clusterUpdateClust = removeParameter(clusterworkflow, PARAM_MAX_SEQS);
+    clusterUpdateSearch = removeParameter(clusterUpdateSearch, PARAM_BINARY_ALIGNMENT);
+    clusterUpdateClust = removeParameter(clusterUpdateClust, PARAM_BINARY_ALIGNMENT);
+    // only the new sequences without a hit are clustered under new keys, a k-mer table of the old database cannot be reused
+    clusterUpdateClust = removeParameter(clusterUpdateClust, PARAM_KMER_TABLE);
     clusterUpdate = combineList(clusterUpdateSearch, clusterUpdateClust);
     clusterUpdate.push_back(&PARAM_REUSELATEST);
     clusterUpdate.push_back(&PARAM_USESEQID);
@@ -1253,6 +1291,7 @@ Parameters::Parameters():
     enrichworkflow = combineList(enrichworkflow, align);
     enrichworkflow = combineList(enrichworkflow, expandaln);
     enrichworkflow = combineList(enrichworkflow, result2profile);
+    enrichworkflow = removeParameter(enrichworkflow, PARAM_BINARY_ALIGNMENT);
 
     databases.push_back(&PARAM_HELP);
     databases.push_back(&PARAM_HELP_LONG);
@@ -2096,6 +2135,12 @@ void Parameters::setDefaults() {
     splitAA = false;
     spacedKmerPattern = "";
     localTmp = "";
+    prefilterBatchSize = 1;
+    indexCompression = 0;
+    prefetchDistance = 0;
+    prefilterServer = "";
+    maxKmersPerPos = 0.0;
+    numa = false;
 
     // search workflow
     numIterations = 1;
@@ -2108,6 +2153,7 @@ void Parameters::setDefaults() {
     orfFilterSens = 2.0;
     orfFilterEval = 100;
     lcaSearch = false;
+    fusedAlign = false;
 
     greedyBestHits = false;
 
@@ -2150,6 +2196,7 @@ void Parameters::setDefaults() {
     gapExtend = MultiParam<int>(1, 2);
     zdrop = 40;
     addBacktrace = false;
+    binaryAlignment = false;
     realign = false;
     clusteringMode = SET_COVER;
     singleStepClustering = false;
@@ -2162,6 +2209,7 @@ void Parameters::setDefaults() {
 
     // affinity clustering
     maxIteration=1000;
+    parallelSetCover = false;
     similarityScoreType=APC_SEQID;
 
     // workflow
@@ -2329,6 +2377,7 @@ void Parameters::setDefaults() {
     pickNbest = 1;
     adjustKmerLength = false;
     resultDirection = Parameters::PARAM_RESULT_DIRECTION_TARGET;
+    kmerTable = "";
     // result2stats
     stat = "";
 
@@ -82,6 +82,8 @@ public:
     static const int DBTYPE_FLATFILE = 17; // needed for verification
     static const int DBTYPE_SEQTAXDB = 18; // needed for verification
     static const int DBTYPE_STDIN = 19; // needed for verification
+    static const int DBTYPE_CLUSTER_GRAPH = 20;
+    static const int DBTYPE_BINARY_ALIGNMENT_RES = 21;
 
 
     // don't forget to add new database types to DBReader::getDbTypeName and Parameters::PARAM_OUTPUT_DBTYPE
@@ -385,6 +387,12 @@ public:
     int    realignMaxSeqs;               // Max alignments to realign
     std::string spacedKmerPattern;       // User-specified kmer pattern
     std::string localTmp;                // Local temporary path
+    int    prefilterBatchSize;           // Queries matched together against the index table
+    int    indexCompression;             // Store the index table k-mer lists compressed
+    int    prefetchDistance;             // Prefetch index table lists ahead of matching
+    std::string prefilterServer;         // Socket of a prefilter server that runs the call
+    float  maxKmersPerPos;               // Similar k-mer budget per query residue
+    bool   numa;                         // NUMA aware index placement and thread pinning
 
     // ALIGNMENT
     int alignmentMode;                   // alignment mode 0=fastest on parameters,
@@ -401,6 +409,7 @@ public:
     float  seqIdThr;                     // sequence identity threshold for acceptance
     int    alnLenThr;                    // min. alignment length
     bool   addBacktrace;                 // store backtrace string (M=Match, D=deletion, I=insertion)
+    bool   binaryAlignment;              // write fixed-width binary alignment records
     bool   realign;                      // realign hit with more conservative score
     MultiParam<int> gapOpen;             // gap open cost
     MultiParam<int> gapExtend;           // gap extension cost
@@ -427,12 +436,14 @@ public:
     float orfFilterSens;
     double orfFilterEval;
     bool lcaSearch;
+    bool fusedAlign;
 
     // easysearch
     bool greedyBestHits;
 
     //CLUSTERING
     int maxIteration;                   // Maximum depth of breadth first search in connected component
+    bool parallelSetCover;              // Pick set cover representatives in parallel rounds
     int similarityScoreType;            // Type of score to use for reassignment 1=alignment score. 2=coverage 3=sequence identity 4=E-value 5= Score per Column
 
     //extractorfs
@@ -508,6 +519,7 @@ public:
     int pickNbest;
     int adjustKmerLength;
     int resultDirection;
+    std::string kmerTable;
 
     // indexdb
     int checkCompatible;
@@ -705,6 +717,12 @@ public:
     PARAMETER(PARAM_PRELOAD_MODE)
     PARAMETER(PARAM_SPACED_KMER_PATTERN)
     PARAMETER(PARAM_LOCAL_TMP)
+    PARAMETER(PARAM_PREF_BATCH_SIZE)
+    PARAMETER(PARAM_INDEX_COMPRESSION)
+    PARAMETER(PARAM_PREFETCH_DISTANCE)
+    PARAMETER(PARAM_PREFILTER_SERVER)
+    PARAMETER(PARAM_MAX_KMERS_PER_POS)
+    PARAMETER(PARAM_NUMA)
     std::vector<MMseqsParameter*> prefilter;
     std::vector<MMseqsParameter*> ungappedprefilter;
 
@@ -718,6 +736,7 @@ public:
     PARAMETER(PARAM_MAX_REJECTED)
     PARAMETER(PARAM_MAX_ACCEPT)
     PARAMETER(PARAM_ADD_BACKTRACE)
+    PARAMETER(PARAM_BINARY_ALIGNMENT)
     PARAMETER(PARAM_REALIGN)
     PARAMETER(PARAM_MIN_SEQ_ID)
     PARAMETER(PARAM_MIN_ALN_LEN)
@@ -737,11 +756,13 @@ public:
 
     // affinity clustering
     PARAMETER(PARAM_MAXITERATIONS)
+    PARAMETER(PARAM_PARALLEL_SET_COVER)
     PARAMETER(PARAM_SIMILARITYSCORE)
 
     // logging
     PARAMETER(PARAM_V)
     std::vector<MMseqsParameter*> clust;
+    std::vector<MMseqsParameter*> createclustgraph;
 
     // format alignment
     PARAMETER(PARAM_FORMAT_MODE)
@@ -802,6 +823,7 @@ public:
     PARAMETER(PARAM_PICK_N_SIMILAR)
     PARAMETER(PARAM_ADJUST_KMER_LEN)
     PARAMETER(PARAM_RESULT_DIRECTION)
+    PARAMETER(PARAM_KMER_TABLE)
     // workflow
     PARAMETER(PARAM_RUNNER)
     PARAMETER(PARAM_REUSELATEST)
@@ -817,6 +839,7 @@ public:
     PARAMETER(PARAM_ORF_FILTER_S)
     PARAMETER(PARAM_ORF_FILTER_E)
     PARAMETER(PARAM_LCA_SEARCH)
+    PARAMETER(PARAM_FUSED_ALIGN)
 
     // easysearch
     PARAMETER(PARAM_GREEDY_BEST_HITS)
@@ -997,6 +1020,7 @@ public:
 
     std::vector<MMseqsParameter*> alignall;
     std::vector<MMseqsParameter*> align;
+    std::vector<MMseqsParameter*> prefilteralign;
     std::vector<MMseqsParameter*> rescorediagonal;
     std::vector<MMseqsParameter*> alignbykmer;
     std::vector<MMseqsParameter*> createFasta;
@@ -1126,6 +1150,8 @@ public:
             case DBTYPE_DIRECTORY: return "Directory";
             case DBTYPE_FLATFILE: return "Flatfile";
             case DBTYPE_STDIN: return "stdin";
+            case DBTYPE_CLUSTER_GRAPH: return "Cluster graph";
+            case DBTYPE_BINARY_ALIGNMENT_RES: return "Binary alignment";
 
             default: return "Unknown";
         }
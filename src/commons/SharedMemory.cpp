@@ -0,0 +1,181 @@
+#include "SharedMemory.h"
+#include "FileUtil.h"
+#include "Debug.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// written behind the file content once the copy is complete
+static const uint64_t SEGMENT_COMPLETE = 0x6d6d73657173686dULL;
+
+std::string SharedMemory::getSegmentName(const std::string &file) {
+    char *path = realpath(file.c_str(), NULL);
+    if (path == NULL) {
+        return "";
+    }
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        free(path);
+        return "";
+    }
+    std::string key(path);
+    free(path);
+    key.append(SSTR(static_cast<long long>(st.st_size)));
+    key.push_back(':');
+    key.append(SSTR(static_cast<long long>(st.st_mtime)));
+    // macOS limits segment names to 31 characters
+    char name[32];
+    snprintf(name, sizeof(name), "/mmseqs-%016zx", Util::hash(key.c_str(), key.size()));
+    return name;
+}
+
+#ifdef HAVE_SHM_OPEN
+// the segment holds a complete copy of size bytes, it is incomplete while it is being loaded
+static bool isComplete(int fd, size_t size) {
+    struct stat st;
+    uint64_t complete = 0;
+    return fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == size + sizeof(uint64_t)
+           && pread(fd, &complete, sizeof(uint64_t), size) == sizeof(uint64_t) && complete == SEGMENT_COMPLETE;
+}
+
+char *SharedMemory::attach(const std::string &file, size_t size) {
+    std::string name = getSegmentName(file);
+    if (name.empty() || size == 0) {
+        return NULL;
+    }
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (isComplete(fd, size) == false) {
+        // still being loaded or from another file
+        close(fd);
+        return NULL;
+    }
+    void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        Debug(Debug::WARNING) << "Could not map shared memory copy of " << file << ": " << strerror(errno) << "\n";
+        return NULL;
+    }
+    return static_cast<char *>(data);
+}
+
+bool SharedMemory::load(const std::string &file, bool &created) {
+    created = false;
+    std::string name = getSegmentName(file);
+    if (name.empty()) {
+        Debug(Debug::ERROR) << "Could not stat " << file << "\n";
+        return false;
+    }
+    FILE *input = FileUtil::openFileOrDie(file.c_str(), "r", true);
+    struct stat st;
+    if (fstat(fileno(input), &st) != 0) {
+        Debug(Debug::ERROR) << "Could not stat " << file << "\n";
+        fclose(input);
+        return false;
+    }
+    const size_t size = st.st_size;
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        fclose(input);
+        if (errno == EEXIST) {
+            fd = shm_open(name.c_str(), O_RDONLY, 0);
+            const bool complete = fd >= 0 && isComplete(fd, size);
+            if (fd >= 0) {
+                close(fd);
+            }
+            if (complete == false) {
+                Debug(Debug::ERROR) << "Shared memory segment " << name << " of " << file << " is incomplete. "
+                                    << "Another loadidx is still loading it or an earlier one was interrupted, "
+                                    << "remove it with unloadidx if no loadidx is running\n";
+                return false;
+            }
+            Debug(Debug::INFO) << file << " is already loaded\n";
+            return true;
+        }
+        Debug(Debug::ERROR) << "Could not create shared memory segment " << name << ": " << strerror(errno) << "\n";
+        return false;
+    }
+    const size_t segmentSize = size + sizeof(uint64_t);
+    if (ftruncate(fd, segmentSize) != 0) {
+        Debug(Debug::ERROR) << "Could not allocate " << segmentSize << " bytes of shared memory: " << strerror(errno) << "\n";
+        close(fd);
+        shm_unlink(name.c_str());
+        fclose(input);
+        return false;
+    }
+    char *data = static_cast<char *>(mmap(NULL, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+    close(fd);
+    if (data == MAP_FAILED) {
+        Debug(Debug::ERROR) << "Could not map shared memory segment " << name << ": " << strerror(errno) << "\n";
+        shm_unlink(name.c_str());
+        fclose(input);
+        return false;
+    }
+#ifdef MADV_HUGEPAGE
+    // only effective for shared memory if /sys/kernel/mm/transparent_hugepage/shmem_enabled allows it
+    madvise(data, segmentSize, MADV_HUGEPAGE);
+#endif
+    size_t done = 0;
+    while (done < size) {
+        size_t result = fread(data + done, 1, std::min(size - done, static_cast<size_t>(64 * 1024 * 1024)), input);
+        if (result == 0) {
+            break;
+        }
+        done += result;
+    }
+    fclose(input);
+    if (done != size) {
+        Debug(Debug::ERROR) << "Could not read " << file << "\n";
+        munmap(data, segmentSize);
+        shm_unlink(name.c_str());
+        return false;
+    }
+    memcpy(data + size, &SEGMENT_COMPLETE, sizeof(uint64_t));
+    munmap(data, segmentSize);
+    created = true;
+    return true;
+}
+
+bool SharedMemory::unload(const std::string &file) {
+    std::string name = getSegmentName(file);
+    if (name.empty()) {
+        Debug(Debug::ERROR) << "Could not stat " << file << "\n";
+        return false;
+    }
+    if (shm_unlink(name.c_str()) != 0) {
+        if (errno == ENOENT) {
+            Debug(Debug::INFO) << file << " is not loaded\n";
+            return true;
+        }
+        Debug(Debug::ERROR) << "Could not remove shared memory segment " << name << ": " << strerror(errno) << "\n";
+        return false;
+    }
+    return true;
+}
+#else
+char *SharedMemory::attach(const std::string &, size_t) {
+    return NULL;
+}
+
+bool SharedMemory::load(const std::string &, bool &created) {
+    created = false;
+    Debug(Debug::ERROR) << "Shared memory is not supported on this system\n";
+    return false;
+}
+
+bool SharedMemory::unload(const std::string &) {
+    Debug(Debug::ERROR) << "Shared memory is not supported on this system\n";
+    return false;
+}
+#endif
@@ -0,0 +1,29 @@
+#ifndef MMSEQS_SHAREDMEMORY_H
+#define MMSEQS_SHAREDMEMORY_H
+
+//
+// Copies of database files in named POSIX shared memory segments.
+// A segment is loaded once per node (mmseqs loadidx) and every process that opens the
+// file with DBReader::USE_SHARED_MEMORY maps the same physical pages instead of its own copy.
+//
+
+#include <cstddef>
+#include <string>
+
+class SharedMemory {
+public:
+    // segment name of a file, it changes with the file size and modification time, so a stale copy is never attached
+    static std::string getSegmentName(const std::string &file);
+
+    // map the segment of file read-only, returns NULL if the file was not loaded
+    static char *attach(const std::string &file, size_t size);
+
+    // copy file into a new segment, the segment asks for transparent huge pages
+    // succeeds without a copy if a complete segment exists already, created is only set if this call made the segment
+    static bool load(const std::string &file, bool &created);
+
+    // remove the segment of file, processes that attached it keep their mapping
+    static bool unload(const std::string &file);
+};
+
+#endif
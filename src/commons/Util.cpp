@@ -387,6 +387,59 @@ uint64_t Util::getL2CacheSize() {
     return 262144;
 }
 
+int Util::getCpuSimdLevel() {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    static const int level = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512bw")) {
+            return static_cast<int>(SIMD_AVX512BW);
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return static_cast<int>(SIMD_AVX2);
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return static_cast<int>(SIMD_SSE4_1);
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return static_cast<int>(SIMD_SSE2);
+        }
+        return static_cast<int>(SIMD_GENERIC);
+    }();
+    return level;
+#else
+    return getCompiledSimdLevel();
+#endif
+}
+
+int Util::getCompiledSimdLevel() {
+#if defined(__AVX512BW__)
+    return SIMD_AVX512BW;
+#elif defined(__AVX2__)
+    return SIMD_AVX2;
+#elif defined(__SSE4_1__)
+    return SIMD_SSE4_1;
+#elif defined(__SSE2__)
+    return SIMD_SSE2;
+#else
+    return SIMD_GENERIC;
+#endif
+}
+
+const char *Util::getSimdLevelName(int level) {
+    switch (level) {
+        case SIMD_AVX512BW:
+            return "AVX-512BW";
+        case SIMD_AVX2:
+            return "AVX2";
+        case SIMD_SSE4_1:
+            return "SSE4.1";
+        case SIMD_SSE2:
+            return "SSE2";
+        default:
+            return "generic";
+    }
+}
+
 char Util::touchMemory(const char *memory, size_t size) {
 #ifdef HAVE_POSIX_MADVISE
     if (size > 0 && posix_madvise ((void*)memory, size, POSIX_MADV_WILLNEED) != 0){
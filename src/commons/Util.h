@@ -88,6 +88,23 @@ public:
     static size_t getTotalMemoryPages();
     static uint64_t getL2CacheSize();
 
+    // x86 SIMD extensions in increasing order. Only the ungapped prefilter kernel (UngappedAlignment)
+    // selects its width at runtime. The Smith-Waterman kernels (ssw_align, ssw_score_batch), MSA and PSSM
+    // code are compiled for a single level, so per-ISA builds (util/mmseqs_wrapper.sh) are still needed
+    // to use wider vectors there
+    enum SimdLevel {
+        SIMD_GENERIC = 0,
+        SIMD_SSE2,
+        SIMD_SSE4_1,
+        SIMD_AVX2,
+        SIMD_AVX512BW
+    };
+    // highest SIMD level supported by the CPU
+    static int getCpuSimdLevel();
+    // SIMD level the compiler was allowed to use for this binary
+    static int getCompiledSimdLevel();
+    static const char *getSimdLevelName(int level);
+
     static char touchMemory(const char* memory, size_t size);
 
     static size_t countLines(const char *data, size_t length);
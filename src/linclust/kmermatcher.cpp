@@ -30,6 +30,10 @@
 #define SIZE_T_MAX ((size_t) -1)
 #endif
 
+// k-mer arrays smaller than this are sorted at once
+const size_t MIN_BUCKET_SORT_SIZE = 1 << 16;
+const unsigned int MAX_BUCKET_BITS = 16;
+
 uint64_t hashUInt64(uint64_t in, uint64_t seed) {
 #if SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_BIG
     in = __builtin_bswap64(in);
@@ -37,17 +41,17 @@ uint64_t hashUInt64(uint64_t in, uint64_t seed) {
     return XXH64(&in, sizeof(uint64_t), seed);
 }
 
-template <typename T>
-KmerPosition<T> *initKmerPositionMemory(size_t size) {
-    KmerPosition<T> * hashSeqPair = new(std::nothrow) KmerPosition<T>[size + 1];
+template <typename T, bool IncludeSeqLen>
+KmerPosition<T, IncludeSeqLen> *initKmerPositionMemory(size_t size) {
+    KmerPosition<T, IncludeSeqLen> * hashSeqPair = new(std::nothrow) KmerPosition<T, IncludeSeqLen>[size + 1];
     Util::checkAllocation(hashSeqPair, "Can not allocate memory");
-    size_t pageSize = Util::getPageSize()/sizeof(KmerPosition<T>);
+    size_t pageSize = Util::getPageSize()/sizeof(KmerPosition<T, IncludeSeqLen>);
 #pragma omp parallel
     {
 #pragma omp for schedule(static)
         for (size_t page = 0; page < size+1; page += pageSize) {
             size_t readUntil = std::min(size+1, page + pageSize) - page;
-            memset(hashSeqPair+page, 0xFF, sizeof(KmerPosition<T>)* readUntil);
+            memset(hashSeqPair+page, 0xFF, sizeof(KmerPosition<T, IncludeSeqLen>)* readUntil);
         }
     }
     return hashSeqPair;
@@ -74,10 +78,20 @@ void maskSequence(int maskMode, int maskLowerCase, Sequence &seq, int maskLetter
     }
 }
 
-template <int TYPE, typename T>
-std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
+// only the k-mers of kmersearch store the sequence length
+template <typename T>
+inline void setSeqLen(KmerPosition<T, true> &kmer, int seqLen) {
+    kmer.seqLen = seqLen;
+}
+
+template <typename T>
+inline void setSeqLen(KmerPosition<T, false> &, int) {}
+
+template <int TYPE, typename T, bool IncludeSeqLen>
+std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T, IncludeSeqLen> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
                                                 Parameters & par, BaseMatrix * subMat, bool hashWholeSequence,
-                                                size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution){
+                                                size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution,
+                                                const char * includeKeys){
     size_t offset = 0;
     int querySeqType  =  seqDbr.getDbtype();
     size_t longestKmer = par.kmerSize;
@@ -113,7 +127,7 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
         Indexer idxer(subMat->alphabetSize - 1,  par.kmerSize);
         const unsigned int BUFFER_SIZE = 1048576;
         size_t bufferPos = 0;
-        KmerPosition<T> * threadKmerBuffer = new KmerPosition<T>[BUFFER_SIZE];
+        KmerPosition<T, IncludeSeqLen> * threadKmerBuffer = new KmerPosition<T, IncludeSeqLen>[BUFFER_SIZE];
         SequencePosition * kmers = (SequencePosition *) malloc((par.pickNbest * (par.maxSeqLen + 1) + 1) * sizeof(SequencePosition));
         size_t kmersArraySize = par.maxSeqLen;
         const size_t flushSize = 100000000;
@@ -125,6 +139,9 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
 #pragma omp for schedule(dynamic, 100)
             for (size_t id = start; id < (start + bucketSize); id++) {
                 progress.updateProgress();
+                if (includeKeys != NULL && includeKeys[seqDbr.getDbKey(id)] == false) {
+                    continue;
+                }
                 memset(scoreDist, 0, sizeof(unsigned short) * 65536);
                 memset(hierarchicalScoreDist, 0, sizeof(unsigned int) * 128);
 
@@ -242,7 +259,7 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
                     threadKmerBuffer[bufferPos].kmer = seqHash;
                     threadKmerBuffer[bufferPos].id = seqId;
                     threadKmerBuffer[bufferPos].pos = 0;
-                    threadKmerBuffer[bufferPos].seqLen = seq.L;
+                    setSeqLen(threadKmerBuffer[bufferPos], seq.L);
                     if(hashDistribution != NULL){
                         __sync_fetch_and_add(&hashDistribution[static_cast<unsigned short>(seqHash)], 1);
                     }
@@ -251,7 +268,7 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
                         size_t writeOffset = __sync_fetch_and_add(&offset, bufferPos);
                         if(writeOffset + bufferPos < kmerArraySize){
                             if(kmerArray!=NULL){
-                                memcpy(kmerArray + writeOffset, threadKmerBuffer, sizeof(KmerPosition<T>) * bufferPos);
+                                memcpy(kmerArray + writeOffset, threadKmerBuffer, sizeof(KmerPosition<T, IncludeSeqLen>) * bufferPos);
                             }
                         } else{
                             Debug(Debug::ERROR) << "Kmer array overflow. currKmerArrayOffset="<< writeOffset
@@ -309,7 +326,7 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
                             threadKmerBuffer[bufferPos].kmer = (kmers + kmerIdx)->kmer;
                             threadKmerBuffer[bufferPos].id = seqId;
                             threadKmerBuffer[bufferPos].pos = (kmers + kmerIdx)->pos;
-                            threadKmerBuffer[bufferPos].seqLen = seq.L;
+                            setSeqLen(threadKmerBuffer[bufferPos], seq.L);
                             bufferPos++;
                             if(hashDistribution != NULL){
                                 __sync_fetch_and_add(&hashDistribution[(kmers + kmerIdx)->score], 1);
@@ -320,7 +337,7 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
                                 if(writeOffset + bufferPos < kmerArraySize){
                                     if(kmerArray!=NULL) {
                                         memcpy(kmerArray + writeOffset, threadKmerBuffer,
-                                               sizeof(KmerPosition<T>) * bufferPos);
+                                               sizeof(KmerPosition<T, IncludeSeqLen>) * bufferPos);
                                     }
                                 } else{
                                     Debug(Debug::ERROR) << "Kmer array overflow. currKmerArrayOffset="<< writeOffset
@@ -351,7 +368,7 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
         if(bufferPos > 0){
             size_t writeOffset = __sync_fetch_and_add(&offset, bufferPos);
             if(kmerArray != NULL){
-                memcpy(kmerArray+writeOffset, threadKmerBuffer, sizeof(KmerPosition<T>) * bufferPos);
+                memcpy(kmerArray+writeOffset, threadKmerBuffer, sizeof(KmerPosition<T, IncludeSeqLen>) * bufferPos);
             }
         }
         free(kmers);
@@ -374,52 +391,429 @@ std::pair<size_t, size_t> fillKmerPositionArray(KmerPosition<T> * kmerArray, siz
     return std::make_pair(offset, longestKmer);
 }
 
-template <typename T>
-KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t hashEndRange, std::string splitFile,
-                                DBReader<unsigned int> & seqDbr, Parameters & par, BaseMatrix  * subMat) {
+// bucket of a k-mer for grouping, the reverse complement k-mers of nucleotides share the bucket of their forward k-mer
+// and the hash spreads frequent k-mer prefixes over all buckets
+struct KmerHashBucket {
+    unsigned int shift;
+    size_t operator()(size_t kmer) const {
+        return hashUInt64(BIT_SET(kmer, 63), 1) >> shift;
+    }
+};
 
-    KmerPosition<T> * hashSeqPair = initKmerPositionMemory<T>(totalKmers);
-    size_t elementsToSort;
-    if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
-        std::pair<size_t, size_t > ret = fillKmerPositionArray<Parameters::DBTYPE_NUCLEOTIDES, T>(hashSeqPair, totalKmers, seqDbr, par, subMat, true, hashStartRange, hashEndRange, NULL);
-        elementsToSort = ret.first;
+// bucket of a k-mer by its representative sequence, buckets are ordered as the representative sequences
+struct RepSequenceBucket {
+    unsigned int shift;
+    size_t operator()(size_t kmer) const {
+        return BIT_CLEAR(kmer, 63) >> shift;
+    }
+};
+
+// moves the k-mers of kmers[cursor[b], end[b]) into the range of their bucket b by swapping them along cycles.
+// If the range of a bucket is full, the k-mer stays misplaced in the current range.
+template <typename T, bool IncludeSeqLen, typename Bucket>
+static void permuteKmers(KmerPosition<T, IncludeSeqLen> *kmers, size_t bucketCount, Bucket bucket, size_t *cursor, const size_t *end) {
+    for (size_t i = 0; i < bucketCount; i++) {
+        while (cursor[i] < end[i]) {
+            KmerPosition<T, IncludeSeqLen> curr = kmers[cursor[i]];
+            size_t currBucket = bucket(curr.kmer);
+            while (currBucket != i && cursor[currBucket] < end[currBucket]) {
+                std::swap(curr, kmers[cursor[currBucket]]);
+                cursor[currBucket]++;
+                currBucket = bucket(curr.kmer);
+            }
+            kmers[cursor[i]] = curr;
+            cursor[i]++;
+        }
+    }
+}
+
+template <typename T, bool IncludeSeqLen, typename Bucket>
+struct IsInBucket {
+    Bucket bucket;
+    size_t i;
+    bool operator()(const KmerPosition<T, IncludeSeqLen> &kmer) const {
+        return bucket(kmer.kmer) == i;
+    }
+};
+
+// sorts the k-mers in place by distributing them into buckets (American flag sort) and sorting the buckets
+// with comp. The k-mers are fully sorted only if the buckets follow the order of comp.
+// With more than one thread every thread distributes the k-mers within its share of each bucket range,
+// the k-mers that did not fit are moved to the end of their range and distributed again in the next round
+// (PARADIS, Cho et al. 2015). Only the per thread bucket cursors are needed in addition to the k-mers.
+template <typename T, bool IncludeSeqLen, typename Bucket, typename Compare>
+void bucketSortKmers(KmerPosition<T, IncludeSeqLen> *kmers, size_t n, size_t bucketCount, Bucket bucket, Compare comp) {
+    size_t threads = 1;
+#ifdef OPENMP
+    threads = static_cast<size_t>(omp_get_max_threads());
+#endif
+    std::vector<size_t> cursors(threads * bucketCount, 0);
+    std::vector<size_t> ends(threads * bucketCount, 0);
+#pragma omp parallel num_threads(threads)
+    {
+        size_t thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<size_t>(omp_get_thread_num());
+#endif
+        size_t *localCount = cursors.data() + thread_idx * bucketCount;
+#pragma omp for schedule(static)
+        for (size_t i = 0; i < n; i++) {
+            localCount[bucket(kmers[i].kmer)]++;
+        }
+    }
+    std::vector<size_t> bucketStart(bucketCount + 1, 0);
+    for (size_t thread = 0; thread < threads; thread++) {
+        for (size_t i = 0; i < bucketCount; i++) {
+            bucketStart[i + 1] += cursors[thread * bucketCount + i];
+        }
+    }
+    for (size_t i = 0; i < bucketCount; i++) {
+        bucketStart[i + 1] += bucketStart[i];
+    }
+
+    // k-mers before head[i] are in their bucket i
+    std::vector<size_t> head(bucketStart.begin(), bucketStart.end() - 1);
+    size_t remaining = n;
+    bool distributeParallel = threads > 1;
+    while (remaining > 0) {
+        // few remaining k-mers are distributed by one thread, the exact bucket ranges place every k-mer
+        if (distributeParallel == false || remaining < threads * MIN_BUCKET_SORT_SIZE) {
+            permuteKmers(kmers, bucketCount, bucket, head.data(), bucketStart.data() + 1);
+            break;
+        }
+#pragma omp parallel num_threads(threads)
+        {
+            size_t thread_idx = 0;
+#ifdef OPENMP
+            thread_idx = static_cast<size_t>(omp_get_thread_num());
+#endif
+            size_t *cursor = cursors.data() + thread_idx * bucketCount;
+            size_t *end = ends.data() + thread_idx * bucketCount;
+            for (size_t i = 0; i < bucketCount; i++) {
+                size_t length = bucketStart[i + 1] - head[i];
+                cursor[i] = head[i] + (length * thread_idx) / threads;
+                end[i] = head[i] + (length * (thread_idx + 1)) / threads;
+            }
+            permuteKmers(kmers, bucketCount, bucket, cursor, end);
+        }
+        size_t placed = 0;
+#pragma omp parallel for schedule(dynamic, 64) num_threads(threads) reduction(+:placed)
+        for (size_t i = 0; i < bucketCount; i++) {
+            IsInBucket<T, IncludeSeqLen, Bucket> isInBucket;
+            isInBucket.bucket = bucket;
+            isInBucket.i = i;
+            KmerPosition<T, IncludeSeqLen> *misplaced = std::partition(kmers + head[i], kmers + bucketStart[i + 1], isInBucket);
+            placed += static_cast<size_t>(misplaced - (kmers + head[i]));
+            head[i] = static_cast<size_t>(misplaced - kmers);
+        }
+        remaining -= placed;
+        if (placed == 0) {
+            distributeParallel = false;
+        }
+    }
+
+    // buckets of frequent k-mers would keep a single thread busy, they are sorted in parallel afterwards
+    const size_t maxBucketSize = std::max(n / threads, static_cast<size_t>(MIN_BUCKET_SORT_SIZE));
+#pragma omp parallel for schedule(dynamic, 1)
+    for (size_t i = 0; i < bucketCount; i++) {
+        if (bucketStart[i + 1] - bucketStart[i] <= maxBucketSize) {
+            std::sort(kmers + bucketStart[i], kmers + bucketStart[i + 1], comp);
+        }
+    }
+    for (size_t i = 0; i < bucketCount; i++) {
+        if (bucketStart[i + 1] - bucketStart[i] > maxBucketSize) {
+            SORT_PARALLEL(kmers + bucketStart[i], kmers + bucketStart[i + 1], comp);
+        }
+    }
+}
+
+// memory of the bucket cursors of bucketSortKmers
+size_t computeMemoryNeededKmerSort(size_t threads) {
+    return 2 * threads * (static_cast<size_t>(1) << MAX_BUCKET_BITS) * sizeof(size_t);
+}
+
+// uses about 4096 k-mers per bucket, at most 2^MAX_BUCKET_BITS buckets
+static unsigned int getBucketBits(size_t n) {
+    unsigned int bits = 1;
+    while (bits < MAX_BUCKET_BITS && (n >> (bits + 12)) > 0) {
+        bits++;
+    }
+    return bits;
+}
+
+// groups k-mers with the same hash, within a group the k-mers are ordered by comp
+template <typename T, bool IncludeSeqLen, typename Compare>
+void groupKmers(KmerPosition<T, IncludeSeqLen> *kmers, size_t n, Compare comp) {
+    if (n < MIN_BUCKET_SORT_SIZE) {
+        SORT_PARALLEL(kmers, kmers + n, comp);
+        return;
+    }
+    unsigned int bits = getBucketBits(n);
+    KmerHashBucket bucket;
+    bucket.shift = 64 - bits;
+    bucketSortKmers(kmers, n, static_cast<size_t>(1) << bits, bucket, comp);
+}
+
+// sorts k-mers whose kmer field holds the representative sequence id, comp has to order by it first
+template <typename T, bool IncludeSeqLen, typename Compare>
+void sortKmersByRepSequence(KmerPosition<T, IncludeSeqLen> *kmers, size_t n, Compare comp) {
+    if (n < MIN_BUCKET_SORT_SIZE) {
+        SORT_PARALLEL(kmers, kmers + n, comp);
+        return;
+    }
+    size_t maxRepSeq = 0;
+#pragma omp parallel for schedule(static) reduction(max:maxRepSeq)
+    for (size_t i = 0; i < n; i++) {
+        maxRepSeq = std::max(maxRepSeq, static_cast<size_t>(BIT_CLEAR(kmers[i].kmer, 63)));
+    }
+    unsigned int bits = getBucketBits(n);
+    unsigned int repSeqBits = 0;
+    while (repSeqBits < 64 && (maxRepSeq >> repSeqBits) > 0) {
+        repSeqBits++;
+    }
+    RepSequenceBucket bucket;
+    bucket.shift = (repSeqBits > bits) ? repSeqBits - bits : 0;
+    bucketSortKmers(kmers, n, (maxRepSeq >> bucket.shift) + 1, bucket, comp);
+}
+
+// The k-mer table keeps the k-mers of all sequences of a previous run sorted by comp. A run on a grown database
+// only extracts the k-mers of new or changed sequences and merges them into the k-mers read from the table.
+static const char KMER_TABLE_VERSION[] = "MMSKT1";
+static const size_t KMER_TABLE_BUFFER_SIZE = 1048576;
+
+struct KmerTableSequence {
+    unsigned int key;
+    size_t hash;
+};
+
+// the k-mer selection depends only on the sequence and these parameters
+static std::string getKmerTableSignature(Parameters &par, int seqType, size_t seqLenSize) {
+    return std::string(KMER_TABLE_VERSION) + " " + SSTR(seqType) + " " + SSTR(seqLenSize)
+           + " " + SSTR(par.kmerSize) + " " + SSTR(par.alphabetSize.aminoacids) + " " + SSTR(par.alphabetSize.nucleotides)
+           + " " + SSTR(par.kmersPerSequence) + " " + SSTR(par.kmersPerSequenceScale.aminoacids) + " " + SSTR(par.kmersPerSequenceScale.nucleotides)
+           + " " + SSTR(par.hashShift) + " " + SSTR(par.maskMode) + " " + SSTR(par.maskLowerCaseMode)
+           + " " + SSTR(par.spacedKmer) + " " + par.spacedKmerPattern + " " + SSTR(par.adjustKmerLength)
+           + " " + SSTR(par.ignoreMultiKmer) + " " + SSTR(par.pickNbest) + " " + SSTR(par.maxSeqLen)
+           + " " + par.scoringMatrixFile.aminoacids + " " + par.scoringMatrixFile.nucleotides;
+}
+
+static bool readKmerTableData(FILE *file, void *data, size_t size) {
+    return size == 0 || fread(data, size, 1, file) == 1;
+}
+
+static void writeKmerTableData(FILE *file, const void *data, size_t size, const std::string &fileName) {
+    if (size > 0 && fwrite(data, size, 1, file) != 1) {
+        Debug(Debug::ERROR) << "Cannot write k-mer table " << fileName << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+}
+
+template <typename T, typename Compare>
+size_t fillKmerPositionArrayFromTable(KmerPosition<T, false> *hashSeqPair, size_t totalKmers, DBReader<unsigned int> &seqDbr,
+                                      Parameters &par, BaseMatrix *subMat, Compare comp) {
+    const std::string signature = getKmerTableSignature(par, seqDbr.getDbtype(), sizeof(T));
+    const size_t keyCount = seqDbr.getLastKey() + 1;
+    std::vector<size_t> seqHashes(keyCount, 0);
+    // sequences that are not in the table or changed since it was written
+    std::vector<char> extractKeys(keyCount, false);
+#pragma omp parallel
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+#pragma omp for schedule(static)
+        for (size_t id = 0; id < seqDbr.getSize(); id++) {
+            unsigned int key = seqDbr.getDbKey(id);
+            seqHashes[key] = Util::hash(seqDbr.getData(id, thread_idx), seqDbr.getSeqLen(id));
+            extractKeys[key] = true;
+        }
+    }
+
+    // the k-mers of a sequence are kept only if the same sequence is still in the database
+    std::vector<char> keepKeys(keyCount, false);
+    FILE *tableFile = NULL;
+    size_t tableKmers = 0;
+    size_t tableSeqCount = 0;
+    size_t keptSeqCount = 0;
+    if (FileUtil::fileExists(par.kmerTable.c_str())) {
+        tableFile = FileUtil::openFileOrDie(par.kmerTable.c_str(), "rb", true);
+        size_t signatureSize = 0;
+        std::string tableSignature;
+        bool isValid = readKmerTableData(tableFile, &signatureSize, sizeof(size_t)) && signatureSize == signature.size();
+        if (isValid) {
+            tableSignature.resize(signatureSize);
+            isValid = readKmerTableData(tableFile, &tableSignature[0], signatureSize) && tableSignature == signature
+                      && readKmerTableData(tableFile, &tableSeqCount, sizeof(size_t));
+        }
+        if (isValid) {
+            std::vector<KmerTableSequence> tableSeqs(tableSeqCount);
+            isValid = readKmerTableData(tableFile, tableSeqs.data(), tableSeqCount * sizeof(KmerTableSequence))
+                      && readKmerTableData(tableFile, &tableKmers, sizeof(size_t));
+            for (size_t i = 0; isValid && i < tableSeqCount; i++) {
+                unsigned int key = tableSeqs[i].key;
+                if (key < keyCount && extractKeys[key] && seqHashes[key] == tableSeqs[i].hash) {
+                    keepKeys[key] = true;
+                    extractKeys[key] = false;
+                    keptSeqCount++;
+                }
+            }
+        }
+        if (isValid == false) {
+            Debug(Debug::WARNING) << "K-mer table " << par.kmerTable << " was computed with different parameters and is recomputed\n";
+            std::fill(keepKeys.begin(), keepKeys.end(), false);
+            std::fill(extractKeys.begin(), extractKeys.end(), true);
+            fclose(tableFile);
+            tableFile = NULL;
+            tableKmers = 0;
+            tableSeqCount = 0;
+            keptSeqCount = 0;
+        }
+    }
+
+    // extract the k-mers of new sequences, the table k-mers are merged in afterwards
+    std::pair<size_t, size_t> ret;
+    if (Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
+        ret = fillKmerPositionArray<Parameters::DBTYPE_NUCLEOTIDES, T, false>(hashSeqPair, totalKmers, seqDbr, par, subMat, true, 0, SIZE_T_MAX, NULL,
+                                                                             (tableFile != NULL) ? extractKeys.data() : NULL);
         par.kmerSize = ret.second;
         Debug(Debug::INFO) << "\nAdjusted k-mer length " << par.kmerSize << "\n";
-    }else{
-        std::pair<size_t, size_t > ret = fillKmerPositionArray<Parameters::DBTYPE_AMINO_ACIDS, T>(hashSeqPair, totalKmers, seqDbr, par, subMat, true, hashStartRange, hashEndRange, NULL);
-        elementsToSort = ret.first;
-    }
-    if(hashEndRange == SIZE_T_MAX){
-        seqDbr.unmapData();
+    } else {
+        ret = fillKmerPositionArray<Parameters::DBTYPE_AMINO_ACIDS, T, false>(hashSeqPair, totalKmers, seqDbr, par, subMat, true, 0, SIZE_T_MAX, NULL,
+                                                                             (tableFile != NULL) ? extractKeys.data() : NULL);
     }
+    seqDbr.unmapData();
+    const size_t newKmers = ret.first;
 
     Debug(Debug::INFO) << "Sort kmer ";
     Timer timer;
-    if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<T>::compareRepSequenceAndIdAndPosReverse);
-    }else{
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + elementsToSort, KmerPosition<T>::compareRepSequenceAndIdAndPos);
+    SORT_PARALLEL(hashSeqPair, hashSeqPair + newKmers, comp);
+    size_t kmerCount = newKmers;
+    if (tableFile != NULL) {
+        // the new k-mers are moved to the end of the array and the table is streamed through a small buffer.
+        // The merged k-mers are written from the front and cannot overtake the unmerged new k-mers as long as
+        // all k-mers fit into the array, so the merge needs no second k-mer array.
+        KmerPosition<T, false> *newKmer = hashSeqPair + (totalKmers - newKmers);
+        KmerPosition<T, false> *newKmerEnd = hashSeqPair + totalKmers;
+        memmove(newKmer, hashSeqPair, newKmers * sizeof(KmerPosition<T, false>));
+        kmerCount = 0;
+        KmerPosition<T, false> *buffer = new KmerPosition<T, false>[KMER_TABLE_BUFFER_SIZE];
+        for (size_t i = 0; i < tableKmers; i += KMER_TABLE_BUFFER_SIZE) {
+            size_t readCount = std::min(KMER_TABLE_BUFFER_SIZE, tableKmers - i);
+            if (readKmerTableData(tableFile, buffer, readCount * sizeof(KmerPosition<T, false>)) == false) {
+                Debug(Debug::ERROR) << "K-mer table " << par.kmerTable << " is truncated\n";
+                EXIT(EXIT_FAILURE);
+            }
+            for (size_t j = 0; j < readCount; j++) {
+                if (buffer[j].id >= keyCount || keepKeys[buffer[j].id] == false) {
+                    continue;
+                }
+                while (newKmer < newKmerEnd && comp(*newKmer, buffer[j])) {
+                    hashSeqPair[kmerCount] = *newKmer;
+                    kmerCount++;
+                    newKmer++;
+                }
+                if (hashSeqPair + kmerCount >= newKmer) {
+                    Debug(Debug::ERROR) << "K-mer table " << par.kmerTable << " does not match the database\n";
+                    EXIT(EXIT_FAILURE);
+                }
+                hashSeqPair[kmerCount] = buffer[j];
+                kmerCount++;
+            }
+        }
+        delete[] buffer;
+        fclose(tableFile);
+        const size_t remainingNewKmers = static_cast<size_t>(newKmerEnd - newKmer);
+        memmove(hashSeqPair + kmerCount, newKmer, remainingNewKmers * sizeof(KmerPosition<T, false>));
+        kmerCount += remainingNewKmers;
+        // the moved k-mers behind the merged ones are reset like the unused array
+        memset(hashSeqPair + kmerCount, 0xFF, (totalKmers - kmerCount) * sizeof(KmerPosition<T, false>));
     }
     Debug(Debug::INFO) << timer.lap() << "\n";
+    Debug(Debug::INFO) << "K-mer table: " << (kmerCount - newKmers) << " k-mers reused, " << newKmers << " k-mers extracted\n";
+
+    // a table of the same sequences already holds these k-mers
+    if (keptSeqCount == tableSeqCount && keptSeqCount == seqDbr.getSize()) {
+        return kmerCount;
+    }
+
+    std::string tmpTable = par.kmerTable + ".tmp";
+    FILE *out = FileUtil::openFileOrDie(tmpTable.c_str(), "wb", false);
+    size_t signatureSize = signature.size();
+    writeKmerTableData(out, &signatureSize, sizeof(size_t), tmpTable);
+    writeKmerTableData(out, signature.c_str(), signatureSize, tmpTable);
+    size_t seqCount = seqDbr.getSize();
+    writeKmerTableData(out, &seqCount, sizeof(size_t), tmpTable);
+    for (size_t id = 0; id < seqCount; id++) {
+        KmerTableSequence tableSeq;
+        tableSeq.key = seqDbr.getDbKey(id);
+        tableSeq.hash = seqHashes[tableSeq.key];
+        writeKmerTableData(out, &tableSeq, sizeof(KmerTableSequence), tmpTable);
+    }
+    writeKmerTableData(out, &kmerCount, sizeof(size_t), tmpTable);
+    writeKmerTableData(out, hashSeqPair, kmerCount * sizeof(KmerPosition<T, false>), tmpTable);
+    if (fclose(out) != 0) {
+        Debug(Debug::ERROR) << "Cannot close file " << tmpTable << "\n";
+        EXIT(EXIT_FAILURE);
+    }
+    FileUtil::move(tmpTable.c_str(), par.kmerTable.c_str());
+    return kmerCount;
+}
+
+template <typename T>
+KmerPosition<T, false> * doComputation(size_t totalKmers, size_t hashStartRange, size_t hashEndRange, std::string splitFile,
+                                       DBReader<unsigned int> & seqDbr, const T *seqLens, Parameters & par, BaseMatrix  * subMat) {
+
+    KmerPosition<T, false> * hashSeqPair = initKmerPositionMemory<T, false>(totalKmers);
+    Timer timer;
+    if(par.kmerTable.empty() == false && hashEndRange == SIZE_T_MAX){
+        if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
+            fillKmerPositionArrayFromTable(hashSeqPair, totalKmers, seqDbr, par, subMat, KmerPosition<T, false>::compareRepSequenceAndIdAndDiagReverse);
+        }else{
+            fillKmerPositionArrayFromTable(hashSeqPair, totalKmers, seqDbr, par, subMat, KmerPosition<T, false>::compareRepSequenceAndIdAndDiag);
+        }
+    }else{
+        size_t elementsToSort;
+        if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
+            std::pair<size_t, size_t > ret = fillKmerPositionArray<Parameters::DBTYPE_NUCLEOTIDES, T, false>(hashSeqPair, totalKmers, seqDbr, par, subMat, true, hashStartRange, hashEndRange, NULL);
+            elementsToSort = ret.first;
+            par.kmerSize = ret.second;
+            Debug(Debug::INFO) << "\nAdjusted k-mer length " << par.kmerSize << "\n";
+        }else{
+            std::pair<size_t, size_t > ret = fillKmerPositionArray<Parameters::DBTYPE_AMINO_ACIDS, T, false>(hashSeqPair, totalKmers, seqDbr, par, subMat, true, hashStartRange, hashEndRange, NULL);
+            elementsToSort = ret.first;
+        }
+        if(hashEndRange == SIZE_T_MAX){
+            seqDbr.unmapData();
+        }
+
+        Debug(Debug::INFO) << "Sort kmer ";
+        timer.reset();
+        if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
+            groupKmers(hashSeqPair, elementsToSort, KmerPosition<T, false>::compareRepSequenceAndIdAndDiagReverse);
+        }else{
+            groupKmers(hashSeqPair, elementsToSort, KmerPosition<T, false>::compareRepSequenceAndIdAndDiag);
+        }
+        Debug(Debug::INFO) << timer.lap() << "\n";
+    }
 
     // assign rep. sequence to same kmer members
-    // The longest sequence is the first since we sorted by kmer, seq.Len and id
+    // The longest sequence of each kmer group is the rep. sequence
     size_t writePos;
     if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
-        writePos = assignGroup<Parameters::DBTYPE_NUCLEOTIDES, T>(hashSeqPair, totalKmers, par.includeOnlyExtendable, par.covMode, par.covThr);
+        writePos = assignGroup<Parameters::DBTYPE_NUCLEOTIDES, T>(hashSeqPair, seqLens, totalKmers, par.includeOnlyExtendable, par.covMode, par.covThr);
     }else{
-        writePos = assignGroup<Parameters::DBTYPE_AMINO_ACIDS, T>(hashSeqPair, totalKmers, par.includeOnlyExtendable, par.covMode, par.covThr);
+        writePos = assignGroup<Parameters::DBTYPE_AMINO_ACIDS, T>(hashSeqPair, seqLens, totalKmers, par.includeOnlyExtendable, par.covMode, par.covThr);
     }
 
     // sort by rep. sequence (stored in kmer) and sequence id
     Debug(Debug::INFO) << "Sort by rep. sequence ";
     timer.reset();
     if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + writePos, KmerPosition<T>::compareRepSequenceAndIdAndDiagReverse);
+        sortKmersByRepSequence(hashSeqPair, writePos, KmerPosition<T, false>::compareRepSequenceAndIdAndDiagReverse);
     }else{
-        SORT_PARALLEL(hashSeqPair, hashSeqPair + writePos, KmerPosition<T>::compareRepSequenceAndIdAndDiag);
+        sortKmersByRepSequence(hashSeqPair, writePos, KmerPosition<T, false>::compareRepSequenceAndIdAndDiag);
     }
-    //kx::radix_sort(hashSeqPair, hashSeqPair + elementsToSort, SequenceComparision());
 //    for(size_t i = 0; i < writePos; i++){
 //        std::cout << BIT_CLEAR(hashSeqPair[i].kmer, 63) << "\t" << hashSeqPair[i].id << "\t" << hashSeqPair[i].pos << std::endl;
 //    }
@@ -427,9 +821,9 @@ KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t
 
     if(hashEndRange != SIZE_T_MAX){
         if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
-            writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev, T>(splitFile, hashSeqPair, writePos + 1);
+            writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev, T, false>(splitFile, hashSeqPair, writePos + 1);
         }else{
-            writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry, T>(splitFile, hashSeqPair, writePos + 1);
+            writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry, T, false>(splitFile, hashSeqPair, writePos + 1);
         }
         delete [] hashSeqPair;
         hashSeqPair = NULL;
@@ -438,26 +832,35 @@ KmerPosition<T> * doComputation(size_t totalKmers, size_t hashStartRange, size_t
 }
 
 template <int TYPE, typename T>
-size_t assignGroup(KmerPosition<T> *hashSeqPair, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr) {
+size_t assignGroup(KmerPosition<T, false> *hashSeqPair, const T *seqLens, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr) {
     size_t writePos=0;
     size_t prevHash = hashSeqPair[0].kmer;
-    size_t repSeqId = hashSeqPair[0].id;
     if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
-        bool isReverse = (BIT_CHECK(hashSeqPair[0].kmer, 63) == false);
-        repSeqId = (isReverse) ? BIT_CLEAR(repSeqId, 63) : BIT_SET(repSeqId, 63);
         prevHash = BIT_SET(prevHash, 63);
     }
     size_t prevHashStart = 0;
     size_t prevSetSize = 0;
-    T queryLen=hashSeqPair[0].seqLen;
-    bool repIsReverse = false;
-    T repSeq_i_pos = hashSeqPair[0].pos;
     for (size_t elementIdx = 0; elementIdx < splitKmerCount+1; elementIdx++) {
         size_t currKmer = hashSeqPair[elementIdx].kmer;
         if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
             currKmer = BIT_SET(currKmer, 63);
         }
         if (prevHash != currKmer) {
+            // the longest sequence is the rep. sequence, the group is sorted by id so the first one wins ties
+            size_t repIdx = prevHashStart;
+            for (size_t i = prevHashStart + 1; i < elementIdx; i++) {
+                if (seqLens[hashSeqPair[i].id] > seqLens[hashSeqPair[repIdx].id]) {
+                    repIdx = i;
+                }
+            }
+            size_t repSeqId = hashSeqPair[repIdx].id;
+            bool repIsReverse = false;
+            if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
+                repIsReverse = (BIT_CHECK(hashSeqPair[repIdx].kmer, 63) == 0);
+                repSeqId = (repIsReverse) ? repSeqId : BIT_SET(repSeqId, 63);
+            }
+            T queryLen = seqLens[hashSeqPair[repIdx].id];
+            T repSeq_i_pos = hashSeqPair[repIdx].pos;
             for (size_t i = prevHashStart; i < elementIdx; i++) {
                 size_t kmer = hashSeqPair[i].kmer;
                 if(TYPE == Parameters::DBTYPE_NUCLEOTIDES) {
@@ -490,13 +893,13 @@ size_t assignGroup(KmerPosition<T> *hashSeqPair, size_t splitKmerCount, bool inc
                             // we just need to offset the position to the forward strand
                         }else if (repIsReverse == true && targetIsReverse == true){
                             queryPos = (queryLen - 1) - repSeq_i_pos;
-                            targetPos = (hashSeqPair[i].seqLen - 1) - hashSeqPair[i].pos;
+                            targetPos = (seqLens[hashSeqPair[i].id] - 1) - hashSeqPair[i].pos;
                             queryNeedsToBeRev = false;
                             // query is not revers but target k-mer is reverse
                             // instead of reverting the target, we revert the query and offset the the query/target position
                         }else if (repIsReverse == false && targetIsReverse == true){
                             queryPos = (queryLen - 1) - repSeq_i_pos;
-                            targetPos = (hashSeqPair[i].seqLen - 1) - hashSeqPair[i].pos;
+                            targetPos = (seqLens[hashSeqPair[i].id] - 1) - hashSeqPair[i].pos;
                             queryNeedsToBeRev = true;
                             // both are forward, everything is good here
                         }else{
@@ -510,14 +913,14 @@ size_t assignGroup(KmerPosition<T> *hashSeqPair, size_t splitKmerCount, bool inc
 //                    std::cout << diagonal << "\t" << repSeq_i_pos << "\t" << hashSeqPair[i].pos << std::endl;
 
 
-                    bool canBeExtended = diagonal < 0 || (diagonal > (queryLen - hashSeqPair[i].seqLen));
+                    T targetLen = seqLens[hashSeqPair[i].id];
+                    bool canBeExtended = diagonal < 0 || (diagonal > (queryLen - targetLen));
                     bool canBecovered = Util::canBeCovered(covThr, covMode,
                                                            static_cast<float>(queryLen),
-                                                           static_cast<float>(hashSeqPair[i].seqLen));
+                                                           static_cast<float>(targetLen));
                     if((includeOnlyExtendable == false && canBecovered) || (canBeExtended && includeOnlyExtendable ==true )){
                         hashSeqPair[writePos].kmer = rId;
                         hashSeqPair[writePos].pos = diagonal;
-                        hashSeqPair[writePos].seqLen = hashSeqPair[i].seqLen;
                         hashSeqPair[writePos].id = hashSeqPair[i].id;
                         writePos++;
                     }
@@ -527,13 +930,6 @@ size_t assignGroup(KmerPosition<T> *hashSeqPair, size_t splitKmerCount, bool inc
             }
             prevSetSize = 0;
             prevHashStart = elementIdx;
-            repSeqId = hashSeqPair[elementIdx].id;
-            if(TYPE == Parameters::DBTYPE_NUCLEOTIDES){
-                repIsReverse = (BIT_CHECK(hashSeqPair[elementIdx].kmer, 63) == 0);
-                repSeqId = (repIsReverse) ? repSeqId : BIT_SET(repSeqId, 63);
-            }
-            queryLen = hashSeqPair[elementIdx].seqLen;
-            repSeq_i_pos = hashSeqPair[elementIdx].pos;
         }
         if (hashSeqPair[elementIdx].kmer == SIZE_T_MAX) {
             break;
@@ -548,10 +944,10 @@ size_t assignGroup(KmerPosition<T> *hashSeqPair, size_t splitKmerCount, bool inc
     return writePos;
 }
 
-template size_t assignGroup<0, short>(KmerPosition<short> *kmers, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
-template size_t assignGroup<0, int>(KmerPosition<int> *kmers, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
-template size_t assignGroup<1, short>(KmerPosition<short> *kmers, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
-template size_t assignGroup<1, int>(KmerPosition<int> *kmers, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
+template size_t assignGroup<0, short>(KmerPosition<short, false> *kmers, const short *seqLens, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
+template size_t assignGroup<0, int>(KmerPosition<int, false> *kmers, const int *seqLens, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
+template size_t assignGroup<1, short>(KmerPosition<short, false> *kmers, const short *seqLens, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
+template size_t assignGroup<1, int>(KmerPosition<int, false> *kmers, const int *seqLens, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
 
 void setLinearFilterDefault(Parameters *p) {
     p->covThr = 0.8;
@@ -574,9 +970,9 @@ size_t computeKmerCount(DBReader<unsigned int> &reader, size_t KMER_SIZE, size_t
     return totalKmers;
 }
 
-template <typename T>
+template <typename T, bool IncludeSeqLen>
 size_t computeMemoryNeededLinearfilter(size_t totalKmer) {
-    return sizeof(KmerPosition<T>) * totalKmer;
+    return sizeof(KmerPosition<T, IncludeSeqLen>) * totalKmer;
 }
 
 
@@ -605,18 +1001,40 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
     float kmersPerSequenceScale = (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) ?
                                         par.kmersPerSequenceScale.nucleotides : par.kmersPerSequenceScale.aminoacids;
     size_t totalKmers = computeKmerCount(seqDbr, par.kmerSize, par.kmersPerSequence, kmersPerSequenceScale);
-    size_t totalSizeNeeded = computeMemoryNeededLinearfilter<T>(totalKmers);
+    // the sequence lengths are kept once per sequence instead of once per k-mer
+    std::vector<T> seqLens(seqDbr.getLastKey() + 1, 0);
+    for (size_t id = 0; id < seqDbr.getSize(); id++) {
+        seqLens[seqDbr.getDbKey(id)] = static_cast<T>(seqDbr.getSeqLen(id));
+    }
+    // memory that is needed next to the k-mer array
+    size_t auxSizeNeeded = seqLens.size() * sizeof(T) + computeMemoryNeededKmerSort(par.threads);
+    if (par.kmerTable.empty() == false) {
+        // sequence hashes and key flags of the table lookup and the buffer that streams the table
+        auxSizeNeeded += seqLens.size() * (sizeof(size_t) + 2 * sizeof(char) + sizeof(KmerTableSequence))
+                         + KMER_TABLE_BUFFER_SIZE * sizeof(KmerPosition<T, false>);
+    }
+    size_t totalSizeNeeded = computeMemoryNeededLinearfilter<T, false>(totalKmers);
+    size_t kmerMemoryLimit = std::max(memoryLimit - std::min(memoryLimit, auxSizeNeeded),
+                                      computeMemoryNeededLinearfilter<T, false>(1024 + 1));
     // compute splits
-    size_t splits = static_cast<size_t>(std::ceil(static_cast<float>(totalSizeNeeded) / memoryLimit));
+    size_t splits = static_cast<size_t>(std::ceil(static_cast<float>(totalSizeNeeded) / kmerMemoryLimit));
     size_t totalKmersPerSplit = std::max(static_cast<size_t>(1024+1),
-                                         static_cast<size_t>(std::min(totalSizeNeeded, memoryLimit)/sizeof(KmerPosition<T>))+1);
+                                         static_cast<size_t>(std::min(totalSizeNeeded, kmerMemoryLimit)/sizeof(KmerPosition<T, false>))+1);
 
-    std::vector<std::pair<size_t, size_t>> hashRanges = setupKmerSplits<T>(par, subMat, seqDbr, totalKmersPerSplit, splits);
+    std::vector<std::pair<size_t, size_t>> hashRanges = setupKmerSplits<T, false>(par, subMat, seqDbr, totalKmersPerSplit, splits);
     if(splits > 1){
         Debug(Debug::INFO) << "Process file into " << hashRanges.size() << " parts\n";
     }
+    if(splits > 1 && par.kmerTable.empty() == false){
+        Debug(Debug::WARNING) << "K-mer table is not used since the k-mers do not fit into memory at once\n";
+        par.kmerTable = "";
+    }
+    if(par.adjustKmerLength && par.kmerTable.empty() == false){
+        Debug(Debug::WARNING) << "K-mer table is not used together with --adjust-kmer-len\n";
+        par.kmerTable = "";
+    }
     std::vector<std::string> splitFiles;
-    KmerPosition<T> *hashSeqPair = NULL;
+    KmerPosition<T, false> *hashSeqPair = NULL;
 
     size_t mpiRank = 0;
 #ifdef HAVE_MPI
@@ -639,7 +1057,7 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
 
     for(size_t split = fromSplit; split < fromSplit+splitCount; split++) {
         std::string splitFileName = par.db2 + "_split_" +SSTR(split);
-        hashSeqPair = doComputation<T>(totalKmers, hashRanges[split].first, hashRanges[split].second, splitFileName, seqDbr, par, subMat);
+        hashSeqPair = doComputation<T>(totalKmers, hashRanges[split].first, hashRanges[split].second, splitFileName, seqDbr, seqLens.data(), par, subMat);
     }
     MPI_Barrier(MPI_COMM_WORLD);
     if(mpiRank == 0){
@@ -655,7 +1073,7 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
 
         std::string splitFileNameDone = splitFileName + ".done";
         if(FileUtil::fileExists(splitFileNameDone.c_str()) == false){
-            hashSeqPair = doComputation<T>(totalKmersPerSplit, hashRanges[split].first, hashRanges[split].second, splitFileName, seqDbr, par, subMat);
+            hashSeqPair = doComputation<T>(totalKmersPerSplit, hashRanges[split].first, hashRanges[split].second, splitFileName, seqDbr, seqLens.data(), par, subMat);
         }
 
         splitFiles.push_back(splitFileName);
@@ -665,7 +1083,7 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
         std::vector<char> repSequence(seqDbr.getLastKey()+1);
         std::fill(repSequence.begin(), repSequence.end(), false);
         // write result
-        DBWriter dbw(par.db2.c_str(), par.db2Index.c_str(), 1, par.compressed,
+        DBWriter dbw(par.db2.c_str(), par.db2Index.c_str(), (splits > 1) ? par.threads : 1, par.compressed,
                      (Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) ? Parameters::DBTYPE_PREFILTER_REV_RES : Parameters::DBTYPE_PREFILTER_RES );
         dbw.open();
 
@@ -673,9 +1091,9 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
         if(splits > 1) {
             seqDbr.unmapData();
             if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)) {
-                mergeKmerFilesAndOutput<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev>(dbw, splitFiles, repSequence);
+                mergeKmerFilesAndOutput<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev>(dbw, splitFiles, repSequence, par.threads);
             }else{
-                mergeKmerFilesAndOutput<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry>(dbw, splitFiles, repSequence);
+                mergeKmerFilesAndOutput<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry>(dbw, splitFiles, repSequence, par.threads);
             }
             for(size_t i = 0; i < splitFiles.size(); i++){
                 FileUtil::remove(splitFiles[i].c_str());
@@ -723,7 +1141,7 @@ int kmermatcherInner(Parameters& par, DBReader<unsigned int>& seqDbr) {
     return EXIT_SUCCESS;
 }
 
-template <typename T>
+template <typename T, bool IncludeSeqLen>
 std::vector<std::pair<size_t, size_t>> setupKmerSplits(Parameters &par, BaseMatrix * subMat, DBReader<unsigned int> &seqDbr, size_t totalKmers, size_t splits){
     std::vector<std::pair<size_t, size_t>> hashRanges;
     if (splits > 1) {
@@ -732,9 +1150,9 @@ std::vector<std::pair<size_t, size_t>> setupKmerSplits(Parameters &par, BaseMatr
         size_t * hashDist = new size_t[USHRT_MAX+1];
         memset(hashDist, 0 , sizeof(size_t) * (USHRT_MAX+1));
         if(Parameters::isEqualDbtype(seqDbr.getDbtype(), Parameters::DBTYPE_NUCLEOTIDES)){
-            fillKmerPositionArray<Parameters::DBTYPE_NUCLEOTIDES, T>(NULL, SIZE_T_MAX, seqDbr, par, subMat, true, 0, SIZE_T_MAX, hashDist);
+            fillKmerPositionArray<Parameters::DBTYPE_NUCLEOTIDES, T, IncludeSeqLen>(NULL, SIZE_T_MAX, seqDbr, par, subMat, true, 0, SIZE_T_MAX, hashDist);
         }else{
-            fillKmerPositionArray<Parameters::DBTYPE_AMINO_ACIDS, T>(NULL, SIZE_T_MAX, seqDbr, par, subMat, true, 0, SIZE_T_MAX, hashDist);
+            fillKmerPositionArray<Parameters::DBTYPE_AMINO_ACIDS, T, IncludeSeqLen>(NULL, SIZE_T_MAX, seqDbr, par, subMat, true, 0, SIZE_T_MAX, hashDist);
         }
         seqDbr.remapData();
         // figure out if machine has enough memory to run this job
@@ -745,7 +1163,7 @@ std::vector<std::pair<size_t, size_t>> setupKmerSplits(Parameters &par, BaseMatr
             }
         }
         if(maxBucketSize > totalKmers){
-            Debug(Debug::INFO) << "Not enough memory to run the kmermatcher. Minimum is at least " << maxBucketSize* sizeof(KmerPosition<T>) << " bytes\n";
+            Debug(Debug::INFO) << "Not enough memory to run the kmermatcher. Minimum is at least " << maxBucketSize* sizeof(KmerPosition<T, IncludeSeqLen>) << " bytes\n";
             EXIT(EXIT_FAILURE);
         }
         // define splits
@@ -798,7 +1216,7 @@ int kmermatcher(int argc, const char **argv, const Command &command) {
 
 template <int TYPE, typename T>
 void writeKmerMatcherResult(DBWriter & dbw,
-                            KmerPosition<T> *hashSeqPair, size_t totalKmers,
+                            KmerPosition<T, false> *hashSeqPair, size_t totalKmers,
                             std::vector<char> &repSequence, size_t threads) {
     std::vector<size_t> threadOffsets;
     size_t splitSize = totalKmers/threads;
@@ -933,45 +1351,20 @@ size_t queueNextEntry(KmerPositionQueue &queue, int file, size_t offsetPos, T *e
     return offsetPos+pos;
 }
 
+// merges the sets of the rep. sequences between rangeStart and rangeEnd of each file
 template <int TYPE, typename T>
-void mergeKmerFilesAndOutput(DBWriter & dbw,
-                             std::vector<std::string> tmpFiles,
-                             std::vector<char> &repSequence) {
-    Debug(Debug::INFO) << "Merge splits ... ";
-
-    const int fileCnt = tmpFiles.size();
-    FILE ** files       = new FILE*[fileCnt];
-    T **entries = new T*[fileCnt];
-    size_t * entrySizes = new size_t[fileCnt];
+void mergeKmerFilesRange(DBWriter & dbw, T **entries, int fileCnt, const size_t *rangeStart, const size_t *rangeEnd,
+                         std::vector<char> &repSequence, unsigned int thread_idx) {
     size_t * offsetPos  = new size_t[fileCnt];
-    size_t * dataSizes  = new size_t[fileCnt];
-    // init structures
-    for(size_t file = 0; file < tmpFiles.size(); file++){
-        files[file] = FileUtil::openFileOrDie(tmpFiles[file].c_str(),"r",true);
-        size_t dataSize;
-        struct stat sb;
-        fstat(fileno(files[file]) , &sb);
-        if(sb.st_size > 0){
-            entries[file]    = (T*)FileUtil::mmapFile(files[file], &dataSize);
-#if HAVE_POSIX_MADVISE
-            if (posix_madvise (entries[file], dataSize, POSIX_MADV_SEQUENTIAL) != 0){
-                Debug(Debug::ERROR) << "posix_madvise returned an error for file " << tmpFiles[file] << "\n";
-            }
-#endif
-        }else{
-            dataSize = 0;
-        }
-
-        dataSizes[file]  = dataSize;
-        entrySizes[file] = dataSize/sizeof(T);
-    }
     KmerPositionQueue queue;
     // read one entry for each file
     for(int file = 0; file < fileCnt; file++ ){
-        offsetPos[file] = queueNextEntry<TYPE,T>(queue, file, 0, entries[file], entrySizes[file]);
+        offsetPos[file] = queueNextEntry<TYPE,T>(queue, file, rangeStart[file], entries[file], rangeEnd[file]);
     }
+    // a set can be larger than the buffer, it is streamed to the writer whenever the buffer is full
+    const size_t flushSize = 1024 * 1024;
     std::string prefResultsOutString;
-    prefResultsOutString.reserve(100000000);
+    prefResultsOutString.reserve(flushSize);
     char buffer[100];
     FileKmerPosition res;
     bool hasRepSeq =  repSequence.size()>0;
@@ -979,6 +1372,7 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
     if(queue.empty() == false){
         res = queue.top();
         currRepSeq = res.repSeq;
+        dbw.writeStart(thread_idx);
         if(hasRepSeq) {
             hit_t h;
             h.seqId = res.repSeq;
@@ -989,20 +1383,14 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
         }
     }
 
-//    while(queue.empty() == false) {
-//        res = queue.top();
-//        std::cout << (int)res.repSeq << "\t" << (int)res.id << "\t" <<(int) res.pos << "\t" << (int) res.reverse << std::endl;
-//        queue.pop();
-//        offsetPos[res.file] = queueNextEntry<TYPE,T>(queue, res.file, offsetPos[res.file],
-//                                                     entries[res.file], entrySizes[res.file]);
-//    }
     while(queue.empty() == false) {
         res = queue.top();
         queue.pop();
         if(res.id == UINT_MAX) {
             offsetPos[res.file] = queueNextEntry<TYPE,T>(queue, res.file, offsetPos[res.file],
-                                                         entries[res.file], entrySizes[res.file]);
-            dbw.writeData(prefResultsOutString.c_str(), prefResultsOutString.length(), res.repSeq, 0);
+                                                         entries[res.file], rangeEnd[res.file]);
+            dbw.writeAdd(prefResultsOutString.c_str(), prefResultsOutString.length(), thread_idx);
+            dbw.writeEnd(res.repSeq, thread_idx);
             if(hasRepSeq){
                 repSequence[res.repSeq]=true;
             }
@@ -1012,12 +1400,13 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
                 res = queue.top();
                 queue.pop();
                 offsetPos[res.file] = queueNextEntry<TYPE,T>(queue, res.file, offsetPos[res.file],
-                                                             entries[res.file], entrySizes[res.file]);
+                                                             entries[res.file], rangeEnd[res.file]);
             }
             if(queue.empty() == false) {
                 res = queue.top();
                 currRepSeq = res.repSeq;
                 queue.pop();
+                dbw.writeStart(thread_idx);
                 if(hasRepSeq){
                     hit_t h;
                     h.seqId = res.repSeq;
@@ -1073,7 +1462,126 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
         h.diagonal =  bestDiagonal;
         int len = QueryMatcher::prefilterHitToBuffer(buffer, h);
         prefResultsOutString.append(buffer, len);
+        if(prefResultsOutString.size() >= flushSize){
+            dbw.writeAdd(prefResultsOutString.c_str(), prefResultsOutString.length(), thread_idx);
+            prefResultsOutString.clear();
+        }
+    }
+    delete [] offsetPos;
+}
+
+// first set at or after pos, each set ends with an entry with seqId UINT_MAX
+template <typename T>
+size_t findSetStart(T *entries, size_t entrySize, size_t pos) {
+    if (pos == 0) {
+        return 0;
+    }
+    while (pos < entrySize && entries[pos - 1].seqId != UINT_MAX) {
+        pos++;
     }
+    return pos;
+}
+
+// first set with a rep. sequence not smaller than repSeq, the sets are sorted by rep. sequence
+template <typename T>
+size_t findRepSeqStart(T *entries, size_t entrySize, size_t repSeq) {
+    size_t low = 0;
+    size_t high = entrySize;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        size_t setStart = findSetStart(entries, entrySize, mid);
+        if (setStart < entrySize && entries[setStart].seqId < repSeq) {
+            low = setStart + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return findSetStart(entries, entrySize, low);
+}
+
+template <int TYPE, typename T>
+void mergeKmerFilesAndOutput(DBWriter & dbw,
+                             std::vector<std::string> tmpFiles,
+                             std::vector<char> &repSequence, size_t threads) {
+    Debug(Debug::INFO) << "Merge splits ... ";
+
+    const int fileCnt = tmpFiles.size();
+    FILE ** files       = new FILE*[fileCnt];
+    T **entries = new T*[fileCnt];
+    size_t * entrySizes = new size_t[fileCnt];
+    size_t * dataSizes  = new size_t[fileCnt];
+    // init structures
+    size_t largestFile = 0;
+    for(size_t file = 0; file < tmpFiles.size(); file++){
+        files[file] = FileUtil::openFileOrDie(tmpFiles[file].c_str(),"r",true);
+        size_t dataSize;
+        struct stat sb;
+        fstat(fileno(files[file]) , &sb);
+        if(sb.st_size > 0){
+            entries[file]    = (T*)FileUtil::mmapFile(files[file], &dataSize);
+#if HAVE_POSIX_MADVISE
+            if (posix_madvise (entries[file], dataSize, POSIX_MADV_SEQUENTIAL) != 0){
+                Debug(Debug::ERROR) << "posix_madvise returned an error for file " << tmpFiles[file] << "\n";
+            }
+#endif
+        }else{
+            dataSize = 0;
+        }
+
+        dataSizes[file]  = dataSize;
+        entrySizes[file] = dataSize/sizeof(T);
+        if (entrySizes[file] > entrySizes[largestFile]) {
+            largestFile = file;
+        }
+    }
+
+    // the hash splits spread every rep. sequence range evenly over the files,
+    // so the sets of the largest file define ranges of rep. sequences that are merged independently
+    size_t rangeCnt = (threads > 1) ? threads * 4 : 1;
+    std::vector<size_t> rangeRepSeq;
+    rangeRepSeq.push_back(0);
+    for (size_t range = 1; range < rangeCnt; range++) {
+        size_t setStart = findSetStart(entries[largestFile], entrySizes[largestFile], (entrySizes[largestFile] / rangeCnt) * range);
+        size_t repSeq = (setStart < entrySizes[largestFile]) ? entries[largestFile][setStart].seqId : SIZE_T_MAX;
+        if (repSeq > rangeRepSeq.back()) {
+            rangeRepSeq.push_back(repSeq);
+        }
+    }
+    rangeRepSeq.push_back(SIZE_T_MAX);
+    rangeCnt = rangeRepSeq.size() - 1;
+    std::vector<size_t> rangeOffsets((rangeCnt + 1) * fileCnt);
+    for (int file = 0; file < fileCnt; file++) {
+        for (size_t range = 0; range < rangeCnt; range++) {
+            rangeOffsets[range * fileCnt + file] = findRepSeqStart(entries[file], entrySizes[file], rangeRepSeq[range]);
+        }
+        rangeOffsets[rangeCnt * fileCnt + file] = entrySizes[file];
+    }
+
+    const uintptr_t pageMask = ~(static_cast<uintptr_t>(Util::getPageSize()) - 1);
+#pragma omp parallel num_threads(threads)
+    {
+        unsigned int thread_idx = 0;
+#ifdef OPENMP
+        thread_idx = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+#pragma omp for schedule(dynamic, 1)
+        for (size_t range = 0; range < rangeCnt; range++) {
+            const size_t *rangeStart = &rangeOffsets[range * fileCnt];
+            const size_t *rangeEnd = &rangeOffsets[(range + 1) * fileCnt];
+#if HAVE_POSIX_MADVISE
+            // let the kernel read the range of every file ahead instead of faulting in page by page
+            for (int file = 0; file < fileCnt; file++) {
+                if (rangeEnd[file] > rangeStart[file]) {
+                    uintptr_t start = reinterpret_cast<uintptr_t>(entries[file] + rangeStart[file]) & pageMask;
+                    uintptr_t end = reinterpret_cast<uintptr_t>(entries[file] + rangeEnd[file]);
+                    posix_madvise(reinterpret_cast<void *>(start), end - start, POSIX_MADV_WILLNEED);
+                }
+            }
+#endif
+            mergeKmerFilesRange<TYPE, T>(dbw, entries, fileCnt, rangeStart, rangeEnd, repSequence, thread_idx);
+        }
+    }
+
     for(size_t file = 0; file < tmpFiles.size(); file++) {
         if (fclose(files[file]) != 0) {
             Debug(Debug::ERROR) << "Cannot close file " << tmpFiles[file] << "\n";
@@ -1087,15 +1595,14 @@ void mergeKmerFilesAndOutput(DBWriter & dbw,
 
 
     delete [] dataSizes;
-    delete [] offsetPos;
     delete [] entries;
     delete [] entrySizes;
     delete [] files;
 }
 
 
-template <int TYPE, typename T, typename seqLenType>
-void writeKmersToDisk(std::string tmpFile, KmerPosition<seqLenType> *hashSeqPair, size_t totalKmers) {
+template <int TYPE, typename T, typename seqLenType, bool IncludeSeqLen>
+void writeKmersToDisk(std::string tmpFile, KmerPosition<seqLenType, IncludeSeqLen> *hashSeqPair, size_t totalKmers) {
     size_t repSeqId = SIZE_T_MAX;
     size_t lastTargetId = SIZE_T_MAX;
     seqLenType lastDiagonal=0;
@@ -1218,25 +1725,33 @@ void setKmerLengthAndAlphabet(Parameters &parameters, size_t aaDbSize, int seqTy
 }
 
 template std::pair<size_t, size_t>  fillKmerPositionArray<0, short>(KmerPosition<short> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
-                                                                    Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution);
+                                                                    Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution, const char * includeKeys);
 template std::pair<size_t, size_t>  fillKmerPositionArray<1, short>(KmerPosition<short> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
-                                                                    Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution);
+                                                                    Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution, const char * includeKeys);
 template std::pair<size_t, size_t>  fillKmerPositionArray<2, short>(KmerPosition<short> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
-                                                                    Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution);
+                                                                    Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution, const char * includeKeys);
 template std::pair<size_t, size_t>  fillKmerPositionArray<0, int>(KmerPosition<int> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
-                                                                  Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution);
+                                                                  Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution, const char * includeKeys);
 template std::pair<size_t, size_t>  fillKmerPositionArray<1, int>(KmerPosition <int>* kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
-                                                                  Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution);
+                                                                  Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution, const char * includeKeys);
 template std::pair<size_t, size_t>  fillKmerPositionArray<2, int>(KmerPosition< int> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
-                                                                  Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution);
+                                                                  Parameters & par, BaseMatrix * subMat, bool hashWholeSequence, size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution, const char * includeKeys);
 
 template KmerPosition<short> *initKmerPositionMemory(size_t size);
 template KmerPosition<int> *initKmerPositionMemory(size_t size);
 
 template size_t computeMemoryNeededLinearfilter<short>(size_t totalKmer);
+
+template void groupKmers<short, false>(KmerPosition<short, false> *kmers, size_t n, bool (*comp)(const KmerPosition<short, false> &, const KmerPosition<short, false> &));
+template void groupKmers<int, false>(KmerPosition<int, false> *kmers, size_t n, bool (*comp)(const KmerPosition<int, false> &, const KmerPosition<int, false> &));
+template void sortKmersByRepSequence<short, false>(KmerPosition<short, false> *kmers, size_t n, bool (*comp)(const KmerPosition<short, false> &, const KmerPosition<short, false> &));
+template void sortKmersByRepSequence<int, false>(KmerPosition<int, false> *kmers, size_t n, bool (*comp)(const KmerPosition<int, false> &, const KmerPosition<int, false> &));
 template size_t computeMemoryNeededLinearfilter<int>(size_t totalKmer);
 
 template std::vector<std::pair<size_t, size_t>>  setupKmerSplits<short>(Parameters &par, BaseMatrix * subMat, DBReader<unsigned int> &seqDbr, size_t totalKmers, size_t splits);
 template std::vector<std::pair<size_t, size_t>>  setupKmerSplits<int>(Parameters &par, BaseMatrix * subMat, DBReader<unsigned int> &seqDbr, size_t totalKmers, size_t splits);
 
+template void writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry, short>(std::string tmpFile, KmerPosition<short> *kmers, size_t totalKmers);
+template void writeKmersToDisk<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev, short>(std::string tmpFile, KmerPosition<short> *kmers, size_t totalKmers);
+
 #undef SIZE_T_MAX
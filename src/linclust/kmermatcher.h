@@ -46,8 +46,46 @@ struct SequencePosition{
     }
 };
 
-template <typename T>
-struct __attribute__((__packed__))KmerPosition {
+// orders the k-mers of both KmerPosition variants by rep. sequence, id and diagonal
+template <typename Kmer>
+struct KmerPositionDiagCompare {
+    static bool compareRepSequenceAndIdAndDiagReverse(const Kmer &first, const Kmer &second){
+        size_t firstKmer  = BIT_SET(first.kmer, 63);
+        size_t secondKmer = BIT_SET(second.kmer, 63);
+        if(firstKmer < secondKmer)
+            return true;
+        if(secondKmer < firstKmer)
+            return false;
+        if(first.id < second.id)
+            return true;
+        if(second.id < first.id)
+            return false;
+        if(first.pos < second.pos)
+            return true;
+        if(second.pos < first.pos)
+            return false;
+        return false;
+    }
+
+    static bool compareRepSequenceAndIdAndDiag(const Kmer &first, const Kmer &second){
+        if(first.kmer < second.kmer)
+            return true;
+        if(second.kmer < first.kmer)
+            return false;
+        if(first.id < second.id)
+            return true;
+        if(second.id < first.id)
+            return false;
+        if(first.pos < second.pos)
+            return true;
+        if(second.pos < first.pos)
+            return false;
+        return false;
+    }
+};
+
+template <typename T, bool IncludeSeqLen = true>
+struct __attribute__((__packed__))KmerPosition : KmerPositionDiagCompare<KmerPosition<T, IncludeSeqLen> > {
     size_t kmer;
     unsigned int id;
     T seqLen;
@@ -94,43 +132,15 @@ struct __attribute__((__packed__))KmerPosition {
             return false;
         return false;
     }
-
-    static bool compareRepSequenceAndIdAndDiagReverse(const KmerPosition<T> &first, const KmerPosition<T> &second){
-        size_t firstKmer  = BIT_SET(first.kmer, 63);
-        size_t secondKmer = BIT_SET(second.kmer, 63);
-        if(firstKmer < secondKmer)
-            return true;
-        if(secondKmer < firstKmer)
-            return false;
-        if(first.id < second.id)
-            return true;
-        if(second.id < first.id)
-            return false;
-        if(first.pos < second.pos)
-            return true;
-        if(second.pos < first.pos)
-            return false;
-        return false;
-    }
-
-    static bool compareRepSequenceAndIdAndDiag(const KmerPosition<T> &first, const KmerPosition<T> &second){
-        if(first.kmer < second.kmer)
-            return true;
-        if(second.kmer < first.kmer)
-            return false;
-        if(first.id < second.id)
-            return true;
-        if(second.id < first.id)
-            return false;
-        if(first.pos < second.pos)
-            return true;
-        if(second.pos < first.pos)
-            return false;
-        return false;
-    }
 };
 
-
+// k-mer of the kmermatcher without the sequence length, assignGroup looks up the length by the id instead
+template <typename T>
+struct __attribute__((__packed__))KmerPosition<T, false> : KmerPositionDiagCompare<KmerPosition<T, false> > {
+    size_t kmer;
+    unsigned int id;
+    T pos;
+};
 
 struct __attribute__((__packed__)) KmerEntry {
     unsigned int seqId;
@@ -193,10 +203,10 @@ public:
 
 
 template  <int TYPE, typename T>
-size_t assignGroup(KmerPosition<T> *kmers, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
+size_t assignGroup(KmerPosition<T, false> *kmers, const T *seqLens, size_t splitKmerCount, bool includeOnlyExtendable, int covMode, float covThr);
 
 template <int TYPE, typename T>
-void mergeKmerFilesAndOutput(DBWriter & dbw, std::vector<std::string> tmpFiles, std::vector<char> &repSequence);
+void mergeKmerFilesAndOutput(DBWriter & dbw, std::vector<std::string> tmpFiles, std::vector<char> &repSequence, size_t threads);
 
 typedef std::priority_queue<FileKmerPosition, std::vector<FileKmerPosition>, CompareResultBySeqId> KmerPositionQueue;
 
@@ -205,11 +215,11 @@ size_t queueNextEntry(KmerPositionQueue &queue, int file, size_t offsetPos, T *e
 
 void setKmerLengthAndAlphabet(Parameters &parameters, size_t aaDbSize, int seqType);
 
-template <int TYPE, typename T, typename seqLenType>
-void writeKmersToDisk(std::string tmpFile, KmerPosition<seqLenType> *kmers, size_t totalKmers);
+template <int TYPE, typename T, typename seqLenType, bool IncludeSeqLen = true>
+void writeKmersToDisk(std::string tmpFile, KmerPosition<seqLenType, IncludeSeqLen> *kmers, size_t totalKmers);
 
 template <int TYPE, typename T>
-void writeKmerMatcherResult(DBWriter & dbw, KmerPosition<T> *hashSeqPair, size_t totalKmers,
+void writeKmerMatcherResult(DBWriter & dbw, KmerPosition<T, false> *hashSeqPair, size_t totalKmers,
                             std::vector<char> &repSequence, size_t threads);
 
 
@@ -217,22 +227,33 @@ template <typename T>
 KmerPosition<T> * doComputation(size_t totalKmers, size_t split, size_t splits, std::string splitFile,
                                 DBReader<unsigned int> & seqDbr, Parameters & par, BaseMatrix  * subMat,
                                 size_t KMER_SIZE, size_t chooseTopKmer, float chooseTopKmerScale = 0.0);
-template <typename T>
-KmerPosition<T> *initKmerPositionMemory(size_t size);
+template <typename T, bool IncludeSeqLen = true>
+KmerPosition<T, IncludeSeqLen> *initKmerPositionMemory(size_t size);
 
-template <int TYPE, typename T>
-std::pair<size_t, size_t>  fillKmerPositionArray(KmerPosition<T> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
+template <int TYPE, typename T, bool IncludeSeqLen = true>
+std::pair<size_t, size_t>  fillKmerPositionArray(KmerPosition<T, IncludeSeqLen> * kmerArray, size_t kmerArraySize, DBReader<unsigned int> &seqDbr,
                                                  Parameters & par, BaseMatrix * subMat, bool hashWholeSequence,
-                                                 size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution);
+                                                 size_t hashStartRange, size_t hashEndRange, size_t * hashDistribution,
+                                                 const char * includeKeys = NULL);
 
 
 void maskSequence(int maskMode, int maskLowerCase,
                   Sequence &seq, int maskLetter, ProbabilityMatrix * probMatrix);
 
-template <typename T>
+template <typename T, bool IncludeSeqLen = true>
 size_t computeMemoryNeededLinearfilter(size_t totalKmer);
 
-template <typename T>
+size_t computeMemoryNeededKmerSort(size_t threads);
+
+// groups k-mers with the same hash, within a group the k-mers are ordered by comp
+template <typename T, bool IncludeSeqLen, typename Compare>
+void groupKmers(KmerPosition<T, IncludeSeqLen> *kmers, size_t n, Compare comp);
+
+// sorts k-mers whose kmer field holds the representative sequence id, comp has to order by it first
+template <typename T, bool IncludeSeqLen, typename Compare>
+void sortKmersByRepSequence(KmerPosition<T, IncludeSeqLen> *kmers, size_t n, Compare comp);
+
+template <typename T, bool IncludeSeqLen = true>
 std::vector<std::pair<size_t, size_t>> setupKmerSplits(Parameters &par, BaseMatrix * subMat, DBReader<unsigned int> &seqDbr, size_t totalKmers, size_t splits);
 
 size_t computeKmerCount(DBReader<unsigned int> &reader, size_t KMER_SIZE, size_t chooseTopKmer,
@@ -63,8 +63,10 @@ void KmerSearch::writeResult(DBWriter & dbw, KmerPosition<short> *kmers, size_t
     size_t repSeqId = SIZE_T_MAX;
     unsigned int prevHitId;
     char buffer[100];
+    // a set can be larger than the buffer, it is streamed to the writer whenever the buffer is full
+    const size_t flushSize = 1024 * 1024;
     std::string prefResultsOutString;
-    prefResultsOutString.reserve(100000000);
+    prefResultsOutString.reserve(flushSize);
     for(size_t i = 0; i < kmerCount; i++) {
         size_t currId = kmers[i].kmer;
         int reverMask = 0;
@@ -74,10 +76,12 @@ void KmerSearch::writeResult(DBWriter & dbw, KmerPosition<short> *kmers, size_t
         }
         if (repSeqId != currId) {
             if(repSeqId != SIZE_T_MAX){
-                dbw.writeData(prefResultsOutString.c_str(), prefResultsOutString.length(), static_cast<unsigned int>(repSeqId), 0);
+                dbw.writeAdd(prefResultsOutString.c_str(), prefResultsOutString.length(), 0);
+                dbw.writeEnd(static_cast<unsigned int>(repSeqId), 0);
             }
             repSeqId = currId;
             prefResultsOutString.clear();
+            dbw.writeStart(0);
         }
 //        std::cout << kmers[i].id << "\t" << kmers[i].pos << std::endl;
         // find maximal diagonal and top score
@@ -118,14 +122,16 @@ void KmerSearch::writeResult(DBWriter & dbw, KmerPosition<short> *kmers, size_t
         h.diagonal =  bestDiagonal;
         int len = QueryMatcher::prefilterHitToBuffer(buffer, h);
         prefResultsOutString.append(buffer, len);
-
-    }
-    // last element
-    if(prefResultsOutString.size()>0){
-        if(repSeqId != SIZE_T_MAX){
-            dbw.writeData(prefResultsOutString.c_str(), prefResultsOutString.length(), static_cast<unsigned int>(repSeqId), 0);
+        if(prefResultsOutString.size() >= flushSize){
+            dbw.writeAdd(prefResultsOutString.c_str(), prefResultsOutString.length(), 0);
+            prefResultsOutString.clear();
         }
     }
+    // last element, every set has at least one hit
+    if(repSeqId != SIZE_T_MAX){
+        dbw.writeAdd(prefResultsOutString.c_str(), prefResultsOutString.length(), 0);
+        dbw.writeEnd(static_cast<unsigned int>(repSeqId), 0);
+    }
 }
 
 template void KmerSearch::writeResult<0>(DBWriter & dbw, KmerPosition<short> *kmers, size_t kmerCount);
@@ -276,13 +282,13 @@ int kmersearch(int argc, const char **argv, const Command &command) {
     tidxdbr.close();
     queryDbr.close();
     if(splitFiles.size()>1){
-        DBWriter writer(par.db3.c_str(), par.db3Index.c_str(), 1, par.compressed, outDbType);
+        DBWriter writer(par.db3.c_str(), par.db3Index.c_str(), par.threads, par.compressed, outDbType);
         writer.open(); // 1 GB buffer
         std::vector<char> empty;
         if(Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_NUCLEOTIDES)) {
-            mergeKmerFilesAndOutput<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev>(writer, splitFiles, empty);
+            mergeKmerFilesAndOutput<Parameters::DBTYPE_NUCLEOTIDES, KmerEntryRev>(writer, splitFiles, empty, par.threads);
         }else{
-            mergeKmerFilesAndOutput<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry>(writer, splitFiles, empty);
+            mergeKmerFilesAndOutput<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry>(writer, splitFiles, empty, par.threads);
         }
         for(size_t i = 0; i < splitFiles.size(); i++){
             FileUtil::remove(splitFiles[i].c_str());
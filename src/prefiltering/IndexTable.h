@@ -19,6 +19,7 @@
 #include "FastSort.h"
 #include <stdlib.h>
 #include <algorithm>
+#include <vector>
 
 // IndexEntryLocal is an entry with position and seqId for a kmer
 // structure needs to be packed or it will need 8 bytes instead of 6
@@ -64,10 +65,17 @@ struct __attribute__((__packed__)) IndexEntryLocalTmp {
 
 class IndexTable {
 public:
+    // k-mers per block of the compressed layout, see compress()
+    static const size_t COMPRESSED_BLOCK_SIZE = 1024;
+    // bit unpacking reads a few bytes past the last list
+    static const size_t COMPRESSED_PADDING = 8;
+
     IndexTable(int alphabetSize, int kmerSize, bool externalData)
             : tableSize(MathUtil::ipow<size_t>(alphabetSize, kmerSize)), alphabetSize(alphabetSize),
               kmerSize(kmerSize), externalData(externalData), tableEntriesNum(0), size(0),
-              indexer(new Indexer(alphabetSize, kmerSize)), entries(NULL), offsets(NULL) {
+              indexer(new Indexer(alphabetSize, kmerSize)), entries(NULL), offsets(NULL),
+              compressed(false), compressedEntries(NULL), compressedEntriesSize(0),
+              compressedOffsets(NULL), blockOffsets(NULL) {
         if (externalData == false) {
             offsets = new(std::nothrow) size_t[tableSize + 1];
             Util::checkAllocation(offsets, "Can not allocate entries memory in IndexTable");
@@ -90,6 +98,18 @@ public:
                 delete[] offsets;
                 offsets = NULL;
             }
+            if (compressedEntries != NULL) {
+                free(compressedEntries);
+                compressedEntries = NULL;
+            }
+            if (compressedOffsets != NULL) {
+                delete[] compressedOffsets;
+                compressedOffsets = NULL;
+            }
+            if (blockOffsets != NULL) {
+                delete[] blockOffsets;
+                blockOffsets = NULL;
+            }
         }
     }
 
@@ -176,6 +196,53 @@ public:
         return (entries + offsets[kmer]);
     }
 
+    // get the number of DB sequences containing this k-mer, works for both table layouts
+    inline size_t getDBSeqListSize(size_t kmer) {
+        if (compressed == false) {
+            return offsets[kmer + 1] - offsets[kmer];
+        }
+        const size_t start = getCompressedOffset(kmer);
+        if (getCompressedOffset(kmer + 1) == start) {
+            return 0;
+        }
+        size_t listSize;
+        readVarint(compressedEntries + start, &listSize);
+        return listSize;
+    }
+
+    // write the list of DB sequences containing this k-mer to out, which needs space for getDBSeqListSize(kmer) entries
+    inline void copyDBSeqList(size_t kmer, IndexEntryLocal *out) {
+        if (compressed == false) {
+            memcpy(out, entries + offsets[kmer], sizeof(IndexEntryLocal) * (offsets[kmer + 1] - offsets[kmer]));
+            return;
+        }
+        const size_t start = getCompressedOffset(kmer);
+        if (getCompressedOffset(kmer + 1) == start) {
+            return;
+        }
+        decodeDBSeqList(compressedEntries + start, out);
+    }
+
+    // hint the cache to load the offsets of a k-mer
+    inline void prefetchOffset(size_t kmer) {
+        if (compressed == false) {
+            __builtin_prefetch(offsets + kmer);
+        } else {
+            __builtin_prefetch(compressedOffsets + kmer);
+        }
+    }
+
+    // hint the cache to load the start of the list of a k-mer, its offsets should have been prefetched before
+    inline void prefetchDBSeqList(size_t kmer) {
+        if (compressed == false) {
+            const char *list = reinterpret_cast<const char *>(entries + offsets[kmer]);
+            __builtin_prefetch(list);
+            __builtin_prefetch(list + 64);
+        } else {
+            __builtin_prefetch(compressedEntries + getCompressedOffset(kmer));
+        }
+    }
+
     void sortDBSeqLists() {
         #pragma omp parallel for
         for (size_t i = 0; i < tableSize; i++) {
@@ -245,6 +312,134 @@ public:
         memcpy(this->offsets, entryOffsets, (tableSize + 1) * sizeof(size_t));
     }
 
+    // init index table with the compressed layout from external data (needed for index readin)
+    void initTableByExternalCompressedData(size_t sequenceCount, size_t tableEntriesNum,
+                                           unsigned char *entries, size_t entriesSize,
+                                           unsigned int *entryOffsets, size_t *blockOffsets) {
+        this->tableEntriesNum = tableEntriesNum;
+        this->size = sequenceCount;
+
+        this->compressed = true;
+        this->compressedEntries = entries;
+        this->compressedEntriesSize = entriesSize;
+        this->compressedOffsets = entryOffsets;
+        this->blockOffsets = blockOffsets;
+    }
+
+    void initTableByExternalCompressedDataCopy(size_t sequenceCount, size_t tableEntriesNum,
+                                               unsigned char *entries, size_t entriesSize,
+                                               unsigned int *entryOffsets, size_t *blockOffsets) {
+        this->tableEntriesNum = tableEntriesNum;
+        this->size = sequenceCount;
+
+        // the uncompressed offsets allocated in the constructor are not needed
+        delete[] offsets;
+        offsets = NULL;
+
+        this->compressed = true;
+        this->compressedEntriesSize = entriesSize;
+        this->compressedEntries = static_cast<unsigned char *>(malloc(entriesSize + COMPRESSED_PADDING));
+        Util::checkAllocation(compressedEntries, "Can not allocate " + SSTR(entriesSize) + " bytes for compressed entries in IndexTable");
+        memcpy(this->compressedEntries, entries, entriesSize);
+        memset(this->compressedEntries + entriesSize, 0, COMPRESSED_PADDING);
+
+        this->compressedOffsets = new(std::nothrow) unsigned int[tableSize + 1];
+        Util::checkAllocation(compressedOffsets, "Can not allocate compressed offsets memory in IndexTable");
+        memcpy(this->compressedOffsets, entryOffsets, (tableSize + 1) * sizeof(unsigned int));
+
+        this->blockOffsets = new(std::nothrow) size_t[getBlockOffsetsSize()];
+        Util::checkAllocation(this->blockOffsets, "Can not allocate block offsets memory in IndexTable");
+        memcpy(this->blockOffsets, blockOffsets, getBlockOffsetsSize() * sizeof(size_t));
+    }
+
+    // convert a filled and sorted table into the compressed layout
+    // every k-mer list is stored as: varint list size, varint first seqId, and, if there is more than one entry,
+    // the bit widths of the seqId deltas and of the positions followed by the bit-packed deltas and positions.
+    // k-mer offsets are 32-bit relative to the start of a block of COMPRESSED_BLOCK_SIZE k-mers.
+    // returns false and keeps the uncompressed layout if a block does not fit the 32-bit offsets
+    bool compress() {
+        if (compressed == true) {
+            return true;
+        }
+        const size_t blockCount = getBlockOffsetsSize();
+        compressedOffsets = new(std::nothrow) unsigned int[tableSize + 1];
+        Util::checkAllocation(compressedOffsets, "Can not allocate compressed offsets memory in IndexTable");
+        blockOffsets = new(std::nothrow) size_t[blockCount];
+        Util::checkAllocation(blockOffsets, "Can not allocate block offsets memory in IndexTable");
+
+        // compute the encoded size of each list in parallel and the offsets with a serial prefix sum
+        bool overflow = false;
+#pragma omp parallel for schedule(static, COMPRESSED_BLOCK_SIZE)
+        for (size_t i = 0; i < tableSize; i++) {
+            const size_t listSize = encodeDBSeqList(entries + offsets[i], offsets[i + 1] - offsets[i], NULL);
+            if (listSize > UINT_MAX) {
+                overflow = true;
+            }
+            compressedOffsets[i] = static_cast<unsigned int>(listSize);
+        }
+        size_t totalSize = 0;
+        for (size_t i = 0; i <= tableSize && overflow == false; i++) {
+            if (i % COMPRESSED_BLOCK_SIZE == 0) {
+                blockOffsets[i / COMPRESSED_BLOCK_SIZE] = totalSize;
+            }
+            const size_t relativeOffset = totalSize - blockOffsets[i / COMPRESSED_BLOCK_SIZE];
+            if (relativeOffset > UINT_MAX) {
+                overflow = true;
+                break;
+            }
+            const size_t listSize = (i < tableSize) ? compressedOffsets[i] : 0;
+            compressedOffsets[i] = static_cast<unsigned int>(relativeOffset);
+            totalSize += listSize;
+        }
+        if (overflow == true) {
+            Debug(Debug::WARNING) << "K-mer lists are too large for the compressed index table layout. Keep the uncompressed layout.\n";
+            delete[] compressedOffsets;
+            compressedOffsets = NULL;
+            delete[] blockOffsets;
+            blockOffsets = NULL;
+            return false;
+        }
+
+        compressedEntriesSize = totalSize;
+        compressedEntries = static_cast<unsigned char *>(calloc(totalSize + COMPRESSED_PADDING, sizeof(unsigned char)));
+        Util::checkAllocation(compressedEntries, "Can not allocate " + SSTR(totalSize) + " bytes for compressed entries in IndexTable");
+#pragma omp parallel for schedule(static, COMPRESSED_BLOCK_SIZE)
+        for (size_t i = 0; i < tableSize; i++) {
+            encodeDBSeqList(entries + offsets[i], offsets[i + 1] - offsets[i], compressedEntries + getCompressedOffset(i));
+        }
+
+        delete[] entries;
+        entries = NULL;
+        delete[] offsets;
+        offsets = NULL;
+        compressed = true;
+        return true;
+    }
+
+    bool isCompressed() {
+        return compressed;
+    }
+
+    unsigned char *getCompressedEntries() {
+        return compressedEntries;
+    }
+
+    size_t getCompressedEntriesSize() {
+        return compressedEntriesSize;
+    }
+
+    unsigned int *getCompressedOffsets() {
+        return compressedOffsets;
+    }
+
+    size_t *getBlockOffsets() {
+        return blockOffsets;
+    }
+
+    size_t getBlockOffsetsSize() {
+        return tableSize / COMPRESSED_BLOCK_SIZE + 1;
+    }
+
     void revertPointer() {
         for (size_t i = tableSize; i > 0; i--) {
             offsets[i] = offsets[i - 1];
@@ -263,7 +458,7 @@ public:
         size_t minKmer = 0;
         size_t emptyKmer = 0;
         for (size_t i = 0; i < tableSize; i++) {
-            const ptrdiff_t size = offsets[i + 1] - offsets[i];
+            const ptrdiff_t size = getDBSeqListSize(i);
             minKmer = std::min(minKmer, (size_t) size);
             entrySize += size;
             if (size == 0) {
@@ -283,7 +478,12 @@ public:
         double avgKmer = ((double) entrySize) / ((double) tableSize);
         Debug(Debug::INFO) << "Index statistics\n";
         Debug(Debug::INFO) << "Entries:          " << entrySize << "\n";
-        Debug(Debug::INFO) << "DB size:          " << (entrySize * sizeof(IndexEntryLocal) + tableSize * sizeof(size_t))/1024/1024 << " MB\n";
+        if (compressed) {
+            Debug(Debug::INFO) << "DB size:          " << (compressedEntriesSize + tableSize * sizeof(unsigned int) + getBlockOffsetsSize() * sizeof(size_t))/1024/1024
+                               << " MB (uncompressed " << (entrySize * sizeof(IndexEntryLocal) + tableSize * sizeof(size_t))/1024/1024 << " MB)\n";
+        } else {
+            Debug(Debug::INFO) << "DB size:          " << (entrySize * sizeof(IndexEntryLocal) + tableSize * sizeof(size_t))/1024/1024 << " MB\n";
+        }
         Debug(Debug::INFO) << "Avg k-mer size:   " << avgKmer << "\n";
         Debug(Debug::INFO) << "Top " << top_N << " k-mers\n";
         for (size_t j = 0; j < top_N; j++) {
@@ -395,14 +595,16 @@ public:
 
     // prints the IndexTable
     void print(char *num2aa) {
+        std::vector<IndexEntryLocal> e;
         for (size_t i = 0; i < tableSize; i++) {
-            ptrdiff_t entrySize = offsets[i + 1] - offsets[i];
+            size_t entrySize = getDBSeqListSize(i);
             if (entrySize > 0) {
                 indexer->printKmer(i, kmerSize, num2aa);
 
                 Debug(Debug::INFO) << "\n";
-                IndexEntryLocal *e = &entries[offsets[i]];
-                for (ptrdiff_t j = 0; j < entrySize; j++) {
+                e.resize(entrySize);
+                copyDBSeqList(i, e.data());
+                for (size_t j = 0; j < entrySize; j++) {
                     Debug(Debug::INFO) << "\t(" << e[j].seqId << ", " << e[j].position_j << ")\n";
                 }
             }
@@ -480,5 +682,156 @@ protected:
 
     // sequence lookup
     SequenceLookup *sequenceLookup;
+
+    // compressed layout, see compress()
+    bool compressed;
+    unsigned char *compressedEntries;
+    size_t compressedEntriesSize;
+    unsigned int *compressedOffsets;
+    size_t *blockOffsets;
+
+    inline size_t getCompressedOffset(size_t kmer) {
+        return blockOffsets[kmer / COMPRESSED_BLOCK_SIZE] + compressedOffsets[kmer];
+    }
+
+    static inline int bitsNeeded(unsigned int value) {
+        return (value == 0) ? 0 : 32 - __builtin_clz(value);
+    }
+
+    static inline size_t writeVarint(unsigned char *out, size_t value) {
+        size_t pos = 0;
+        while (value >= 0x80) {
+            if (out != NULL) {
+                out[pos] = static_cast<unsigned char>(value | 0x80);
+            }
+            value >>= 7;
+            pos++;
+        }
+        if (out != NULL) {
+            out[pos] = static_cast<unsigned char>(value);
+        }
+        return pos + 1;
+    }
+
+    static inline const unsigned char *readVarint(const unsigned char *in, size_t *value) {
+        size_t result = 0;
+        int shift = 0;
+        while (*in & 0x80) {
+            result |= static_cast<size_t>(*in & 0x7F) << shift;
+            shift += 7;
+            in++;
+        }
+        *value = result | (static_cast<size_t>(*in) << shift);
+        return in + 1;
+    }
+
+    // out has to be zero initialized
+    static inline void writeBits(unsigned char *out, size_t bitPos, unsigned int value, int width) {
+        unsigned char *p = out + (bitPos >> 3);
+        uint64_t word = static_cast<uint64_t>(value) << (bitPos & 7);
+        for (int bits = width + static_cast<int>(bitPos & 7); bits > 0; bits -= 8) {
+            *p |= static_cast<unsigned char>(word);
+            word >>= 8;
+            p++;
+        }
+    }
+
+    static inline unsigned int readBits(const unsigned char *in, size_t bitPos, int width) {
+        const unsigned char *p = in + (bitPos >> 3);
+        // assembled byte wise to stay independent of the endianness, compilers turn this into a single load
+        const uint64_t word = static_cast<uint64_t>(p[0])       | (static_cast<uint64_t>(p[1]) << 8)
+                            | (static_cast<uint64_t>(p[2]) << 16) | (static_cast<uint64_t>(p[3]) << 24)
+                            | (static_cast<uint64_t>(p[4]) << 32);
+        return static_cast<unsigned int>((word >> (bitPos & 7)) & ((UINT64_C(1) << width) - 1));
+    }
+
+    // encode a sorted list, returns the encoded size in bytes. If out is NULL, only the size is computed
+    static size_t encodeDBSeqList(const IndexEntryLocal *list, size_t listSize, unsigned char *out) {
+        if (listSize == 0) {
+            return 0;
+        }
+        size_t pos = writeVarint(out, listSize);
+        pos += writeVarint((out != NULL) ? out + pos : NULL, list[0].seqId);
+        if (listSize == 1) {
+            if (out != NULL) {
+                out[pos]     = static_cast<unsigned char>(list[0].position_j);
+                out[pos + 1] = static_cast<unsigned char>(list[0].position_j >> 8);
+            }
+            return pos + 2;
+        }
+
+        // seqIds are unique within a list, so store delta - 1
+        unsigned int maxDelta = 0;
+        unsigned int maxPos = list[0].position_j;
+        for (size_t i = 1; i < listSize; i++) {
+            maxDelta |= list[i].seqId - list[i - 1].seqId - 1;
+            maxPos |= list[i].position_j;
+        }
+        const int deltaBits = bitsNeeded(maxDelta);
+        const int posBits = bitsNeeded(maxPos);
+        const size_t totalBits = (listSize - 1) * deltaBits + listSize * posBits;
+        if (out != NULL) {
+            out[pos] = static_cast<unsigned char>(deltaBits);
+            out[pos + 1] = static_cast<unsigned char>(posBits);
+            unsigned char *bits = out + pos + 2;
+            size_t bitPos = 0;
+            writeBits(bits, bitPos, list[0].position_j, posBits);
+            bitPos += posBits;
+            for (size_t i = 1; i < listSize; i++) {
+                writeBits(bits, bitPos, list[i].seqId - list[i - 1].seqId - 1, deltaBits);
+                bitPos += deltaBits;
+                writeBits(bits, bitPos, list[i].position_j, posBits);
+                bitPos += posBits;
+            }
+        }
+        return pos + 2 + (totalBits + 7) / 8;
+    }
+
+    static inline void decodeDBSeqList(const unsigned char *in, IndexEntryLocal *out) {
+        size_t listSize;
+        size_t seqId;
+        in = readVarint(in, &listSize);
+        in = readVarint(in, &seqId);
+        out[0].seqId = static_cast<unsigned int>(seqId);
+        if (listSize == 1) {
+            out[0].position_j = static_cast<unsigned short>(in[0] | (in[1] << 8));
+            return;
+        }
+        const int deltaBits = in[0];
+        const int posBits = in[1];
+        const unsigned char *bits = in + 2;
+        out[0].position_j = static_cast<unsigned short>(readBits(bits, 0, posBits));
+        size_t bitPos = posBits;
+        unsigned int prevSeqId = out[0].seqId;
+        if (deltaBits == 0) {
+            // consecutive seqIds, only the positions are stored
+            for (size_t i = 1; i < listSize; i++) {
+                prevSeqId++;
+                out[i].seqId = prevSeqId;
+                out[i].position_j = static_cast<unsigned short>(readBits(bits, bitPos, posBits));
+                bitPos += posBits;
+            }
+            return;
+        }
+        // delta and position are read together whenever they fit into 32 bits
+        const int pairBits = deltaBits + posBits;
+        if (pairBits <= 32 && deltaBits < 32) {
+            for (size_t i = 1; i < listSize; i++) {
+                const unsigned int pair = readBits(bits, bitPos, pairBits);
+                prevSeqId += (pair & ((1u << deltaBits) - 1)) + 1;
+                out[i].seqId = prevSeqId;
+                out[i].position_j = static_cast<unsigned short>(pair >> deltaBits);
+                bitPos += pairBits;
+            }
+            return;
+        }
+        for (size_t i = 1; i < listSize; i++) {
+            prevSeqId += readBits(bits, bitPos, deltaBits) + 1;
+            bitPos += deltaBits;
+            out[i].seqId = prevSeqId;
+            out[i].position_j = static_cast<unsigned short>(readBits(bits, bitPos, posBits));
+            bitPos += posBits;
+        }
+    }
 };
 #endif
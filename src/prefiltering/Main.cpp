@@ -5,6 +5,7 @@
 #include "DBReader.h"
 #include "Timer.h"
 #include "FileUtil.h"
+#include "PrefilterServer.h"
 
 #ifdef OPENMP
 #include <omp.h>
@@ -16,6 +17,10 @@ int prefilter(int argc, const char **argv, const Command& command) {
     Parameters& par = Parameters::getInstance();
     par.parseParameters(argc, argv, command, true, 0, MMseqsParameter::COMMAND_PREFILTER);
 
+    if (par.prefilterServer.empty() == false) {
+        return PrefilterServer::request(par.prefilterServer, argc, argv);
+    }
+
     Timer timer;
     int queryDbType = FileUtil::parseDbType(par.db1.c_str());
     int targetDbType = FileUtil::parseDbType(par.db2.c_str());
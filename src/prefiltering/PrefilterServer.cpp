@@ -0,0 +1,298 @@
+#include "PrefilterServer.h"
+#include "PrefilteringIndexReader.h"
+#include "DBReader.h"
+#include "Command.h"
+#include "Debug.h"
+#include "Parameters.h"
+#include "Timer.h"
+#include "Util.h"
+
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+extern Command *getCommandByName(const char *s);
+
+static volatile sig_atomic_t stopServer = 0;
+
+static void handleStopSignal(int) {
+    stopServer = 1;
+}
+
+static bool initSocketAddress(const std::string &socketPath, struct sockaddr_un *addr) {
+    memset(addr, 0, sizeof(struct sockaddr_un));
+    addr->sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(addr->sun_path)) {
+        Debug(Debug::ERROR) << "Socket path " << socketPath << " is too long\n";
+        return false;
+    }
+    strncpy(addr->sun_path, socketPath.c_str(), sizeof(addr->sun_path) - 1);
+    return true;
+}
+
+bool PrefilterServer::writeAll(int fd, const char *data, size_t size) {
+    while (size > 0) {
+        ssize_t written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+bool PrefilterServer::readRequest(int fd, std::vector<std::string> &args) {
+    const size_t maxRequestSize = 1024 * 1024;
+    std::string buffer;
+    char chunk[4096];
+    while (buffer.size() < maxRequestSize) {
+        ssize_t readSize = read(fd, chunk, sizeof(chunk));
+        if (readSize < 0 && errno == EINTR) {
+            continue;
+        }
+        if (readSize <= 0) {
+            return false;
+        }
+        buffer.append(chunk, readSize);
+        // the request ends with an empty string
+        size_t start = 0;
+        args.clear();
+        for (size_t i = 0; i < buffer.size(); i++) {
+            if (buffer[i] != '\0') {
+                continue;
+            }
+            if (i == start) {
+                return true;
+            }
+            args.emplace_back(buffer, start, i - start);
+            start = i + 1;
+        }
+    }
+    return false;
+}
+
+int PrefilterServer::request(const std::string &socketPath, int argc, const char **argv) {
+    struct sockaddr_un addr;
+    if (initSocketAddress(socketPath, &addr) == false) {
+        return EXIT_FAILURE;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *) &addr, sizeof(addr)) != 0) {
+        Debug(Debug::ERROR) << "Could not connect to prefilter server " << socketPath << ": " << strerror(errno) << "\n";
+        if (fd >= 0) {
+            close(fd);
+        }
+        return EXIT_FAILURE;
+    }
+
+    char cwd[PATH_MAX];
+    if (getcwd(cwd, sizeof(cwd)) == NULL) {
+        Debug(Debug::ERROR) << "Could not get the current working directory\n";
+        close(fd);
+        return EXIT_FAILURE;
+    }
+    std::string request(cwd);
+    request.push_back('\0');
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], "--prefilter-server") == 0) {
+            i++;
+            continue;
+        }
+        request.append(argv[i]);
+        request.push_back('\0');
+    }
+    request.push_back('\0');
+    if (writeAll(fd, request.c_str(), request.size()) == false) {
+        Debug(Debug::ERROR) << "Could not send request to prefilter server " << socketPath << "\n";
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    // the worker log is relayed until a null byte, which is followed by the exit code
+    std::string status;
+    bool inStatus = false;
+    char chunk[4096];
+    ssize_t readSize;
+    while ((readSize = read(fd, chunk, sizeof(chunk))) != 0) {
+        if (readSize < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        for (ssize_t i = 0; i < readSize; i++) {
+            if (inStatus) {
+                status.push_back(chunk[i]);
+            } else if (chunk[i] == '\0') {
+                inStatus = true;
+            } else {
+                std::cout << chunk[i];
+            }
+        }
+    }
+    std::cout << std::flush;
+    close(fd);
+
+    if (inStatus == false || status.empty()) {
+        Debug(Debug::ERROR) << "Prefilter server " << socketPath << " closed the connection before the request finished\n";
+        return EXIT_FAILURE;
+    }
+    return Util::fast_atoi<int>(status.c_str());
+}
+
+int PrefilterServer::handleRequest(int fd) {
+    std::vector<std::string> args;
+    if (readRequest(fd, args) == false || args.empty()) {
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    pid_t worker = fork();
+    if (worker == 0) {
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        close(fd);
+        if (chdir(args[0].c_str()) != 0) {
+            Debug(Debug::ERROR) << "Could not change to directory " << args[0] << "\n";
+            exit(EXIT_FAILURE);
+        }
+        std::vector<const char *> argv;
+        for (size_t i = 1; i < args.size(); i++) {
+            argv.push_back(args[i].c_str());
+        }
+        argv.push_back(NULL);
+        Command *command = getCommandByName("prefilter");
+        int status = command->commandFunction(static_cast<int>(args.size() - 1), argv.data(), *command);
+        std::cout << std::flush;
+        std::cerr << std::flush;
+        exit(status);
+    }
+
+    int status = EXIT_FAILURE;
+    if (worker < 0) {
+        const char *message = "Could not fork prefilter worker\n";
+        writeAll(fd, message, strlen(message));
+    } else {
+        int workerStatus;
+        while (waitpid(worker, &workerStatus, 0) < 0 && errno == EINTR);
+        if (WIFEXITED(workerStatus)) {
+            status = WEXITSTATUS(workerStatus);
+        }
+    }
+    std::string trailer(1, '\0');
+    trailer.append(SSTR(status));
+    writeAll(fd, trailer.c_str(), trailer.size());
+    close(fd);
+    return EXIT_SUCCESS;
+}
+
+int PrefilterServer::serve(const std::string &socketPath) {
+    struct sockaddr_un addr;
+    if (initSocketAddress(socketPath, &addr) == false) {
+        return EXIT_FAILURE;
+    }
+
+    // only replace stale sockets of an earlier server
+    struct stat st;
+    if (lstat(socketPath.c_str(), &st) == 0) {
+        if (S_ISSOCK(st.st_mode) == false) {
+            Debug(Debug::ERROR) << socketPath << " exists and is not a socket\n";
+            return EXIT_FAILURE;
+        }
+        unlink(socketPath.c_str());
+    }
+
+    int serverFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (serverFd < 0 || bind(serverFd, (struct sockaddr *) &addr, sizeof(addr)) != 0 || listen(serverFd, 64) != 0) {
+        Debug(Debug::ERROR) << "Could not listen on " << socketPath << ": " << strerror(errno) << "\n";
+        if (serverFd >= 0) {
+            close(serverFd);
+        }
+        return EXIT_FAILURE;
+    }
+
+    // request handlers are not waited for
+    signal(SIGCHLD, SIG_IGN);
+    // no SA_RESTART, so accept returns on a stop signal
+    struct sigaction stopAction;
+    memset(&stopAction, 0, sizeof(stopAction));
+    stopAction.sa_handler = handleStopSignal;
+    sigemptyset(&stopAction.sa_mask);
+    sigaction(SIGINT, &stopAction, NULL);
+    sigaction(SIGTERM, &stopAction, NULL);
+
+    Debug(Debug::INFO) << "Listening on " << socketPath << "\n";
+    while (stopServer == 0) {
+        int fd = accept(serverFd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Debug(Debug::ERROR) << "Could not accept connection: " << strerror(errno) << "\n";
+            break;
+        }
+        pid_t handler = fork();
+        if (handler == 0) {
+            close(serverFd);
+            signal(SIGCHLD, SIG_DFL);
+            signal(SIGINT, SIG_DFL);
+            signal(SIGTERM, SIG_DFL);
+            _exit(handleRequest(fd));
+        }
+        if (handler < 0) {
+            Debug(Debug::ERROR) << "Could not fork request handler: " << strerror(errno) << "\n";
+        }
+        close(fd);
+    }
+
+    close(serverFd);
+    unlink(socketPath.c_str());
+    Debug(Debug::INFO) << "Prefilter server stopped\n";
+    return EXIT_SUCCESS;
+}
+
+int prefilterserver(int argc, const char **argv, const Command &command) {
+    Parameters &par = Parameters::getInstance();
+    par.parseParameters(argc, argv, command, true, 0, 0);
+
+    std::string indexDB = PrefilteringIndexReader::searchForIndex(par.db1);
+    if (indexDB.empty()) {
+        Debug(Debug::ERROR) << "No index found for " << par.db1 << ". Please create one with createindex first.\n";
+        return EXIT_FAILURE;
+    }
+
+#ifdef OPENMP
+    // workers are forked from this process, OpenMP can only be used in them if no thread team was started here
+    omp_set_num_threads(1);
+#endif
+
+    DBReader<unsigned int> dbr(indexDB.c_str(), (indexDB + ".index").c_str(), 1, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+    dbr.open(DBReader<unsigned int>::NOSORT);
+    if (PrefilteringIndexReader::checkIfIndexFile(&dbr) == false) {
+        Debug(Debug::ERROR) << "Outdated index version. Please recompute it with 'createindex'!\n";
+        return EXIT_FAILURE;
+    }
+
+    Timer timer;
+    PrefilteringIndexReader::loadResidentIndex(&dbr);
+    Debug(Debug::INFO) << "Time for loading " << indexDB << ": " << timer.lap() << "\n";
+
+    int status = PrefilterServer::serve(par.db2);
+    dbr.close();
+    return status;
+}
@@ -0,0 +1,30 @@
+#ifndef PREFILTERSERVER_H
+#define PREFILTERSERVER_H
+
+//
+// Keeps a precomputed index resident and runs prefilter requests against it.
+// Requests arrive over a UNIX socket, each one is run in a forked worker that shares
+// the loaded index tables copy-on-write with the server.
+//
+
+#include <string>
+#include <vector>
+
+class PrefilterServer {
+public:
+    // send a prefilter call (without --prefilter-server) to the server, relay its log and return its exit code
+    static int request(const std::string &socketPath, int argc, const char **argv);
+
+    // accept requests until SIGINT or SIGTERM
+    static int serve(const std::string &socketPath);
+
+private:
+    static int handleRequest(int fd);
+
+    static bool writeAll(int fd, const char *data, size_t size);
+
+    // a request is a sequence of null terminated strings: working directory, arguments, empty string
+    static bool readRequest(int fd, std::vector<std::string> &args);
+};
+
+#endif
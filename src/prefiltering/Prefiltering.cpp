@@ -9,10 +9,12 @@
 #include "FileUtil.h"
 #include "IndexBuilder.h"
 #include "Timer.h"
+#include "Numa.h"
 #include "ByteParser.h"
 #include "Parameters.h"
 #include "MemoryMapped.h"
 #include "FastSort.h"
+#include "Alignment.h"
 #include <sys/mman.h>
 
 #ifdef OPENMP
@@ -50,7 +52,12 @@ Prefiltering::Prefiltering(const std::string &queryDB,
         aaBiasCorrection(par.compBiasCorrection != 0),
         covThr(par.covThr), covMode(par.covMode), includeIdentical(par.includeIdentity),
         preloadMode(par.preloadMode),
-        threads(static_cast<unsigned int>(par.threads)), compressed(par.compressed) {
+        threads(static_cast<unsigned int>(par.threads)), compressed(par.compressed),
+        prefilterBatchSize(static_cast<size_t>(par.prefilterBatchSize)), indexCompression(par.indexCompression != 0),
+        prefetchDistance(static_cast<unsigned int>(par.prefetchDistance)),
+        maxKmersPerPos(par.maxKmersPerPos),
+        numa(par.numa),
+        aligner(NULL) {
     sameQTDB = isSameQTDB();
 
     // init the substitution matrices
@@ -90,8 +97,12 @@ Prefiltering::Prefiltering(const std::string &queryDB,
             }
         }
 
-        tidxdbr = new DBReader<unsigned int>(targetDB.c_str(), targetDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA);
+        tidxdbr = new DBReader<unsigned int>(targetDB.c_str(), targetDBIndex.c_str(), threads, DBReader<unsigned int>::USE_INDEX | DBReader<unsigned int>::USE_DATA | DBReader<unsigned int>::USE_SHARED_MEMORY);
         tidxdbr->open(DBReader<unsigned int>::NOSORT);
+        // an index loaded with loadidx is already resident and shared, copying it would only waste memory
+        if (tidxdbr->isSharedMemory() && par.preloadMode == Parameters::PRELOAD_MODE_AUTO) {
+            preloadMode = Parameters::PRELOAD_MODE_MMAP;
+        }
 
         templateDBIsIndex = PrefilteringIndexReader::checkIfIndexFile(tidxdbr);
         if (templateDBIsIndex == true) {
@@ -149,6 +160,7 @@ Prefiltering::Prefiltering(const std::string &queryDB,
             }
 
             splits = data.splits;
+            indexCompression = data.compressed != 0;
             if (data.splits > 1) {
                 splitMode = Parameters::TARGET_DB_SPLIT;
             }
@@ -165,6 +177,12 @@ Prefiltering::Prefiltering(const std::string &queryDB,
         templateDBIsIndex = false;
     }
 
+    // the k-mer generator refers to the profile matrix of a single query sequence
+    if (Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_HMM_PROFILE) ||
+        Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_PROFILE_STATE_PROFILE)) {
+        prefilterBatchSize = 1;
+    }
+
     // restrict amount of allocated memory if all results are requested
     // INT_MAX would allocate 72GB RAM per thread for no reason
     maxResListLen = std::min(tdbr->getSize(), maxResListLen);
@@ -191,7 +209,7 @@ Prefiltering::Prefiltering(const std::string &queryDB,
 
     setupSplit(*tdbr, alphabetSize - 1, querySeqType,
                threads, templateDBIsIndex, memoryLimit, qdbr->getSize(),
-               maxResListLen, kmerSize, splits, splitMode);
+               maxResListLen, kmerSize, splits, splitMode, indexCompression);
 
     if(Parameters::isEqualDbtype(targetSeqType, Parameters::DBTYPE_NUCLEOTIDES) == false){
         const bool isProfileSearch = Parameters::isEqualDbtype(querySeqType, Parameters::DBTYPE_HMM_PROFILE) ||
@@ -257,10 +275,11 @@ Prefiltering::~Prefiltering() {
 
 void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSize, const unsigned int querySeqTyp, const int threads,
                               const bool templateDBIsIndex, const size_t memoryLimit, const size_t qDbSize,
-                              size_t &maxResListLen, int &kmerSize, int &split, int &splitMode) {
+                              size_t &maxResListLen, int &kmerSize, int &split, int &splitMode, const bool indexCompression) {
     size_t memoryNeeded = estimateMemoryConsumption(1, tdbr.getSize(), tdbr.getAminoAcidDBSize(), maxResListLen, alphabetSize,
                                                     kmerSize == 0 ? // if auto detect kmerSize
-                                                    IndexTable::computeKmerSize(tdbr.getAminoAcidDBSize()) : kmerSize, querySeqTyp, threads);
+                                                    IndexTable::computeKmerSize(tdbr.getAminoAcidDBSize()) : kmerSize, querySeqTyp, threads,
+                                                    indexCompression);
 
     int optimalSplitMode = Parameters::TARGET_DB_SPLIT;
     if (memoryNeeded > 0.9 * memoryLimit) {
@@ -293,7 +312,7 @@ void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSi
     if (memoryNeeded > 0.9 * memoryLimit) {
         // memory is not enough to compute everything at once
         //TODO add PROFILE_STATE (just 6-mers)
-        std::pair<int, int> splitSettings = Prefiltering::optimizeSplit(memoryLimit, &tdbr, alphabetSize, kmerSize, querySeqTyp, threads);
+        std::pair<int, int> splitSettings = Prefiltering::optimizeSplit(memoryLimit, &tdbr, alphabetSize, kmerSize, querySeqTyp, threads, indexCompression);
         if (splitSettings.second == -1) {
             Debug(Debug::ERROR) << "Cannot fit databases into " << ByteParser::format(memoryLimit) << ". Please use a computer with more main memory.\n";
             EXIT(EXIT_FAILURE);
@@ -350,7 +369,8 @@ void Prefiltering::setupSplit(DBReader<unsigned int>& tdbr, const int alphabetSi
     }
 
     size_t memoryNeededPerSplit = estimateMemoryConsumption((splitMode == Parameters::TARGET_DB_SPLIT) ? split : 1, tdbr.getSize(),
-                                                            tdbr.getAminoAcidDBSize(), maxResListLen, alphabetSize, kmerSize, querySeqTyp, threads);
+                                                            tdbr.getAminoAcidDBSize(), maxResListLen, alphabetSize, kmerSize, querySeqTyp, threads,
+                                                            indexCompression);
     Debug(Debug::INFO) << "Estimated memory consumption: " << ByteParser::format(memoryNeededPerSplit) << "\n";
     if (memoryNeededPerSplit > 0.9 * memoryLimit) {
         Debug(Debug::WARNING) << "Process needs more than " << ByteParser::format(memoryLimit) << " main memory.\n" <<
@@ -497,6 +517,10 @@ ScoreMatrix Prefiltering::getScoreMatrix(const BaseMatrix& matrix, const size_t
 }
 
 void Prefiltering::getIndexTable(int split, size_t dbFrom, size_t dbSize) {
+    // all nodes read the index equally often, so it should not end up on the node of the loading thread
+    if (numa) {
+        Numa::setInterleavePolicy();
+    }
     if (templateDBIsIndex == true) {
         indexTable = PrefilteringIndexReader::getIndexTable(split, tidxdbr, preloadMode);
         // only the ungapped alignment needs the sequence lookup, we can save quite some memory here
@@ -530,10 +554,16 @@ void Prefiltering::getIndexTable(int split, size_t dbFrom, size_t dbSize) {
             sequenceLookup = NULL;
         }
 
+        if (indexCompression) {
+            indexTable->compress();
+        }
         indexTable->printStatistics(kmerSubMat->num2aa);
         tdbr->remapData();
         Debug(Debug::INFO) << "Time for index table init: " << timer.lap() << "\n";
     }
+    if (numa) {
+        Numa::setDefaultPolicy();
+    }
 }
 
 bool Prefiltering::isSameQTDB() {
@@ -551,6 +581,20 @@ bool Prefiltering::isSameQTDB() {
     return (queryDB.compare(targetDB) == 0 || (match == true));
 }
 
+int Prefiltering::getOutputDbtype() {
+    return aligner != NULL ? aligner->getOutputDbtype() : Parameters::DBTYPE_PREFILTER_RES;
+}
+
+void Prefiltering::setAligner(Alignment *aligner) {
+    // alignment results of different target splits cannot be merged like prefilter results
+    if (splitMode == Parameters::TARGET_DB_SPLIT && splits > 1) {
+        Debug(Debug::ERROR) << "The target index does not fit into memory and has to be split into " << splits << " parts.\n"
+                            << "Run prefilter and align separately or increase --split-memory-limit.\n";
+        EXIT(EXIT_FAILURE);
+    }
+    this->aligner = aligner;
+}
+
 void Prefiltering::runAllSplits(const std::string &resultDB, const std::string &resultDBIndex) {
     runSplits(resultDB, resultDBIndex, 0, splits, false);
 }
@@ -633,7 +677,7 @@ void Prefiltering::runMpiSplits(const std::string &resultDB, const std::string &
             // merge output databases
             mergePrefilterSplits(resultDB, resultDBIndex, splitFiles);
         } else {
-            DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, Parameters::DBTYPE_PREFILTER_RES);
+            DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, getOutputDbtype());
             writer.open();
             writer.close();
         }
@@ -682,7 +726,7 @@ int Prefiltering::runSplits(const std::string &resultDB, const std::string &resu
                 resultReader.open(DBReader<unsigned int>::NOSORT);
                 resultReader.readMmapedDataInMemory();
                 const std::pair<std::string, std::string> tempDb = Util::databaseNames(resultDB + "_tmp");
-                DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), threads, compressed, Parameters::DBTYPE_PREFILTER_RES);
+                DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), threads, compressed, getOutputDbtype());
                 resultWriter.open();
                 resultWriter.sortDatafileByIdOrder(resultReader);
                 resultWriter.close(true);
@@ -697,7 +741,7 @@ int Prefiltering::runSplits(const std::string &resultDB, const std::string &resu
             hasResult = true;
         }
     } else if (splitProcessCount == 0) {
-        DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, Parameters::DBTYPE_PREFILTER_RES);
+        DBWriter writer(resultDB.c_str(), resultDBIndex.c_str(), 1, compressed, getOutputDbtype());
         writer.open();
         writer.close();
         hasResult = false;
@@ -742,6 +786,7 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
     Debug(Debug::INFO) << "k-mer similarity threshold: " << kmerThr << "\n";
 
     double kmersPerPos = 0;
+    double kmerThrSum = 0;
     size_t dbMatches = 0;
     size_t doubleMatches = 0;
     size_t querySeqLenSum = 0;
@@ -756,8 +801,12 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
     localThreads = std::min((unsigned int)threads, (unsigned int)querySize);
 #endif
 
-    DBWriter tmpDbw(resultDB.c_str(), resultDBIndex.c_str(), localThreads, compressed, Parameters::DBTYPE_PREFILTER_RES);
+    DBWriter tmpDbw(resultDB.c_str(), resultDBIndex.c_str(), localThreads, compressed, getOutputDbtype());
     tmpDbw.open();
+    size_t alignmentsNum = 0;
+    size_t totalPassedNum = 0;
+    Alignment::RejectedHits rejectedHits;
+    SmithWaterman::PassCounts passCounts;
 
     // init all thread-specific data structures
     char *notEmpty = new char[querySize];
@@ -773,98 +822,174 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
     Debug(Debug::INFO) << "Target db start " << (dbFrom + 1) << " to " << dbFrom + dbSize << "\n";
     Debug::Progress progress(querySize);
 
-#pragma omp parallel num_threads(localThreads)
+    // with NUMA placement every node works on its own contiguous part of the queries first
+    NumaWorkQueue queue(queryFrom, queryFrom + querySize, prefilterBatchSize, localThreads);
+    std::vector<size_t> queriesPerNode(numa ? Numa::getNodeCount() : 1, 0);
+    Timer timer;
+
+#pragma omp parallel num_threads(localThreads) reduction (+: kmersPerPos, kmerThrSum, resSize, dbMatches, doubleMatches, querySeqLenSum, diagonalOverflow, trancatedCounter, alignmentsNum, totalPassedNum)
     {
         unsigned int thread_idx = 0;
 #ifdef OPENMP
         thread_idx = static_cast<unsigned int>(omp_get_thread_num());
 #endif
-        Sequence seq(qdbr->getMaxSeqLen(), querySeqType, kmerSubMat, kmerSize, spacedKmer, aaBiasCorrection, true, spacedKmerPattern);
+        int node = 0;
+        if (numa) {
+            node = Numa::pinThread(thread_idx, localThreads);
+        }
+        size_t nodeQueries = 0;
+        Sequence **seqs = new Sequence*[prefilterBatchSize];
+        for (size_t i = 0; i < prefilterBatchSize; i++) {
+            seqs[i] = new Sequence(qdbr->getMaxSeqLen(), querySeqType, kmerSubMat, kmerSize, spacedKmer, aaBiasCorrection, true, spacedKmerPattern);
+        }
         QueryMatcher matcher(indexTable, sequenceLookup, kmerSubMat,  ungappedSubMat,
                              kmerThr, kmerSize, dbSize, std::max(tdbr->getMaxSeqLen(),qdbr->getMaxSeqLen()), maxResListLen, aaBiasCorrection,
                              diagonalScoring, minDiagScoreThr, takeOnlyBestKmer, targetSeqType==Parameters::DBTYPE_NUCLEOTIDES);
 
-        if (seq.profile_matrix != NULL) {
-            matcher.setProfileMatrix(seq.profile_matrix);
+        if (seqs[0]->profile_matrix != NULL) {
+            matcher.setProfileMatrix(seqs[0]->profile_matrix);
         } else if (_3merSubMatrix.isValid() && _2merSubMatrix.isValid()) {
             matcher.setSubstitutionMatrix(&_3merSubMatrix, &_2merSubMatrix);
         } else {
             matcher.setSubstitutionMatrix(NULL, NULL);
         }
+        matcher.setPrefetchDistance(prefetchDistance);
+        matcher.setMaxKmersPerPos(maxKmersPerPos);
+        Alignment::QueryAligner *queryAligner = NULL;
+        if (aligner != NULL) {
+            queryAligner = new Alignment::QueryAligner(*aligner, thread_idx);
+        }
 
         char buffer[128];
         std::string result;
         result.reserve(1000000);
 
-#pragma omp for schedule(dynamic, 2) reduction (+: kmersPerPos, resSize, dbMatches, doubleMatches, querySeqLenSum, diagonalOverflow, trancatedCounter)
-        for (size_t id = queryFrom; id < queryFrom + querySize; id++) {
-            progress.updateProgress();
-            // get query sequence
-            char *seqData = qdbr->getData(id, thread_idx);
-            unsigned int qKey = qdbr->getDbKey(id);
-            seq.mapSequence(id, qKey, seqData, qdbr->getSeqLen(id));
-            size_t targetSeqId = UINT_MAX;
-            if (sameQTDB || includeIdentical) {
-                targetSeqId = tdbr->getId(seq.getDbKey());
-                // only the corresponding split should include the id (hack for the hack)
-                if (targetSeqId >= dbFrom && targetSeqId < (dbFrom + dbSize) && targetSeqId != UINT_MAX) {
-                    targetSeqId = targetSeqId - dbFrom;
-                    if(targetSeqId > tdbr->getSize()){
-                        Debug(Debug::ERROR) << "targetSeqId: " << targetSeqId << " > target database size: "  << tdbr->getSize() <<  "\n";
-                        EXIT(EXIT_FAILURE);
-                    }
-                }else{
-                    targetSeqId = UINT_MAX;
-                }
+        auto matchBlock = [&](size_t blockStart, size_t blockEnd) {
+            const size_t blockSize = blockEnd - blockStart;
+            nodeQueries += blockSize;
+            for (size_t i = 0; i < blockSize; i++) {
+                // get query sequence
+                size_t id = blockStart + i;
+                char *seqData = qdbr->getData(id, thread_idx);
+                seqs[i]->mapSequence(id, qdbr->getDbKey(id), seqData, qdbr->getSeqLen(id));
             }
-            // calculate prefiltering results
-            std::pair<hit_t *, size_t> prefResults = matcher.matchQuery(&seq, targetSeqId, targetSeqType==Parameters::DBTYPE_NUCLEOTIDES);
-            size_t resultSize = prefResults.second;
-            const float queryLength = static_cast<float>(qdbr->getSeqLen(id));
-            for (size_t i = 0; i < resultSize; i++) {
-                hit_t *res = prefResults.first + i;
-                // correct the 0 indexed sequence id again to its real identifier
-                size_t targetSeqId1 = res->seqId + dbFrom;
-                // replace id with key
-                res->seqId = tdbr->getDbKey(targetSeqId1);
-                if (UNLIKELY(targetSeqId1 >= tdbr->getSize())) {
-                    Debug(Debug::WARNING) << "Wrong prefiltering result for query: " << qdbr->getDbKey(id) << " -> " << targetSeqId1 << "\t" << res->prefScore << "\n";
+            if (blockSize > 1) {
+                matcher.prepareBatch(seqs, blockSize);
+            }
+            for (size_t i = 0; i < blockSize; i++) {
+                progress.updateProgress();
+                size_t id = blockStart + i;
+                Sequence &seq = *seqs[i];
+                unsigned int qKey = seq.getDbKey();
+                size_t targetSeqId = UINT_MAX;
+                if (sameQTDB || includeIdentical) {
+                    targetSeqId = tdbr->getId(seq.getDbKey());
+                    // only the corresponding split should include the id (hack for the hack)
+                    if (targetSeqId >= dbFrom && targetSeqId < (dbFrom + dbSize) && targetSeqId != UINT_MAX) {
+                        targetSeqId = targetSeqId - dbFrom;
+                        if(targetSeqId > tdbr->getSize()){
+                            Debug(Debug::ERROR) << "targetSeqId: " << targetSeqId << " > target database size: "  << tdbr->getSize() <<  "\n";
+                            EXIT(EXIT_FAILURE);
+                        }
+                    }else{
+                        targetSeqId = UINT_MAX;
+                    }
                 }
+                // calculate prefiltering results
+                std::pair<hit_t *, size_t> prefResults = matcher.matchQuery(&seq, targetSeqId, targetSeqType==Parameters::DBTYPE_NUCLEOTIDES);
+                size_t resultSize = prefResults.second;
+                const float queryLength = static_cast<float>(qdbr->getSeqLen(id));
+                size_t alignHits = 0;
+                for (size_t j = 0; j < resultSize; j++) {
+                    hit_t *res = prefResults.first + j;
+                    // correct the 0 indexed sequence id again to its real identifier
+                    size_t targetSeqId1 = res->seqId + dbFrom;
+                    // replace id with key
+                    res->seqId = tdbr->getDbKey(targetSeqId1);
+                    if (UNLIKELY(targetSeqId1 >= tdbr->getSize())) {
+                        Debug(Debug::WARNING) << "Wrong prefiltering result for query: " << qdbr->getDbKey(id) << " -> " << targetSeqId1 << "\t" << res->prefScore << "\n";
+                    }
 
-                // TODO: check if this should happen when diagonalScoring == false
-                if (covThr > 0.0 && (covMode == Parameters::COV_MODE_BIDIRECTIONAL
-                                               || covMode == Parameters::COV_MODE_QUERY
-                                               || covMode == Parameters::COV_MODE_LENGTH_SHORTER )) {
-                    const float targetLength = static_cast<float>(tdbr->getSeqLen(targetSeqId1));
-                    if (Util::canBeCovered(covThr, covMode, queryLength, targetLength) == false) {
+                    // TODO: check if this should happen when diagonalScoring == false
+                    if (covThr > 0.0 && (covMode == Parameters::COV_MODE_BIDIRECTIONAL
+                                                   || covMode == Parameters::COV_MODE_QUERY
+                                                   || covMode == Parameters::COV_MODE_LENGTH_SHORTER )) {
+                        const float targetLength = static_cast<float>(tdbr->getSeqLen(targetSeqId1));
+                        if (Util::canBeCovered(covThr, covMode, queryLength, targetLength) == false) {
+                            continue;
+                        }
+                    }
+
+                    if (queryAligner != NULL) {
+                        // keep the hit for the alignment
+                        prefResults.first[alignHits++] = *res;
                         continue;
                     }
+
+                    // write prefiltering results to a string
+                    int len = QueryMatcher::prefilterHitToBuffer(buffer, *res);
+                    result.append(buffer, len);
                 }
+                if (queryAligner != NULL) {
+                    queryAligner->align(qKey, NULL, prefResults.first, alignHits, result);
+                }
+                tmpDbw.writeData(result.c_str(), result.length(), qKey, thread_idx);
+                result.clear();
 
-                // write prefiltering results to a string
-                int len = QueryMatcher::prefilterHitToBuffer(buffer, *res);
-                result.append(buffer, len);
-            }
-            tmpDbw.writeData(result.c_str(), result.length(), qKey, thread_idx);
-            result.clear();
+                // update statistics counters
+                if (resultSize != 0) {
+                    notEmpty[id - queryFrom] = 1;
+                }
 
-            // update statistics counters
-            if (resultSize != 0) {
-                notEmpty[id - queryFrom] = 1;
+                if (Debug::debugLevel >= Debug::INFO) {
+                    kmersPerPos += matcher.getStatistics()->kmersPerPos;
+                    kmerThrSum += matcher.getStatistics()->kmerThr;
+                    dbMatches += matcher.getStatistics()->dbMatches;
+                    doubleMatches += matcher.getStatistics()->doubleMatches;
+                    querySeqLenSum += seq.L;
+                    diagonalOverflow += matcher.getStatistics()->diagonalOverflow;
+                    trancatedCounter += matcher.getStatistics()->truncated;
+                    resSize += resultSize;
+                    realResSize += std::min(resultSize, maxResListLen);
+                    reslens[thread_idx]->emplace_back(resultSize);
+                }
             }
-
-            if (Debug::debugLevel >= Debug::INFO) {
-                kmersPerPos += matcher.getStatistics()->kmersPerPos;
-                dbMatches += matcher.getStatistics()->dbMatches;
-                doubleMatches += matcher.getStatistics()->doubleMatches;
-                querySeqLenSum += seq.L;
-                diagonalOverflow += matcher.getStatistics()->diagonalOverflow;
-                trancatedCounter += matcher.getStatistics()->truncated;
-                resSize += resultSize;
-                realResSize += std::min(resultSize, maxResListLen);
-                reslens[thread_idx]->emplace_back(resultSize);
+        };
+        if (numa) {
+            size_t blockStart, blockEnd;
+            while (queue.next(node, blockStart, blockEnd)) {
+                matchBlock(blockStart, blockEnd);
+            }
+        } else {
+            // single queries are handed out in pairs as before batching
+#pragma omp for schedule(dynamic, (prefilterBatchSize > 1) ? 1 : 2)
+            for (size_t blockStart = queryFrom; blockStart < queryFrom + querySize; blockStart += prefilterBatchSize) {
+                matchBlock(blockStart, std::min(blockStart + prefilterBatchSize, queryFrom + querySize));
             }
         } // step end
+
+        __sync_fetch_and_add(&(queriesPerNode[node]), nodeQueries);
+        if (queryAligner != NULL) {
+            alignmentsNum += queryAligner->alignmentsNum;
+            totalPassedNum += queryAligner->passedNum;
+#pragma omp critical(rejected_hits)
+            {
+                rejectedHits.add(queryAligner->rejectedHits);
+                queryAligner->addPassCounts(passCounts);
+            }
+            delete queryAligner;
+        }
+
+        for (size_t i = 0; i < prefilterBatchSize; i++) {
+            delete seqs[i];
+        }
+        delete[] seqs;
+        if (numa) {
+            Numa::unpinThread();
+        }
+    }
+    if (numa) {
+        Numa::printThroughput(queriesPerNode, timer.getTimediff(), "queries");
     }
 
     if (Debug::debugLevel >= Debug::INFO) {
@@ -872,7 +997,8 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
                            dbMatches / totalQueryDBSize,
                            doubleMatches / totalQueryDBSize,
                            querySeqLenSum, diagonalOverflow,
-                           resSize / totalQueryDBSize, trancatedCounter);
+                           resSize / totalQueryDBSize, trancatedCounter,
+                           kmerThrSum / static_cast<double>(totalQueryDBSize));
 
         size_t empty = 0;
         for (size_t id = 0; id < querySize; id++) {
@@ -882,6 +1008,9 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
         }
 
         printStatistics(stats, reslens, localThreads, empty, maxResListLen);
+        if (aligner != NULL) {
+            Alignment::printStatistics(alignmentsNum, totalPassedNum, querySize, rejectedHits, passCounts);
+        }
     }
 
     if (splitMode == Parameters::TARGET_DB_SPLIT && splits == 1) {
@@ -912,7 +1041,7 @@ bool Prefiltering::runSplit(const std::string &resultDB, const std::string &resu
         resultReader.open(DBReader<unsigned int>::NOSORT);
         resultReader.readMmapedDataInMemory();
         const std::pair<std::string, std::string> tempDb = Util::databaseNames((resultDB + "_tmp"));
-        DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), localThreads, compressed, Parameters::DBTYPE_PREFILTER_RES);
+        DBWriter resultWriter(tempDb.first.c_str(), tempDb.second.c_str(), localThreads, compressed, getOutputDbtype());
         resultWriter.open();
         resultWriter.sortDatafileByIdOrder(resultReader);
         resultWriter.close(true);
@@ -940,6 +1069,9 @@ void Prefiltering::printStatistics(const statistics_t &stats, std::list<int> **r
         reslens[0]->merge(*reslens[i]);
     }
     Debug(Debug::INFO) << "\n" << stats.kmersPerPos << " k-mers per position\n";
+    if (maxKmersPerPos > 0.0f) {
+        Debug(Debug::INFO) << stats.kmerThr << " mean k-mer similarity threshold\n";
+    }
     Debug(Debug::INFO) << stats.dbMatches << " DB matches per sequence\n";
     Debug(Debug::INFO) << stats.diagonalOverflow << " overflows\n";
     Debug(Debug::INFO) << stats.truncated << " queries produce too many hits (truncated result)\n";
@@ -977,8 +1109,11 @@ BaseMatrix *Prefiltering::getSubstitutionMatrix(const MultiParam<char*> &scoring
 
 void Prefiltering::mergePrefilterSplits(const std::string &outDB, const std::string &outDBIndex,
                               const std::vector<std::pair<std::string, std::string>> &splitFiles) {
-    if (splitMode == Parameters::TARGET_DB_SPLIT) {
+    // alignment results only come from a single target split per rank, their hits must not be re-sorted as prefilter hits
+    if (splitMode == Parameters::TARGET_DB_SPLIT && aligner == NULL) {
         mergeTargetSplits(outDB, outDBIndex, splitFiles, threads);
+    } else if (splitMode == Parameters::TARGET_DB_SPLIT) {
+        DBWriter::mergeResults(outDB, outDBIndex, splitFiles);
     } else if (splitMode == Parameters::QUERY_DB_SPLIT) {
         DBWriter::mergeResults(outDB, outDBIndex, splitFiles);
     }
@@ -1023,12 +1158,14 @@ int Prefiltering::getKmerThreshold(const float sensitivity, const bool isProfile
 size_t Prefiltering::estimateMemoryConsumption(int split, size_t dbSize, size_t resSize,
                                                size_t maxResListLen,
                                                int alphabetSize, int kmerSize, unsigned int querySeqType,
-                                               int threads) {
+                                               int threads, bool indexCompression) {
     // for each residue in the database we need 7 byte
+    // or roughly 4 byte with the compressed index table
     size_t dbSizeSplit = (dbSize) / split;
-    size_t residueSize = (resSize / split * 7);
+    size_t residueSize = (resSize / split * (indexCompression ? 4 : 7));
     // 21^7 * pointer size is needed for the index
-    size_t indexTableSize = static_cast<size_t>(pow(alphabetSize, kmerSize)) * sizeof(size_t);
+    // the compressed index table uses 32-bit offsets
+    size_t indexTableSize = static_cast<size_t>(pow(alphabetSize, kmerSize)) * (indexCompression ? sizeof(unsigned int) : sizeof(size_t));
     // memory needed for the threads
     // This memory is an approx. for Countint32Array and QueryTemplateLocalFast
     size_t threadSize = threads * (
@@ -1059,7 +1196,8 @@ size_t Prefiltering::estimateHDDMemoryConsumption(size_t dbSize, size_t maxResLi
 }
 
 std::pair<int, int> Prefiltering::optimizeSplit(size_t totalMemoryInByte, DBReader<unsigned int> *tdbr,
-                                                int alphabetSize, int externalKmerSize, unsigned int querySeqType, unsigned int threads) {
+                                                int alphabetSize, int externalKmerSize, unsigned int querySeqType, unsigned int threads,
+                                                bool indexCompression) {
 
     int startKmerSize = (externalKmerSize == 0) ? 6 : externalKmerSize;
     int endKmerSize   = (externalKmerSize == 0) ? 7 : externalKmerSize;
@@ -1083,7 +1221,7 @@ std::pair<int, int> Prefiltering::optimizeSplit(size_t totalMemoryInByte, DBRead
                 size_t neededSize = estimateMemoryConsumption(optSplit, tdbr->getSize(),
                                                               tdbr->getAminoAcidDBSize(),
                                                               0, alphabetSize, optKmerSize, querySeqType,
-                                                              threads);
+                                                              threads, indexCompression);
                 if (neededSize < 0.9 * totalMemoryInByte) {
                     return std::make_pair(optKmerSize, optSplit);
                 }
@@ -13,6 +13,8 @@
 #include <list>
 #include <utility>
 
+class Alignment;
+
 class Prefiltering {
 public:
     Prefiltering(
@@ -33,6 +35,12 @@ public:
 
     int runSplits(const std::string &resultDB, const std::string &resultDBIndex, size_t fromSplit, size_t splitProcessCount, bool merge);
 
+    // align the hits of each query right away and write alignment results instead of prefilter results
+    void setAligner(Alignment *aligner);
+
+    // prefilter results or the output type of the aligner
+    int getOutputDbtype();
+
     // merge file
     void mergePrefilterSplits(const std::string &outDb, const std::string &outDBIndex,
                     const std::vector<std::pair<std::string, std::string>> &splitFiles);
@@ -42,7 +50,7 @@ public:
 
     static void setupSplit(DBReader<unsigned int>& dbr, const int alphabetSize, const unsigned int querySeqType, const int threads,
                            const bool templateDBIsIndex, const size_t memoryLimit, const size_t qDbSize,
-                           size_t& maxResListLen, int& kmerSize, int& split, int& splitMode);
+                           size_t& maxResListLen, int& kmerSize, int& split, int& splitMode, const bool indexCompression);
 
     static int getKmerThreshold(const float sensitivity, const bool isProfile, const int kmerScore, const int kmerSize);
 
@@ -97,18 +105,24 @@ private:
     int preloadMode;
     const unsigned int threads;
     int compressed;
+    size_t prefilterBatchSize;
+    bool indexCompression;
+    unsigned int prefetchDistance;
+    float maxKmersPerPos;
+    bool numa;
+    Alignment *aligner;
 
     bool runSplit(const std::string &resultDB, const std::string &resultDBIndex, size_t split, bool merge);
 
     // compute kmer size and split size for index table
     static std::pair<int, int> optimizeSplit(size_t totalMemoryInByte, DBReader<unsigned int> *tdbr, int alphabetSize, int kmerSize,
-                                             unsigned int querySeqType, unsigned int threads);
+                                             unsigned int querySeqType, unsigned int threads, bool indexCompression);
 
     // estimates memory consumption while runtime
     static size_t estimateMemoryConsumption(int split, size_t dbSize, size_t resSize,
                                             size_t maxHitsPerQuery,
                                             int alphabetSize, int kmerSize, unsigned int querySeqType,
-                                            int threads);
+                                            int threads, bool indexCompression);
 
     static size_t estimateHDDMemoryConsumption(size_t dbSize, size_t maxResListLen);
 
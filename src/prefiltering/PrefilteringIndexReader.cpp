@@ -30,6 +30,13 @@ unsigned int PrefilteringIndexReader::HDR2INDEX = 20;
 unsigned int PrefilteringIndexReader::HDR2DATA = 21;
 unsigned int PrefilteringIndexReader::GENERATOR = 22;
 unsigned int PrefilteringIndexReader::SPACEDPATTERN = 23;
+unsigned int PrefilteringIndexReader::ENTRIESBLOCKOFFSETS = 24;
+
+std::string PrefilteringIndexReader::residentIndexName;
+std::vector<IndexTable *> PrefilteringIndexReader::residentIndexTables;
+std::vector<SequenceLookup *> PrefilteringIndexReader::residentSequenceLookups;
+ScoreMatrix PrefilteringIndexReader::resident2MerScoreMatrix;
+ScoreMatrix PrefilteringIndexReader::resident3MerScoreMatrix;
 
 extern const char* version;
 
@@ -53,7 +60,7 @@ void PrefilteringIndexReader::createIndexFile(const std::string &outDB,
                                               BaseMatrix *subMat, int maxSeqLen,
                                               bool hasSpacedKmer, const std::string &spacedKmerPattern,
                                               bool compBiasCorrection, int alphabetSize, int kmerSize,
-                                              int maskMode, int maskLowerCase, int kmerThr, int splits) {
+                                              int maskMode, int maskLowerCase, int kmerThr, int splits, int indexCompression) {
 
     const int SPLIT_META = splits > 1 ? 0 : 0;
     const int SPLIT_SEQS = splits > 1 ? 1 : 0;
@@ -74,7 +81,8 @@ void PrefilteringIndexReader::createIndexFile(const std::string &outDB,
     const int headers2 = (hdbr2 != NULL) ? 1 : 0;
     const int seqType = dbr1->getDbtype();
     const int srcSeqType = (dbr2 !=NULL) ? dbr2->getDbtype() : seqType;
-    int metadata[] = {maxSeqLen, kmerSize, biasCorr, alphabetSize, mask, spacedKmer, kmerThr, seqType, srcSeqType, headers1, headers2, splits};
+    const int compressed = (indexCompression > 0) ? 1 : 0;
+    int metadata[] = {maxSeqLen, kmerSize, biasCorr, alphabetSize, mask, spacedKmer, kmerThr, seqType, srcSeqType, headers1, headers2, splits, compressed};
     char *metadataptr = (char *) &metadata;
     writer.writeData(metadataptr, sizeof(metadata), META, SPLIT_META);
     writer.alignToPageSize(SPLIT_META);
@@ -208,6 +216,10 @@ void PrefilteringIndexReader::createIndexFile(const std::string &outDB,
                                    (maskMode == 1 || maskLowerCase == 1) ? &sequenceLookup : NULL,
                                    (maskMode == 0 ) ? &sequenceLookup : NULL,
                                    *subMat, &seq, dbr1, dbFrom, dbFrom + dbSize, kmerThr, maskMode, maskLowerCase);
+        if (compressed && indexTable.compress() == false) {
+            Debug(Debug::ERROR) << "Could not compress the index table. Please create the index with --index-compression 0\n";
+            EXIT(EXIT_FAILURE);
+        }
         indexTable.printStatistics(subMat->num2aa);
 
         if (sequenceLookup == NULL) {
@@ -218,16 +230,35 @@ void PrefilteringIndexReader::createIndexFile(const std::string &outDB,
         // save the entries
         unsigned int keyOffset = 1000 * s;
         Debug(Debug::INFO) << "Write ENTRIES (" << (keyOffset + ENTRIES) << ")\n";
-        char *entries = (char *) indexTable.getEntries();
-        size_t entriesSize = indexTable.getTableEntriesNum() * indexTable.getSizeOfEntry();
-        writer.writeData(entries, entriesSize, (keyOffset + ENTRIES), SPLIT_INDX + s);
+        if (compressed) {
+            // the padding is written too, the decoder reads past the last list
+            char *entries = (char *) indexTable.getCompressedEntries();
+            size_t entriesSize = indexTable.getCompressedEntriesSize() + IndexTable::COMPRESSED_PADDING;
+            writer.writeData(entries, entriesSize, (keyOffset + ENTRIES), SPLIT_INDX + s);
+        } else {
+            char *entries = (char *) indexTable.getEntries();
+            size_t entriesSize = indexTable.getTableEntriesNum() * indexTable.getSizeOfEntry();
+            writer.writeData(entries, entriesSize, (keyOffset + ENTRIES), SPLIT_INDX + s);
+        }
         writer.alignToPageSize(SPLIT_INDX + s);
 
         // save the size
         Debug(Debug::INFO) << "Write ENTRIESOFFSETS (" << (keyOffset + ENTRIESOFFSETS) << ")\n";
-        char *offsets = (char*)indexTable.getOffsets();
-        size_t offsetsSize = (indexTable.getTableSize() + 1) * sizeof(size_t);
-        writer.writeData(offsets, offsetsSize, (keyOffset + ENTRIESOFFSETS), SPLIT_INDX + s);
+        if (compressed) {
+            char *offsets = (char*)indexTable.getCompressedOffsets();
+            size_t offsetsSize = (indexTable.getTableSize() + 1) * sizeof(unsigned int);
+            writer.writeData(offsets, offsetsSize, (keyOffset + ENTRIESOFFSETS), SPLIT_INDX + s);
+            writer.alignToPageSize(SPLIT_INDX + s);
+
+            Debug(Debug::INFO) << "Write ENTRIESBLOCKOFFSETS (" << (keyOffset + ENTRIESBLOCKOFFSETS) << ")\n";
+            char *blockOffsets = (char*)indexTable.getBlockOffsets();
+            size_t blockOffsetsSize = indexTable.getBlockOffsetsSize() * sizeof(size_t);
+            writer.writeData(blockOffsets, blockOffsetsSize, (keyOffset + ENTRIESBLOCKOFFSETS), SPLIT_INDX + s);
+        } else {
+            char *offsets = (char*)indexTable.getOffsets();
+            size_t offsetsSize = (indexTable.getTableSize() + 1) * sizeof(size_t);
+            writer.writeData(offsets, offsetsSize, (keyOffset + ENTRIESOFFSETS), SPLIT_INDX + s);
+        }
         writer.alignToPageSize(SPLIT_INDX + s);
         indexTable.deleteEntries();
 
@@ -329,6 +360,10 @@ SequenceLookup *PrefilteringIndexReader::getSequenceLookup(unsigned int split, D
         EXIT(EXIT_FAILURE);
     }
 
+    if (isResidentIndex(dbr)) {
+        return residentSequenceLookups[split];
+    }
+
     unsigned int splitOffset = split * 1000;
 
     size_t id = dbr->getId(splitOffset + SEQINDEXDATA);
@@ -370,6 +405,10 @@ IndexTable *PrefilteringIndexReader::getIndexTable(unsigned int split, DBReader<
         EXIT(EXIT_FAILURE);
     }
 
+    if (isResidentIndex(dbr)) {
+        return residentIndexTables[split];
+    }
+
     unsigned int splitOffset = split * 1000;
     size_t entriesNumId = dbr->getId(splitOffset + ENTRIESNUM);
     int64_t entriesNum = *((int64_t *)dbr->getDataUncompressed(entriesNumId));
@@ -389,6 +428,33 @@ IndexTable *PrefilteringIndexReader::getIndexTable(unsigned int split, DBReader<
         adjustAlphabetSize = data.alphabetSize;
     }
 
+    if (data.compressed) {
+        size_t blockOffsetsDataId = dbr->getId(splitOffset + ENTRIESBLOCKOFFSETS);
+        char *blockOffsetsData = dbr->getDataUncompressed(blockOffsetsDataId);
+        // the stored entries include the padding for the decoder
+        size_t entriesSize = dbr->getEntryLen(entriesDataId) - 1 - IndexTable::COMPRESSED_PADDING;
+
+        if (preloadMode == Parameters::PRELOAD_MODE_FREAD) {
+            IndexTable* table = new IndexTable(adjustAlphabetSize, data.kmerSize, false);
+            table->initTableByExternalCompressedDataCopy(sequenceCount, entriesNum, (unsigned char *) entriesData, entriesSize,
+                                                         (unsigned int *) entriesOffsetsData, (size_t *) blockOffsetsData);
+            return table;
+        }
+
+        if (preloadMode == Parameters::PRELOAD_MODE_MMAP_TOUCH) {
+            dbr->touchData(entriesNumId);
+            dbr->touchData(sequenceCountId);
+            dbr->touchData(entriesDataId);
+            dbr->touchData(entriesOffsetsDataId);
+            dbr->touchData(blockOffsetsDataId);
+        }
+
+        IndexTable* table = new IndexTable(adjustAlphabetSize, data.kmerSize, true);
+        table->initTableByExternalCompressedData(sequenceCount, entriesNum, (unsigned char *) entriesData, entriesSize,
+                                                 (unsigned int *) entriesOffsetsData, (size_t *) blockOffsetsData);
+        return table;
+    }
+
     if (preloadMode == Parameters::PRELOAD_MODE_FREAD) {
         IndexTable* table = new IndexTable(adjustAlphabetSize, data.kmerSize, false);
         table->initTableByExternalDataCopy(sequenceCount, entriesNum, (IndexEntryLocal*) entriesData, (size_t *)entriesOffsetsData);
@@ -445,6 +511,7 @@ void PrefilteringIndexReader::printMeta(int *metadata_tmp) {
     Debug(Debug::INFO) << "Headers2:     " << metadata_tmp[10] << "\n";
     // Keep compatible to index version 15
     Debug(Debug::INFO) << "Splits:       " << (metadata_tmp[11] == 0 ? 1 : metadata_tmp[11]) << "\n";
+    Debug(Debug::INFO) << "Compressed:   " << metadata_tmp[12] << "\n";
 }
 
 PrefilteringIndexData PrefilteringIndexReader::getMetadata(DBReader<unsigned int> *dbr) {
@@ -464,6 +531,8 @@ PrefilteringIndexData PrefilteringIndexReader::getMetadata(DBReader<unsigned int
     data.headers2 = meta[10];
     // Keep compatible to index version 15, where meta[11] would have been zero due to the alignment padding
     data.splits = meta[11] == 0 ? 1 : meta[11];
+    // older indices have no compressed layout, meta[12] is zero due to the alignment padding
+    data.compressed = meta[12];
 
     return data;
 }
@@ -506,6 +575,10 @@ std::string PrefilteringIndexReader::getSpacedPattern(DBReader<unsigned int> *db
 }
 
 ScoreMatrix PrefilteringIndexReader::get2MerScoreMatrix(DBReader<unsigned int> *dbr, int preloadMode) {
+    if (isResidentIndex(dbr)) {
+        return resident2MerScoreMatrix;
+    }
+
     size_t id = dbr->getId(SCOREMATRIX2MER);
     if (id == UINT_MAX) {
         return ScoreMatrix();
@@ -526,6 +599,10 @@ ScoreMatrix PrefilteringIndexReader::get2MerScoreMatrix(DBReader<unsigned int> *
 }
 
 ScoreMatrix PrefilteringIndexReader::get3MerScoreMatrix(DBReader<unsigned int> *dbr, int preloadMode) {
+    if (isResidentIndex(dbr)) {
+        return resident3MerScoreMatrix;
+    }
+
     size_t id = dbr->getId(SCOREMATRIX3MER);
     if (id == UINT_MAX) {
         return ScoreMatrix();
@@ -545,6 +622,24 @@ ScoreMatrix PrefilteringIndexReader::get3MerScoreMatrix(DBReader<unsigned int> *
     return ScoreMatrix::unserialize(data, meta.alphabetSize-1, 3);
 }
 
+void PrefilteringIndexReader::loadResidentIndex(DBReader<unsigned int> *dbr) {
+    PrefilteringIndexData data = getMetadata(dbr);
+    for (int split = 0; split < data.splits; split++) {
+        residentIndexTables.push_back(getIndexTable(split, dbr, Parameters::PRELOAD_MODE_FREAD));
+        residentSequenceLookups.push_back(getSequenceLookup(split, dbr, Parameters::PRELOAD_MODE_FREAD));
+    }
+    resident2MerScoreMatrix = get2MerScoreMatrix(dbr, Parameters::PRELOAD_MODE_FREAD);
+    resident3MerScoreMatrix = get3MerScoreMatrix(dbr, Parameters::PRELOAD_MODE_FREAD);
+    residentIndexName = FileUtil::getRealPathFromSymLink(dbr->getDataFileName());
+}
+
+bool PrefilteringIndexReader::isResidentIndex(DBReader<unsigned int> *dbr) {
+    if (residentIndexName.empty()) {
+        return false;
+    }
+    return FileUtil::getRealPathFromSymLink(dbr->getDataFileName()) == residentIndexName;
+}
+
 std::string PrefilteringIndexReader::searchForIndex(const std::string &pathToDB) {
     std::string outIndexName = pathToDB + ".idx";
     if (FileUtil::fileExists((outIndexName + ".dbtype").c_str()) == true) {
@@ -5,6 +5,7 @@
 #include "IndexTable.h"
 #include "DBReader.h"
 #include <string>
+#include <vector>
 
 struct PrefilteringIndexData {
     int maxSeqLength;
@@ -19,6 +20,7 @@ struct PrefilteringIndexData {
     int headers1;
     int headers2;
     int splits;
+    int compressed;
 };
 
 
@@ -49,6 +51,7 @@ public:
     static unsigned int HDR2DATA;
     static unsigned int GENERATOR;
     static unsigned int SPACEDPATTERN;
+    static unsigned int ENTRIESBLOCKOFFSETS;
 
     static bool checkIfIndexFile(DBReader<unsigned int> *reader);
     static std::string indexName(const std::string &outDB);
@@ -57,7 +60,7 @@ public:
                                 DBReader<unsigned int> *dbr1, DBReader<unsigned int> *dbr2,
                                 DBReader<unsigned int> *hdbr1, DBReader<unsigned int> *hdbr2,
                                 BaseMatrix *seedSubMat, int maxSeqLen, bool spacedKmer, const std::string &spacedKmerPattern,
-                                bool compBiasCorrection, int alphabetSize, int kmerSize, int maskMode, int maskLowerCase, int kmerThr, int splits);
+                                bool compBiasCorrection, int alphabetSize, int kmerSize, int maskMode, int maskLowerCase, int kmerThr, int splits, int indexCompression);
 
     static DBReader<unsigned int> *openNewHeaderReader(DBReader<unsigned int>*dbr, unsigned int dataIdx, unsigned int indexIdx, int threads, bool touchIndex, bool touchData);
 
@@ -85,8 +88,20 @@ public:
 
     static std::string dbPathWithoutIndex(std::string &dbname);
 
+    // load all splits of an index into memory, later readers of the same index get the resident tables
+    // used by the prefilter server, whose forked workers share the loaded tables
+    static void loadResidentIndex(DBReader<unsigned int> *dbr);
+
+    static bool isResidentIndex(DBReader<unsigned int> *dbr);
+
 private:
     static void printMeta(int *meta);
+
+    static std::string residentIndexName;
+    static std::vector<IndexTable *> residentIndexTables;
+    static std::vector<SequenceLookup *> residentSequenceLookups;
+    static ScoreMatrix resident2MerScoreMatrix;
+    static ScoreMatrix resident3MerScoreMatrix;
 };
 
 #endif
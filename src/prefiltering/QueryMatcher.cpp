@@ -2,6 +2,9 @@
 #include "QueryMatcher.h"
 #include "FastSort.h"
 #include "Util.h"
+#include "Timer.h"
+
+#include <cfloat>
 
 #define FE_1(WHAT, X) WHAT(X)
 #define FE_2(WHAT, X, ...) WHAT(X)FE_1(WHAT, __VA_ARGS__)
@@ -31,6 +34,8 @@ QueryMatcher::QueryMatcher(IndexTable *indexTable, SequenceLookup *sequenceLooku
     this->indexTable = indexTable;
     this->kmerSize = kmerSize;
     this->kmerThr = kmerThr;
+    this->maxKmersPerPos = 0.0f;
+    this->queryKmerThr = kmerThr;
     this->kmerGenerator = new KmerGenerator(kmerSize, indexTable->getAlphabetSize(), kmerThr);
     this->aaBiasCorrection = aaBiasCorrection;
     this->takeOnlyBestKmer = takeOnlyBestKmer;
@@ -64,6 +69,10 @@ QueryMatcher::QueryMatcher(IndexTable *indexTable, SequenceLookup *sequenceLooku
         ungappedAlignment = new UngappedAlignment(maxSeqLen, ungappedAlignmentSubMat, sequenceLookup);
     }
     compositionBias = new float[maxSeqLen];
+    batchSeqs = NULL;
+    batchAccepted = 0;
+    batchCurrent = 0;
+    setPrefetchDistance(0);
 }
 
 QueryMatcher::~QueryMatcher(){
@@ -86,18 +95,24 @@ std::pair<hit_t*, size_t> QueryMatcher::matchQuery(Sequence *querySeq, unsigned
 //    std::cout << "Id: " << querySeq->getId() << std::endl;
     memset(scoreSizes, 0, SCORE_RANGE * sizeof(unsigned int));
 
-    // bias correction
-    if(aaBiasCorrection == true){
-        if(Parameters::isEqualDbtype(querySeq->getSeqType(), Parameters::DBTYPE_AMINO_ACIDS)) {
-            SubstitutionMatrix::calcLocalAaBiasCorrection(kmerSubMat, querySeq->numSequence, querySeq->L, compositionBias);
-        }else{
-            memset(compositionBias, 0, sizeof(float) * querySeq->L);
-        }
+    computeCompositionBias(querySeq);
+
+    size_t resultSize;
+    if (batchCurrent < batchAccepted && batchSeqs[batchCurrent] == querySeq) {
+        resultSize = matchBatched(querySeq, batchCurrent);
+        batchCurrent++;
     } else {
-        memset(compositionBias, 0, sizeof(float) * querySeq->L);
+        // match overwrites databaseHits, the remaining batch is invalid
+        batchAccepted = 0;
+        queryKmerThr = computeKmerThreshold(querySeq);
+        if (prefetchTuning) {
+            Timer timer;
+            resultSize = match(querySeq, compositionBias);
+            updatePrefetchTuning(timer.getTimediff(), stats->dbMatches + static_cast<size_t>(stats->kmersPerPos * stats->querySeqLen));
+        } else {
+            resultSize = match(querySeq, compositionBias);
+        }
     }
-
-    size_t resultSize = match(querySeq, compositionBias);
     std::pair<hit_t *, size_t> queryResult;
     if (diagonalScoring) {
         // write diagonal scores in count value
@@ -222,7 +237,7 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
         }
         // round bias to next higher or lower value
         short bias = static_cast<short>((biasCorrection < 0.0) ? biasCorrection - 0.5: biasCorrection + 0.5);
-        short kmerMatchScore = std::max(kmerThr - bias, 0);
+        short kmerMatchScore = std::max(queryKmerThr - bias, 0);
 
         // adjust kmer threshold based on composition bias
         kmerGenerator->setThreshold(kmerMatchScore);
@@ -247,8 +262,23 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
         //std::cout << "\t" << kmerMatchScore << std::endl;
         kmerListLen += kmerElementSize;
 
+        // the offsets are prefetched two distances ahead, so the lists can be prefetched one distance ahead
+        const size_t prefetchOffsetDistance = 2 * static_cast<size_t>(prefetchDistance);
+        if (prefetchDistance > 0) {
+            for (size_t kmerPos = 0; kmerPos < std::min(prefetchOffsetDistance, kmerElementSize); kmerPos++) {
+                indexTable->prefetchOffset(index[kmerPos]);
+            }
+        }
         for (unsigned int kmerPos = 0; kmerPos < kmerElementSize; kmerPos++) {
-            const IndexEntryLocal *entries = indexTable->getDBSeqList(index[kmerPos], &seqListSize);
+            if (prefetchDistance > 0) {
+                if (kmerPos + prefetchOffsetDistance < kmerElementSize) {
+                    indexTable->prefetchOffset(index[kmerPos + prefetchOffsetDistance]);
+                }
+                if (kmerPos + prefetchDistance < kmerElementSize) {
+                    indexTable->prefetchDBSeqList(index[kmerPos + prefetchDistance]);
+                }
+            }
+            seqListSize = indexTable->getDBSeqListSize(index[kmerPos]);
             // DEBUG
             //std::cout << seq->getDbKey() << std::endl;
             //idx.printKmer(index[kmerPos], kmerSize, kmerSubMat->num2aa);
@@ -287,7 +317,7 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
                     goto outer;
                 }
             }
-            memcpy(sequenceHits, entries, sizeof(IndexEntryLocal) * seqListSize);
+            indexTable->copyDBSeqList(index[kmerPos], sequenceHits);
             sequenceHits += seqListSize;
             numMatches += seqListSize;
         }
@@ -311,6 +341,228 @@ size_t QueryMatcher::match(Sequence *seq, float *compositionBias) {
     stats->kmersPerPos = ((double)kmerListLen/(double)seq->L);
     stats->querySeqLen = seq->L;
     stats->dbMatches   = overflowNumMatches + numMatches;
+    stats->kmerThr     = queryKmerThr;
+
+    return hitCount;
+}
+
+static const unsigned int prefetchCandidates[] = {0, 2, 4, 8, 16};
+
+void QueryMatcher::setPrefetchDistance(unsigned int distance) {
+    prefetchDistance = distance;
+    prefetchTuning = (distance == 0);
+    prefetchTuningQueries = 0;
+    memset(prefetchTuningTime, 0, sizeof(prefetchTuningTime));
+    memset(prefetchTuningWork, 0, sizeof(prefetchTuningWork));
+    if (prefetchTuning) {
+        prefetchDistance = prefetchCandidates[0];
+    }
+}
+
+void QueryMatcher::updatePrefetchTuning(double time, size_t work) {
+    const size_t candidate = (prefetchTuningQueries / PREFETCH_TUNING_QUERIES) % PREFETCH_CANDIDATES;
+    prefetchTuningTime[candidate] += time;
+    prefetchTuningWork[candidate] += work;
+    prefetchTuningQueries++;
+    if (prefetchTuningQueries < PREFETCH_CANDIDATES * PREFETCH_TUNING_QUERIES * PREFETCH_TUNING_ROUNDS) {
+        prefetchDistance = prefetchCandidates[(prefetchTuningQueries / PREFETCH_TUNING_QUERIES) % PREFETCH_CANDIDATES];
+        return;
+    }
+    // keep the distance with the lowest time per matched k-mer
+    size_t best = 0;
+    double bestTime = DBL_MAX;
+    for (size_t i = 0; i < PREFETCH_CANDIDATES; i++) {
+        const double timePerWork = prefetchTuningTime[i] / std::max(prefetchTuningWork[i], static_cast<size_t>(1));
+        if (timePerWork < bestTime) {
+            bestTime = timePerWork;
+            best = i;
+        }
+    }
+    prefetchDistance = prefetchCandidates[best];
+    prefetchTuning = false;
+}
+
+void QueryMatcher::computeCompositionBias(Sequence *querySeq) {
+    if(aaBiasCorrection == true){
+        if(Parameters::isEqualDbtype(querySeq->getSeqType(), Parameters::DBTYPE_AMINO_ACIDS)) {
+            SubstitutionMatrix::calcLocalAaBiasCorrection(kmerSubMat, querySeq->numSequence, querySeq->L, compositionBias);
+        }else{
+            memset(compositionBias, 0, sizeof(float) * querySeq->L);
+        }
+    } else {
+        memset(compositionBias, 0, sizeof(float) * querySeq->L);
+    }
+}
+
+short QueryMatcher::computeKmerThreshold(Sequence *seq) {
+    if (maxKmersPerPos <= 0.0f || takeOnlyBestKmer) {
+        return kmerThr;
+    }
+    const size_t limit = static_cast<size_t>(maxKmersPerPos * seq->L);
+    if (countSimilarKmers(seq, kmerThr, limit) <= limit) {
+        return kmerThr;
+    }
+    // double the step until the budget is met, then bisect between the last two thresholds
+    short over = kmerThr;
+    short step = 1;
+    short fits = kmerThr + step;
+    while (countSimilarKmers(seq, fits, limit) > limit) {
+        over = fits;
+        step *= 2;
+        fits = over + step;
+    }
+    while (fits - over > 1) {
+        const short mid = over + (fits - over) / 2;
+        if (countSimilarKmers(seq, mid, limit) <= limit) {
+            fits = mid;
+        } else {
+            over = mid;
+        }
+    }
+    return fits;
+}
+
+size_t QueryMatcher::countSimilarKmers(Sequence *seq, short threshold, size_t limit) {
+    size_t kmerCount = 0;
+    seq->resetCurrPos();
+    while (seq->hasNextKmer() && kmerCount <= limit) {
+        const unsigned char *kmer = seq->nextKmer();
+        const unsigned char *pos = seq->getAAPosInSpacedPattern();
+        const unsigned short current_i = seq->getCurrentPosition();
+        if (seq->kmerContainsX()) {
+            continue;
+        }
+        float biasCorrection = 0;
+        for (int i = 0; i < kmerSize; i++){
+            biasCorrection += compositionBias[current_i + static_cast<short>(pos[i])];
+        }
+        short bias = static_cast<short>((biasCorrection < 0.0) ? biasCorrection - 0.5: biasCorrection + 0.5);
+        kmerGenerator->setThreshold(std::max(threshold - bias, 0));
+        kmerCount += kmerGenerator->generateKmerList(kmer).second;
+    }
+    seq->resetCurrPos();
+    return kmerCount;
+}
+
+void QueryMatcher::prepareBatch(Sequence **querySeqs, size_t querySeqCount) {
+    batchSeqs = querySeqs;
+    batchAccepted = 0;
+    batchCurrent = 0;
+    batchKmers.clear();
+    batchPosRecord.clear();
+    batchQueryPos.clear();
+    batchKmerListLen.clear();
+    batchKmerThr.clear();
+
+    // records are numbered in the order match would copy the lists into databaseHits
+    size_t record = 0;
+    for (size_t query = 0; query < querySeqCount; query++) {
+        Sequence *seq = querySeqs[query];
+        seq->resetCurrPos();
+        computeCompositionBias(seq);
+        const short seqKmerThr = computeKmerThreshold(seq);
+        batchKmerThr.emplace_back(seqKmerThr);
+        batchQueryPos.emplace_back(batchPosRecord.size());
+        size_t kmerListLen = 0;
+        while (seq->hasNextKmer()) {
+            const unsigned char *kmer = seq->nextKmer();
+            const unsigned char *pos = seq->getAAPosInSpacedPattern();
+            const unsigned short current_i = seq->getCurrentPosition();
+            batchPosRecord.emplace_back(record);
+
+            float biasCorrection = 0;
+            for (int i = 0; i < kmerSize; i++){
+                biasCorrection += compositionBias[current_i + static_cast<short>(pos[i])];
+            }
+            if (seq->kmerContainsX()) {
+                continue;
+            }
+            short bias = static_cast<short>((biasCorrection < 0.0) ? biasCorrection - 0.5: biasCorrection + 0.5);
+            short kmerMatchScore = std::max(seqKmerThr - bias, 0);
+            kmerGenerator->setThreshold(kmerMatchScore);
+
+            if (takeOnlyBestKmer) {
+                BatchKmer batchKmer = { static_cast<unsigned int>(idx.int2index(kmer)), static_cast<unsigned int>(query), record };
+                batchKmers.emplace_back(batchKmer);
+                record++;
+                kmerListLen++;
+            } else {
+                std::pair<size_t*, size_t> kmerList = kmerGenerator->generateKmerList(kmer);
+                for (size_t i = 0; i < kmerList.second; i++) {
+                    BatchKmer batchKmer = { static_cast<unsigned int>(kmerList.first[i]), static_cast<unsigned int>(query), record };
+                    batchKmers.emplace_back(batchKmer);
+                    record++;
+                }
+                kmerListLen += kmerList.second;
+            }
+        }
+        // end of the last position
+        batchPosRecord.emplace_back(record);
+        batchKmerListLen.emplace_back(kmerListLen);
+    }
+    batchQueryPos.emplace_back(batchPosRecord.size());
+
+    // visit the index table in k-mer order, so each list is read once for all queries
+    SORT_SERIAL(batchKmers.begin(), batchKmers.end(), BatchKmer::compareByKmer);
+    batchRecordOffset.resize(record + 1);
+    for (size_t i = 0; i < batchKmers.size(); i++) {
+        batchRecordOffset[batchKmers[i].record] = indexTable->getDBSeqListSize(batchKmers[i].kmer);
+    }
+
+    // accept queries as long as their hits fit into databaseHits,
+    // the remaining queries are matched one by one
+    size_t offset = 0;
+    size_t acceptedRecords = 0;
+    for (size_t query = 0; query < querySeqCount; query++) {
+        const size_t recordStart = batchPosRecord[batchQueryPos[query]];
+        const size_t recordEnd = batchPosRecord[batchQueryPos[query + 1] - 1];
+        size_t querySize = 0;
+        for (size_t i = recordStart; i < recordEnd; i++) {
+            querySize += batchRecordOffset[i];
+        }
+        if ((databaseHits + offset + querySize) >= lastSequenceHit) {
+            break;
+        }
+        for (size_t i = recordStart; i < recordEnd; i++) {
+            const size_t seqListSize = batchRecordOffset[i];
+            batchRecordOffset[i] = offset;
+            offset += seqListSize;
+        }
+        acceptedRecords = recordEnd;
+        batchAccepted++;
+    }
+    batchRecordOffset[acceptedRecords] = offset;
+
+    for (size_t i = 0; i < batchKmers.size(); i++) {
+        const BatchKmer &batchKmer = batchKmers[i];
+        if (batchKmer.query >= batchAccepted) {
+            continue;
+        }
+        indexTable->copyDBSeqList(batchKmer.kmer, databaseHits + batchRecordOffset[batchKmer.record]);
+    }
+}
+
+size_t QueryMatcher::matchBatched(Sequence *seq, size_t batchIdx) {
+    const size_t posStart = batchQueryPos[batchIdx];
+    const size_t posCount = batchQueryPos[batchIdx + 1] - posStart - 1;
+    for (size_t i = 0; i <= posCount; i++) {
+        indexPointer[i] = databaseHits + batchRecordOffset[batchPosRecord[posStart + i]];
+    }
+    const unsigned short indexTo = (posCount == 0) ? 0 : static_cast<unsigned short>(posCount - 1);
+    indexPointer[indexTo + 1] = databaseHits + batchRecordOffset[batchPosRecord[posStart + posCount]];
+
+    stats->diagonalOverflow = false;
+    size_t hitCount = findDuplicates(indexPointer, foundDiagonals, foundDiagonalsSize, 0, indexTo, (diagonalScoring == false));
+    stats->doubleMatches = 0;
+    if (diagonalScoring == false) {
+        // remove double entries
+        updateScoreBins(foundDiagonals, hitCount);
+        stats->doubleMatches = getDoubleDiagonalMatches();
+    }
+    stats->kmersPerPos = ((double)batchKmerListLen[batchIdx]/(double)seq->L);
+    stats->querySeqLen = seq->L;
+    stats->dbMatches   = indexPointer[indexTo + 1] - indexPointer[0];
+    stats->kmerThr     = batchKmerThr[batchIdx];
 
     return hitCount;
 }
@@ -6,6 +6,7 @@
 #define MMSEQS_QUERYTEMPLATEMATCHEREXACTMATCH_H
 
 #include <cstdlib>
+#include <vector>
 #include "itoa.h"
 #include "EvalueComputation.h"
 #include "CacheFriendlyOperations.h"
@@ -21,15 +22,18 @@ struct statistics_t{
     size_t diagonalOverflow;
     size_t resultsPassedPrefPerSeq;
     size_t truncated;
-    statistics_t() : kmersPerPos(0.0) , dbMatches(0) , doubleMatches(0), querySeqLen(0), diagonalOverflow(0), resultsPassedPrefPerSeq(0), truncated(0) {};
+    // k-mer similarity threshold used for the query (mean over all queries in the summary)
+    double kmerThr;
+    statistics_t() : kmersPerPos(0.0) , dbMatches(0) , doubleMatches(0), querySeqLen(0), diagonalOverflow(0), resultsPassedPrefPerSeq(0), truncated(0), kmerThr(0.0) {};
     statistics_t(double kmersPerPos, size_t dbMatches,
-                 size_t doubleMatches, size_t querySeqLen, size_t diagonalOverflow, size_t resultsPassedPrefPerSeq, size_t truncated) : kmersPerPos(kmersPerPos),
+                 size_t doubleMatches, size_t querySeqLen, size_t diagonalOverflow, size_t resultsPassedPrefPerSeq, size_t truncated, double kmerThr) : kmersPerPos(kmersPerPos),
                                                                                                                       dbMatches(dbMatches),
                                                                                                                       doubleMatches(doubleMatches),
                                                                                                                       querySeqLen(querySeqLen),
                                                                                                                       diagonalOverflow(diagonalOverflow),
                                                                                                                       resultsPassedPrefPerSeq(resultsPassedPrefPerSeq),
-                                                                                                                      truncated(truncated){};
+                                                                                                                      truncated(truncated),
+                                                                                                                      kmerThr(kmerThr){};
 };
 
 struct hit_t {
@@ -63,6 +67,19 @@ public:
     // identityId is the id of the identitical sequence in the target database if there is any, UINT_MAX otherwise
     std::pair<hit_t*, size_t> matchQuery(Sequence *querySeq, unsigned int identityId,  bool isNucleotide);
 
+    // generates the similar k-mer lists of a block of queries and reads every index table list
+    // once for the whole block in k-mer order. The following matchQuery calls for these queries
+    // (in the same order) use the collected hits instead of accessing the index table again.
+    void prepareBatch(Sequence **querySeqs, size_t querySeqCount);
+
+    // prefetch index table lists this many generated k-mers ahead, 0: tune the distance on the first queries
+    void setPrefetchDistance(unsigned int distance);
+
+    // raise the k-mer threshold of a query until at most this many similar k-mers per residue are generated, 0: off
+    void setMaxKmersPerPos(float maxKmersPerPos) {
+        this->maxKmersPerPos = maxKmersPerPos;
+    }
+
     // set substituion matrix for KmerGenerator
     void setProfileMatrix(ScoreMatrix **matrix){
         kmerGenerator->setDivideStrategy(matrix);
@@ -147,6 +164,10 @@ protected:
     bool takeOnlyBestKmer;
     // kmer threshold for kmer generator
     short kmerThr;
+    // similar k-mer budget per query residue, 0: always use kmerThr
+    float maxKmersPerPos;
+    // kmer threshold of the current query
+    short queryKmerThr;
 
     unsigned int maxDbMatches;
     unsigned int dbSize;
@@ -211,6 +232,62 @@ protected:
     // match sequence against the IndexTable
     size_t match(Sequence *seq, float *compositionBias);
 
+    // compute local amino acid bias correction for the query
+    void computeCompositionBias(Sequence *querySeq);
+
+    // smallest threshold >= kmerThr at which the query generates at most maxKmersPerPos similar k-mers per residue
+    short computeKmerThreshold(Sequence *seq);
+
+    // counts the similar k-mers of the query at the given threshold, stops counting above limit
+    size_t countSimilarKmers(Sequence *seq, short threshold, size_t limit);
+
+    // find diagonals of a query using the hits collected by prepareBatch
+    size_t matchBatched(Sequence *seq, size_t batchIdx);
+
+    struct BatchKmer {
+        unsigned int kmer;
+        unsigned int query;
+        size_t record;
+
+        static bool compareByKmer(const BatchKmer &first, const BatchKmer &second) {
+            if (first.kmer < second.kmer)
+                return true;
+            if (second.kmer < first.kmer)
+                return false;
+            if (first.record < second.record)
+                return true;
+            return false;
+        }
+    };
+
+    // similar k-mers of all queries in the current batch
+    std::vector<BatchKmer> batchKmers;
+    // list size and afterwards start of each k-mer record in databaseHits
+    std::vector<size_t> batchRecordOffset;
+    // first k-mer record of each query position
+    std::vector<size_t> batchPosRecord;
+    // first entry in batchPosRecord of each query
+    std::vector<size_t> batchQueryPos;
+    std::vector<size_t> batchKmerListLen;
+    std::vector<short> batchKmerThr;
+    Sequence **batchSeqs;
+    // queries whose hits fit into databaseHits
+    size_t batchAccepted;
+    size_t batchCurrent;
+
+    // prefetch distance in generated k-mers, 0: no prefetching
+    unsigned int prefetchDistance;
+    // candidate distances are timed round robin on the first queries, the fastest one is kept
+    static const unsigned int PREFETCH_CANDIDATES = 5;
+    static const unsigned int PREFETCH_TUNING_QUERIES = 16;
+    static const unsigned int PREFETCH_TUNING_ROUNDS = 2;
+    bool prefetchTuning;
+    size_t prefetchTuningQueries;
+    double prefetchTuningTime[PREFETCH_CANDIDATES];
+    size_t prefetchTuningWork[PREFETCH_CANDIDATES];
+
+    void updatePrefetchTuning(double time, size_t work);
+
     // extract result from databaseHits
     template <int TYPE>
     std::pair<hit_t *, size_t> getResult(CounterResult * results,
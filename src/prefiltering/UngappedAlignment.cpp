@@ -2,17 +2,25 @@
 // Created by mad on 12/15/15.
 
 #include "UngappedAlignment.h"
+#include "Util.h"
+
+// the wider kernels are compiled for their target only and selected at runtime
+#if defined(SIMDE_X86_SSE4_1_NATIVE) && (defined(__GNUC__) || defined(__clang__))
+#define UNGAPPED_DISPATCH
+#include <immintrin.h>
+#endif
 
 UngappedAlignment::UngappedAlignment(const unsigned int maxSeqLen,
                                      BaseMatrix *substitutionMatrix, SequenceLookup *sequenceLookup)
-        : subMatrix(substitutionMatrix), sequenceLookup(sequenceLookup) {
-    score_arr = new unsigned int[VECSIZE_INT*4];
+        : laneCount(detectLaneCount()), subMatrix(substitutionMatrix), sequenceLookup(sequenceLookup) {
+    score_arr = new unsigned int[MAX_LANES];
+    laneScores = (unsigned char *) mem_align(MAX_ALIGN_INT, MAX_LANES);
     diagonalCounter = new unsigned char[DIAGONALCOUNT];
-    vectorSequence = (unsigned char *) malloc_simd_int(VECSIZE_INT * 4 * maxSeqLen);
+    vectorSequence = (unsigned char *) mem_align(MAX_ALIGN_INT, laneCount * maxSeqLen);
     queryProfile   = (char *) malloc_simd_int(PROFILESIZE * maxSeqLen);
     memset(queryProfile, 0, PROFILESIZE * maxSeqLen);
     aaCorrectionScore = (char *) malloc_simd_int(maxSeqLen);
-    diagonalMatches = new CounterResult*[DIAGONALCOUNT * (VECSIZE_INT * 4)];
+    diagonalMatches = new CounterResult*[DIAGONALCOUNT * laneCount];
 }
 
 UngappedAlignment::~UngappedAlignment() {
@@ -21,9 +29,23 @@ UngappedAlignment::~UngappedAlignment() {
     free(queryProfile);
     free(vectorSequence);
     delete [] diagonalCounter;
+    free(laneScores);
     delete [] score_arr;
 }
 
+unsigned int UngappedAlignment::detectLaneCount() {
+#ifdef UNGAPPED_DISPATCH
+    const int simdLevel = Util::getCpuSimdLevel();
+    if (simdLevel >= Util::SIMD_AVX512BW) {
+        return 64;
+    }
+    if (simdLevel >= Util::SIMD_AVX2) {
+        return 32;
+    }
+#endif
+    return VECSIZE_INT * 4;
+}
+
 void UngappedAlignment::processQuery(Sequence *seq,
                                    float *biasCorrection,
                                    CounterResult *results,
@@ -120,18 +142,90 @@ simd_int UngappedAlignment::vectorDiagonalScoring(const char *profile,
     return vMaxScore;
 }
 
+#ifdef UNGAPPED_DISPATCH
+// each profile row holds the scores of residues 0-15 in the first and 16-31 in the second 16 bytes,
+// both halves are broadcast to every 128-bit lane so a single in-lane shuffle looks up each half
+__attribute__((target("avx512bw")))
+static void diagonalScoringAvx512(const char *profile, const char bias, const unsigned int seqLen,
+                                  const unsigned char *dbSeq, unsigned char *maxScores) {
+    __m512i vscore    = _mm512_setzero_si512();
+    __m512i vMaxScore = _mm512_setzero_si512();
+    const __m512i vBias   = _mm512_set1_epi8(bias);
+    const __m512i sixteen = _mm512_set1_epi8(16);
+    for (unsigned int pos = 0; pos < seqLen; pos++) {
+        __m512i template01 = _mm512_loadu_si512((const void *) &dbSeq[pos * 64]);
+        __m512i profile01 = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128((const __m128i *) &profile[pos * 32]));
+        __m512i profile16 = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128((const __m128i *) &profile[pos * 32 + 16]));
+        __mmask64 lookupMask01 = _mm512_cmplt_epu8_mask(template01, sixteen);
+        __m512i score_vec_8bit = _mm512_mask_shuffle_epi8(_mm512_shuffle_epi8(profile16, template01),
+                                                          lookupMask01, profile01, template01);
+        vscore    = _mm512_adds_epu8(vscore, score_vec_8bit);
+        vscore    = _mm512_subs_epu8(vscore, vBias);
+        vMaxScore = _mm512_max_epu8(vMaxScore, vscore);
+    }
+    _mm512_storeu_si512((void *) maxScores, vMaxScore);
+}
+
+#ifndef AVX2
+__attribute__((target("avx2")))
+static void diagonalScoringAvx2(const char *profile, const char bias, const unsigned int seqLen,
+                                const unsigned char *dbSeq, unsigned char *maxScores) {
+    __m256i vscore    = _mm256_setzero_si256();
+    __m256i vMaxScore = _mm256_setzero_si256();
+    const __m256i vBias   = _mm256_set1_epi8(bias);
+    const __m256i sixteen = _mm256_set1_epi8(16);
+    for (unsigned int pos = 0; pos < seqLen; pos++) {
+        __m256i template01 = _mm256_loadu_si256((const __m256i *) &dbSeq[pos * 32]);
+        __m256i profile01 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) &profile[pos * 32]));
+        __m256i profile16 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) &profile[pos * 32 + 16]));
+        // residues are below 32, so the signed compare is safe
+        __m256i lookupMask01 = _mm256_cmpgt_epi8(sixteen, template01);
+        __m256i score_vec_8bit = _mm256_blendv_epi8(_mm256_shuffle_epi8(profile16, template01),
+                                                    _mm256_shuffle_epi8(profile01, template01), lookupMask01);
+        vscore    = _mm256_adds_epu8(vscore, score_vec_8bit);
+        vscore    = _mm256_subs_epu8(vscore, vBias);
+        vMaxScore = _mm256_max_epu8(vMaxScore, vscore);
+    }
+    _mm256_storeu_si256((__m256i *) maxScores, vMaxScore);
+}
+#endif
+#endif
+
+void UngappedAlignment::diagonalScoring(const char *profile,
+                                        const char bias,
+                                        const unsigned int seqLen,
+                                        const unsigned char *dbSeq) {
+#ifdef UNGAPPED_DISPATCH
+    if (laneCount == 64) {
+        diagonalScoringAvx512(profile, bias, seqLen, dbSeq, laneScores);
+    }
+#ifndef AVX2
+    else if (laneCount == 32) {
+        diagonalScoringAvx2(profile, bias, seqLen, dbSeq, laneScores);
+    }
+#endif
+    if (laneCount != VECSIZE_INT * 4) {
+        for (unsigned int i = 0; i < laneCount; i++) {
+            score_arr[i] = laneScores[i];
+        }
+        return;
+    }
+#endif
+    extractScores(score_arr, vectorDiagonalScoring(profile, bias, seqLen, dbSeq));
+}
+
 std::pair<unsigned char *, unsigned int> UngappedAlignment::mapSequences(std::pair<unsigned char *, unsigned int> * seqs,
                                                                        unsigned int seqCount) {
     unsigned int maxLen = 0;
     for(unsigned int seqIdx = 0; seqIdx < seqCount;  seqIdx++) {
         maxLen = std::max(seqs[seqIdx].second, maxLen);
     }
-    memset(vectorSequence, 21, maxLen * VECSIZE_INT * 4 * sizeof(unsigned char));
-    for(unsigned int seqIdx = 0; seqIdx < VECSIZE_INT*4;  seqIdx++){
+    memset(vectorSequence, 21, maxLen * laneCount * sizeof(unsigned char));
+    for(unsigned int seqIdx = 0; seqIdx < seqCount;  seqIdx++){
         const unsigned char * seq  = seqs[seqIdx].first;
         const unsigned int seqSize = seqs[seqIdx].second;
         for(unsigned int pos = 0; pos < seqSize;  pos++){
-            vectorSequence[pos * VECSIZE_INT * 4 + seqIdx] = seq[pos];
+            vectorSequence[pos * laneCount + seqIdx] = seq[pos];
         }
     }
     return std::make_pair(vectorSequence, maxLen);
@@ -157,8 +251,8 @@ void UngappedAlignment::scoreDiagonalAndUpdateHits(const char * queryProfile,
         }
         return;
     }
-    if (hitSize > (VECSIZE_INT * 4) / 16) {
-        std::pair<unsigned char *, unsigned int> seqs[VECSIZE_INT * 4];
+    if (hitSize > laneCount / 16) {
+        std::pair<unsigned char *, unsigned int> seqs[MAX_LANES];
         for (unsigned int seqIdx = 0; seqIdx < hitSize; seqIdx++) {
             std::pair<const unsigned char *, const unsigned int> tmp = sequenceLookup->getSequence(
                     hits[seqIdx]->id);
@@ -172,20 +266,15 @@ void UngappedAlignment::scoreDiagonalAndUpdateHits(const char * queryProfile,
         }
         std::pair<unsigned char *, unsigned int> seq = mapSequences(seqs, hitSize);
 
-        simd_int vMaxScore = simdi_setzero();
-
         if (diagonal >= 0 && minDistToDiagonal < queryLen) {
             unsigned int minSeqLen = std::min(seq.second, queryLen - minDistToDiagonal);
-            simd_int ret = vectorDiagonalScoring(queryProfile + (minDistToDiagonal * PROFILESIZE), bias, minSeqLen,
-                                                 seq.first);
-            vMaxScore = simdui8_max(ret, vMaxScore);
+            diagonalScoring(queryProfile + (minDistToDiagonal * PROFILESIZE), bias, minSeqLen, seq.first);
         } else if (diagonal < 0 && minDistToDiagonal < seq.second) {
             unsigned int minSeqLen = std::min(seq.second - minDistToDiagonal, queryLen);
-            simd_int ret = vectorDiagonalScoring(queryProfile, bias, minSeqLen,
-                                                 seq.first + minDistToDiagonal * VECSIZE_INT * 4);
-            vMaxScore = simdui8_max(ret, vMaxScore);
+            diagonalScoring(queryProfile, bias, minSeqLen, seq.first + minDistToDiagonal * laneCount);
+        } else {
+            memset(score_arr, 0, laneCount * sizeof(unsigned int));
         }
-        extractScores(score_arr, vMaxScore);
         // update score
         for(size_t hitIdx = 0; hitIdx < hitSize; hitIdx++){
             hits[hitIdx]->count = score_arr[hitIdx];
@@ -244,11 +333,11 @@ void UngappedAlignment::computeScores(const char *queryProfile,
 //            continue;
 //        }
         const unsigned short currDiag = results[i].diagonal;
-        diagonalMatches[currDiag * (VECSIZE_INT * 4) + diagonalCounter[currDiag]] = &results[i];
+        diagonalMatches[currDiag * laneCount + diagonalCounter[currDiag]] = &results[i];
         diagonalCounter[currDiag]++;
-        if(diagonalCounter[currDiag] >= (VECSIZE_INT * 4) ) {
+        if(diagonalCounter[currDiag] >= laneCount) {
             scoreDiagonalAndUpdateHits(queryProfile, queryLen, static_cast<short>(currDiag),
-                                       &diagonalMatches[currDiag * (VECSIZE_INT * 4)], diagonalCounter[currDiag], bias);
+                                       &diagonalMatches[currDiag * laneCount], diagonalCounter[currDiag], bias);
             diagonalCounter[currDiag] = 0;
         }
     }
@@ -256,7 +345,7 @@ void UngappedAlignment::computeScores(const char *queryProfile,
     for(size_t i = 0; i < DIAGONALCOUNT; i++){
         if(diagonalCounter[i] > 0){
             scoreDiagonalAndUpdateHits(queryProfile, queryLen, static_cast<short>(i),
-                                       &diagonalMatches[i * (VECSIZE_INT * 4)], diagonalCounter[i], bias);
+                                       &diagonalMatches[i * laneCount], diagonalCounter[i], bias);
         }
         diagonalCounter[i] = 0;
     }
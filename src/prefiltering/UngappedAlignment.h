@@ -36,6 +36,12 @@ public:
 private:
     const static unsigned int DIAGONALCOUNT = 0xFFFF + 1;
     const static unsigned int PROFILESIZE = 32;
+    // widest bin, 64 diagonals on AVX-512BW hosts
+    const static unsigned int MAX_LANES = 64;
+
+    // number of diagonals scored in parallel, selected at runtime from the CPU features
+    const unsigned int laneCount;
+    unsigned char *laneScores;
 
     unsigned int *score_arr;
     unsigned char *vectorSequence;
@@ -48,8 +54,8 @@ private:
     BaseMatrix *subMatrix;
     SequenceLookup *sequenceLookup;
 
-    // this function bins the hit_t by diagonals by distributing each hit in an array of 256 * 16(sse)/32(avx2)
-    // the function scoreDiagonalAndUpdateHits is called for each bin that reaches its maximum (16 or 32)
+    // this function bins the hit_t by diagonals by distributing each hit in an array of 256 * laneCount
+    // the function scoreDiagonalAndUpdateHits is called for each bin that reaches its maximum (16, 32 or 64)
     void computeScores(const char *queryProfile,
                        const unsigned int queryLen,
                        CounterResult * results,
@@ -65,6 +71,12 @@ private:
     simd_int vectorDiagonalScoring(const char *profile,
                                          const char bias, const unsigned int seqLen, const unsigned char *dbSeq);
 
+    // scores the diagonal of laneCount db sequences in parallel with the widest available kernel
+    // and writes the maximal score of each lane to score_arr
+    void diagonalScoring(const char *profile, const char bias, const unsigned int seqLen, const unsigned char *dbSeq);
+
+    static unsigned int detectLaneCount();
+
     std::pair<unsigned char *, unsigned int> mapSequences(std::pair<unsigned char *, unsigned int> * seqs, unsigned int seqCount);
 
     // calles vectorDiagonalScoring or scalarDiagonalScoring depending on the hitSize
@@ -5,6 +5,7 @@
 //  Copyright (c) 2012 -. All rights reserved.
 //
 #include <iostream>
+#include <climits>
 #include "Sequence.h"
 #include "Indexer.h"
 #include "ExtendedSubstitutionMatrix.h"
@@ -16,6 +17,8 @@
 #include "StripedSmithWaterman.h"
 #include "Util.h"
 #include "Parameters.h"
+#include "EvalueComputation.h"
+#include "Matcher.h"
 
 const char* binary_name = "test_alignmenttraceback";
 
@@ -133,6 +136,34 @@ void sw(
 
 }
 
+// score of the alignment described by the cigar, a gap of length k costs gap_open + (k - 1) * gap_extend
+int cigarScore(const s_align &alignment, const unsigned char *query, const unsigned char *target,
+               SubstitutionMatrix &subMat, int gap_open, int gap_extend) {
+    int score = 0;
+    int32_t queryPos = alignment.qStartPos1;
+    int32_t targetPos = alignment.dbStartPos1;
+    for (int32_t c = 0; c < alignment.cigarLen; ++c) {
+        char letter = SmithWaterman::cigar_int_to_op(alignment.cigar[c]);
+        uint32_t length = SmithWaterman::cigar_int_to_len(alignment.cigar[c]);
+        if (letter == 'M') {
+            for (uint32_t i = 0; i < length; ++i) {
+                score += subMat.subMatrix[query[queryPos++]][target[targetPos++]];
+            }
+        } else {
+            score -= gap_open + (length - 1) * gap_extend;
+            if (letter == 'I') {
+                queryPos += length;
+            } else {
+                targetPos += length;
+            }
+        }
+    }
+    if (queryPos != alignment.qEndPos1 + 1 || targetPos != alignment.dbEndPos1 + 1) {
+        return INT_MIN;
+    }
+    return score;
+}
+
 int main(int, const char**) {
     const size_t kmer_size=6;
 
@@ -187,10 +218,53 @@ int main(int, const char**) {
     sw(dbSeq->numSequence, s->numSequence, (const short ** ) profile, 92, 157, 80, 146, 11, 1, subMat);
     // calcuate stop score
 
+    // a threshold of 0 forces the linear memory traceback, both tracebacks have to reach the score of the forward pass
+    const int gap_open = 11;
+    const int gap_extend = 1;
+    EvalueComputation evalueComputation(100000, &subMat, gap_open, gap_extend);
+    aligner.ssw_init(s, tinySubMat, &subMat, 2);
+    s_align banded = aligner.ssw_align(dbSeq->numSequence, dbSeq->L, gap_open, gap_extend, 3, 10000, &evalueComputation, 0, 0.0, s->L / 2);
+    aligner.setMaxBandedTracebackSize(0);
+    s_align linear = aligner.ssw_align(dbSeq->numSequence, dbSeq->L, gap_open, gap_extend, 3, 10000, &evalueComputation, 0, 0.0, s->L / 2);
+    const int bandedScore = cigarScore(banded, s->numSequence, dbSeq->numSequence, subMat, gap_open, gap_extend);
+    const int linearScore = cigarScore(linear, s->numSequence, dbSeq->numSequence, subMat, gap_open, gap_extend);
+    std::string bandedCigar;
+    std::string linearCigar;
+    for (int32_t c = 0; c < banded.cigarLen; ++c) {
+        bandedCigar.append(SSTR(SmithWaterman::cigar_int_to_len(banded.cigar[c])));
+        bandedCigar.push_back(SmithWaterman::cigar_int_to_op(banded.cigar[c]));
+    }
+    for (int32_t c = 0; c < linear.cigarLen; ++c) {
+        linearCigar.append(SSTR(SmithWaterman::cigar_int_to_len(linear.cigar[c])));
+        linearCigar.push_back(SmithWaterman::cigar_int_to_op(linear.cigar[c]));
+    }
+    std::cout << "banded_sw: " << bandedScore << " " << bandedCigar << "\n";
+    std::cout << "linear_sw: " << linearScore << " " << linearCigar << "\n";
+    std::cout << "score: " << banded.score1 << "\n";
+    const bool failed = bandedScore != static_cast<int>(banded.score1) || linearScore != static_cast<int>(linear.score1) || banded.score1 != linear.score1;
+    if (failed) {
+        std::cout << "Tracebacks of banded_sw and linear_sw differ\n";
+    }
+
+    // alternating columns are the longest compressed backtrace, the result line has to fit into resultToBufferSize
+    std::string longBacktrace;
+    for (size_t i = 0; i < 200000; i++) {
+        longBacktrace.push_back((i % 2 == 0) ? 'M' : 'I');
+    }
+    const Matcher::result_t longResult(1, 100, 1.0, 1.0, 0.5, 1e-20, 200000, 0, 149999, 150000, 0, 99999, 100000, longBacktrace);
+    std::string line(Matcher::resultToBufferSize(longResult, true), '\0');
+    const size_t lineLength = Matcher::resultToBuffer(&line[0], longResult, true);
+    const bool lineFits = lineLength < line.size();
+    if (lineFits == false) {
+        std::cout << "Result line of " << lineLength << " bytes exceeds resultToBufferSize\n";
+    }
+    delete [] banded.cigar;
+    delete [] linear.cigar;
+
     delete [] tinySubMat;
 
     delete s;
     delete dbSeq;
-    return 0;
+    return (failed || lineFits == false) ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
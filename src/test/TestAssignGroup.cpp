@@ -0,0 +1,87 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cstdint>
+
+#include "kmermatcher.h"
+#include "Parameters.h"
+#include "Util.h"
+
+const char* binary_name = "test_assigngroup";
+
+typedef KmerPosition<short, false> Kmer;
+
+static Kmer makeKmer(size_t kmer, bool isReverse, unsigned int id, short pos) {
+    Kmer position;
+    // forward k-mers have the signed bit set, reverse k-mers do not
+    position.kmer = (isReverse) ? BIT_CLEAR(kmer, 63) : BIT_SET(kmer, 63);
+    position.id = id;
+    position.pos = pos;
+    return position;
+}
+
+// assigns the groups of a nucleotide split and returns the entries of the sequences 0 and 1
+static std::vector<Kmer> assignNucleotideGroups(std::vector<Kmer> kmers, const std::vector<short> &seqLens) {
+    const size_t kmerCount = kmers.size();
+    Kmer end;
+    end.kmer = SIZE_MAX;
+    end.id = UINT_MAX;
+    end.pos = 0;
+    kmers.push_back(end);
+    size_t writePos = assignGroup<Parameters::DBTYPE_NUCLEOTIDES, short>(kmers.data(), seqLens.data(), kmerCount, false, Parameters::COV_MODE_BIDIRECTIONAL, 0.0);
+    std::vector<Kmer> result;
+    for (size_t i = 0; i < writePos; i++) {
+        if (kmers[i].id <= 1) {
+            result.push_back(kmers[i]);
+        }
+    }
+    return result;
+}
+
+int main (int, const char**) {
+    std::vector<short> seqLens;
+    seqLens.push_back(100);
+    seqLens.push_back(80);
+    seqLens.push_back(50);
+    seqLens.push_back(50);
+
+    // the sequences 0 and 1 share a k-mer on the reverse strand, the longer sequence 0 is the rep. sequence
+    std::vector<Kmer> reverseGroup;
+    reverseGroup.push_back(makeKmer(12345, true, 0, 10));
+    reverseGroup.push_back(makeKmer(12345, true, 1, 20));
+
+    // the group is first in the split
+    std::vector<Kmer> first = assignNucleotideGroups(reverseGroup, seqLens);
+
+    // the same group after a forward group
+    std::vector<Kmer> kmers;
+    kmers.push_back(makeKmer(111, false, 2, 5));
+    kmers.push_back(makeKmer(111, false, 3, 7));
+    kmers.insert(kmers.end(), reverseGroup.begin(), reverseGroup.end());
+    std::vector<Kmer> later = assignNucleotideGroups(kmers, seqLens);
+
+    size_t failures = 0;
+    if (first.size() != 2 || later.size() != 2) {
+        std::cout << "Expected 2 entries, got " << first.size() << " for the first and " << later.size() << " for a later group\n";
+        failures++;
+    } else {
+        for (size_t i = 0; i < first.size(); i++) {
+            if (first[i].kmer != later[i].kmer || first[i].id != later[i].id || first[i].pos != later[i].pos) {
+                std::cout << "Sequence " << first[i].id << ": the first group gives rep. " << first[i].kmer
+                          << " diagonal " << first[i].pos << ", a later group gives rep. " << later[i].kmer
+                          << " diagonal " << later[i].pos << "\n";
+                failures++;
+            }
+        }
+        // both k-mers are reverse, so the hit is on the forward strand of the rep. sequence:
+        // the diagonal is (100 - 1 - 10) - (80 - 1 - 20) = 30
+        const Kmer &target = (first[0].id == 1) ? first[0] : first[1];
+        if (target.kmer != BIT_SET(static_cast<size_t>(0), 63) || target.pos != 30) {
+            std::cout << "Sequence 1: expected forward rep. 0 on diagonal 30, got rep. " << target.kmer
+                      << " diagonal " << target.pos << "\n";
+            failures++;
+        }
+    }
+    std::cout << "First group of a nucleotide split: " << failures << " failures\n";
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,240 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "Command.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Matcher.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_binaryalignment";
+
+extern int align(int argc, const char **argv, const Command &command);
+extern int convertalignments(int argc, const char **argv, const Command &command);
+extern int clust(int argc, const char **argv, const Command &command);
+
+static const char AMINO_ACIDS[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string mutate(const std::string &sequence, int percent) {
+    std::string mutated;
+    for (size_t i = 0; i < sequence.size(); i++) {
+        const int event = rand() % 100;
+        if (event < percent) {
+            mutated.push_back(AMINO_ACIDS[rand() % 20]);
+        } else if (event < percent + 2) {
+            mutated.push_back(AMINO_ACIDS[rand() % 20]);
+            mutated.push_back(sequence[i]);
+        } else if (event >= percent + 4) {
+            mutated.push_back(sequence[i]);
+        }
+    }
+    return mutated.empty() ? sequence : mutated;
+}
+
+static void writeSequenceDb(const std::string &name, const std::vector<std::string> &sequences) {
+    std::string index = name + ".index";
+    DBWriter writer(name.c_str(), index.c_str(), 1, false, Parameters::DBTYPE_AMINO_ACIDS);
+    writer.open();
+    std::string header = name + "_h";
+    std::string headerIndex = name + "_h.index";
+    DBWriter headerWriter(header.c_str(), headerIndex.c_str(), 1, false, Parameters::DBTYPE_GENERIC_DB);
+    headerWriter.open();
+    for (size_t i = 0; i < sequences.size(); i++) {
+        std::string entry = sequences[i] + "\n";
+        writer.writeData(entry.c_str(), entry.size(), i);
+        std::string name = "seq" + SSTR(i) + "\n";
+        headerWriter.writeData(name.c_str(), name.size(), i);
+    }
+    headerWriter.close();
+    writer.close();
+}
+
+// every sequence is aligned against all sequences
+static void writePrefilterDb(const std::string &name, size_t count) {
+    std::string index = name + ".index";
+    DBWriter writer(name.c_str(), index.c_str(), 1, false, Parameters::DBTYPE_PREFILTER_RES);
+    writer.open();
+    for (size_t i = 0; i < count; i++) {
+        std::string entry;
+        for (size_t j = 0; j < count; j++) {
+            entry.append(SSTR(j));
+            entry.append("\t0\t0\n");
+        }
+        writer.writeData(entry.c_str(), entry.size(), i);
+    }
+    writer.close();
+}
+
+// every run parses its parameters as a separate call of the module would
+static void resetParameters(std::vector<MMseqsParameter *> &parameters) {
+    for (size_t i = 0; i < parameters.size(); i++) {
+        parameters[i]->wasSet = false;
+    }
+}
+
+static void runAlign(const std::string &db, const std::string &pref, const std::string &out, bool binary) {
+    Parameters &par = Parameters::getInstance();
+    Command command = {"align", align, &par.align, COMMAND_ALIGNMENT, NULL, NULL, NULL,
+                       "<i:queryDB> <i:targetDB> <i:resultDB> <o:alignmentDB>", 0,
+                       {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                        {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                        {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultDb },
+                        {"alignmentDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::alignmentDb }}};
+    const char *argv[] = {db.c_str(), db.c_str(), pref.c_str(), out.c_str(), "-a", "1", "-e", "10", "--threads", "1", "-v", "1",
+                          "--binary-alignment", binary ? "1" : "0"};
+    resetParameters(par.align);
+    align(sizeof(argv) / sizeof(argv[0]), argv, command);
+}
+
+static void runConvertalis(const std::string &db, const std::string &aln, const std::string &out) {
+    Parameters &par = Parameters::getInstance();
+    Command command = {"convertalis", convertalignments, &par.convertalignments, COMMAND_FORMAT_CONVERSION, NULL, NULL, NULL,
+                       "<i:queryDb> <i:targetDb> <i:alignmentDB> <o:alignmentFile>", 0,
+                       {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::NEED_HEADER, &DbValidator::sequenceDb },
+                        {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA|DbType::NEED_HEADER, &DbValidator::sequenceDb },
+                        {"alignmentDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::alignmentOrBinaryDb },
+                        {"alignmentFile", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::flatfile}}};
+    const char *argv[] = {db.c_str(), db.c_str(), aln.c_str(), out.c_str(), "--threads", "1", "-v", "1", "--format-output",
+                          "query,target,fident,pident,nident,alnlen,mismatch,gapopen,qstart,qend,tstart,tend,evalue,bits,cigar,qcov,tcov,qaln,taln"};
+    resetParameters(par.convertalignments);
+    convertalignments(sizeof(argv) / sizeof(argv[0]), argv, command);
+}
+
+static void runClust(const std::string &db, const std::string &aln, const std::string &out, const char *mode) {
+    Parameters &par = Parameters::getInstance();
+    Command command = {"clust", clust, &par.clust, COMMAND_CLUSTER, NULL, NULL, NULL,
+                       "<i:sequenceDB> <i:resultDB> <o:clusterDB>", 0,
+                       {{"sequenceDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                        {"resultDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::resultOrClusterGraphDb },
+                        {"clusterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::clusterDb }}};
+    const char *argv[] = {db.c_str(), aln.c_str(), out.c_str(), "--cluster-mode", mode, "--threads", "1", "-v", "1"};
+    resetParameters(par.clust);
+    clust(sizeof(argv) / sizeof(argv[0]), argv, command);
+}
+
+static bool isEqual(const Matcher::result_t &a, const Matcher::result_t &b) {
+    return a.dbKey == b.dbKey && a.score == b.score && a.qcov == b.qcov && a.dbcov == b.dbcov && a.seqId == b.seqId
+           && a.eval == b.eval && a.alnLength == b.alnLength && a.qStartPos == b.qStartPos && a.qEndPos == b.qEndPos
+           && a.qLen == b.qLen && a.dbStartPos == b.dbStartPos && a.dbEndPos == b.dbEndPos && a.dbLen == b.dbLen
+           && a.queryOrfStartPos == b.queryOrfStartPos && a.queryOrfEndPos == b.queryOrfEndPos
+           && a.dbOrfStartPos == b.dbOrfStartPos && a.dbOrfEndPos == b.dbOrfEndPos && a.backtrace == b.backtrace;
+}
+
+static size_t countResultDifferences(const std::string &text, const std::string &binary, bool readCompressed) {
+    std::string textIndex = text + ".index";
+    std::string binaryIndex = binary + ".index";
+    DBReader<unsigned int> textDbr(text.c_str(), textIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    textDbr.open(DBReader<unsigned int>::NOSORT);
+    DBReader<unsigned int> binaryDbr(binary.c_str(), binaryIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    binaryDbr.open(DBReader<unsigned int>::NOSORT);
+    size_t differences = (textDbr.getSize() == binaryDbr.getSize()) ? 0 : 1;
+    std::vector<Matcher::result_t> textResults;
+    std::vector<Matcher::result_t> binaryResults;
+    for (size_t i = 0; i < textDbr.getSize(); i++) {
+        size_t id = binaryDbr.getId(textDbr.getDbKey(i));
+        if (id == UINT_MAX) {
+            differences++;
+            continue;
+        }
+        textResults.clear();
+        binaryResults.clear();
+        Matcher::readAlignmentResults(textResults, textDbr.getData(i, 0), readCompressed);
+        Matcher::readAlignmentResults(binaryResults, binaryDbr.getData(id, 0), readCompressed);
+        if (textResults.size() != binaryResults.size()) {
+            differences++;
+            continue;
+        }
+        for (size_t j = 0; j < textResults.size(); j++) {
+            differences += isEqual(textResults[j], binaryResults[j]) ? 0 : 1;
+        }
+    }
+    binaryDbr.close();
+    textDbr.close();
+    return differences;
+}
+
+static size_t countEntryDifferences(const std::string &expected, const std::string &result) {
+    std::string expectedIndex = expected + ".index";
+    std::string resultIndex = result + ".index";
+    DBReader<unsigned int> expectedDbr(expected.c_str(), expectedIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    expectedDbr.open(DBReader<unsigned int>::NOSORT);
+    DBReader<unsigned int> resultDbr(result.c_str(), resultIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    resultDbr.open(DBReader<unsigned int>::NOSORT);
+    size_t differences = (expectedDbr.getSize() == resultDbr.getSize()) ? 0 : 1;
+    for (size_t i = 0; i < expectedDbr.getSize(); i++) {
+        size_t id = resultDbr.getId(expectedDbr.getDbKey(i));
+        if (id == UINT_MAX || std::string(expectedDbr.getData(i, 0)) != std::string(resultDbr.getData(id, 0))) {
+            differences++;
+        }
+    }
+    resultDbr.close();
+    expectedDbr.close();
+    return differences;
+}
+
+static std::string readFile(const std::string &name) {
+    std::ifstream file(name.c_str());
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+int main (int, const char**) {
+    const size_t count = 150;
+    srand(1);
+
+    // families of similar sequences, so that the identities spread over the whole range and clusters form
+    std::vector<std::string> sequences;
+    for (size_t i = 0; i < count; i++) {
+        if (i > 0 && rand() % 3 != 0) {
+            sequences.push_back(mutate(sequences[rand() % i], 5 + rand() % 40));
+        } else {
+            std::string sequence;
+            size_t length = 30 + rand() % 200;
+            for (size_t j = 0; j < length; j++) {
+                sequence.push_back(AMINO_ACIDS[rand() % 20]);
+            }
+            sequences.push_back(sequence);
+        }
+    }
+    writeSequenceDb("test_binaryalignment_db", sequences);
+    writePrefilterDb("test_binaryalignment_pref", count);
+
+    runAlign("test_binaryalignment_db", "test_binaryalignment_pref", "test_binaryalignment_text", false);
+    runAlign("test_binaryalignment_db", "test_binaryalignment_pref", "test_binaryalignment_binary", true);
+    const size_t resultDifferences = countResultDifferences("test_binaryalignment_text", "test_binaryalignment_binary", false)
+                                     + countResultDifferences("test_binaryalignment_text", "test_binaryalignment_binary", true);
+    std::cout << "readAlignmentResults: " << resultDifferences << " results differ\n";
+
+    runConvertalis("test_binaryalignment_db", "test_binaryalignment_text", "test_binaryalignment_text.tsv");
+    runConvertalis("test_binaryalignment_db", "test_binaryalignment_binary", "test_binaryalignment_binary.tsv");
+    const std::string textTsv = readFile("test_binaryalignment_text.tsv");
+    const bool convertEqual = textTsv.empty() == false && textTsv == readFile("test_binaryalignment_binary.tsv");
+    std::cout << "convertalis: output " << (convertEqual ? "matches" : "differs") << "\n";
+
+    // set cover, connected component and greedy incremental clustering
+    const char *modes[] = {"0", "1", "2"};
+    size_t clusterDifferences = 0;
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        runClust("test_binaryalignment_db", "test_binaryalignment_text", "test_binaryalignment_text_clu", modes[i]);
+        runClust("test_binaryalignment_db", "test_binaryalignment_binary", "test_binaryalignment_binary_clu", modes[i]);
+        const size_t differences = countEntryDifferences("test_binaryalignment_text_clu", "test_binaryalignment_binary_clu");
+        std::cout << "clust --cluster-mode " << modes[i] << ": " << differences << " clusters differ\n";
+        clusterDifferences += differences;
+    }
+
+    const char *dbs[] = {"test_binaryalignment_db", "test_binaryalignment_db_h", "test_binaryalignment_pref",
+                         "test_binaryalignment_text", "test_binaryalignment_binary",
+                         "test_binaryalignment_text_clu", "test_binaryalignment_binary_clu"};
+    for (size_t i = 0; i < sizeof(dbs) / sizeof(dbs[0]); i++) {
+        DBReader<unsigned int>::removeDb(dbs[i]);
+    }
+    FileUtil::remove("test_binaryalignment_text.tsv");
+    FileUtil::remove("test_binaryalignment_binary.tsv");
+    return (resultDifferences == 0 && convertEqual && clusterDifferences == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
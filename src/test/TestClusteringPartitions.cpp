@@ -0,0 +1,192 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+#include "ClusteringAlgorithms.h"
+#include "AlignmentSymmetry.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "Matcher.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_clusteringpartitions";
+
+static size_t countDifferences(const std::pair<unsigned int, unsigned int> *expected, const std::pair<unsigned int, unsigned int> *result, size_t size) {
+    size_t differences = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (expected[i] != result[i]) {
+            differences++;
+        }
+    }
+    return differences;
+}
+
+// clusters the graph once in memory and once from partitions on disk, both have to assign the same representatives
+// the partitions always pick the set cover representatives in rounds
+static bool compareModes(DBReader<unsigned int> &seqDbr, DBReader<unsigned int> &alnDbr, int mode, int maxIterations, size_t memoryLimit) {
+    ClusteringAlgorithms inMemory(&seqDbr, &alnDbr, 1, Parameters::APC_SEQID, maxIterations, 0, "test_clustering_graph", true);
+    std::pair<unsigned int, unsigned int> *expected = inMemory.execute(mode);
+    ClusteringAlgorithms partitioned(&seqDbr, &alnDbr, 1, Parameters::APC_SEQID, maxIterations, memoryLimit, "test_clustering_graph");
+    std::pair<unsigned int, unsigned int> *result = partitioned.execute(mode);
+    const size_t differences = countDifferences(expected, result, seqDbr.getSize());
+    std::cout << "Mode " << mode << ": " << differences << " of " << seqDbr.getSize() << " assignments differ\n";
+    delete[] expected;
+    delete[] result;
+    return differences == 0;
+}
+
+// picks the largest set one after another, ties go to the smaller id like the set cover rounds
+static std::pair<unsigned int, unsigned int> *sequentialSetCover(DBReader<unsigned int> &seqDbr, DBReader<unsigned int> &alnDbr) {
+    const size_t dbSize = seqDbr.getSize();
+    std::vector<std::vector<std::pair<unsigned int, unsigned short>>> sets(dbSize);
+    for (size_t i = 0; i < dbSize; i++) {
+        char *data = alnDbr.getDataByDBKey(seqDbr.getDbKey(i), 0);
+        AlignmentSymmetry::forEachResult(data, alnDbr.getDbtype(), Parameters::APC_SEQID, true, [&](unsigned int key, unsigned short score) {
+            sets[i].push_back(std::make_pair(seqDbr.getId(key), score));
+        });
+    }
+    // the graph is made symmetric with the score of the existing direction
+    std::vector<std::vector<std::pair<unsigned int, unsigned short>>> symmetric(sets);
+    for (size_t i = 0; i < dbSize; i++) {
+        for (size_t j = 0; j < sets[i].size(); j++) {
+            const unsigned int target = sets[i][j].first;
+            bool found = false;
+            for (size_t k = 0; k < sets[target].size(); k++) {
+                found = found || (sets[target][k].first == i);
+            }
+            if (found == false) {
+                symmetric[target].push_back(std::make_pair(static_cast<unsigned int>(i), sets[i][j].second));
+            }
+        }
+    }
+    std::vector<int> sizes(dbSize);
+    std::priority_queue<std::pair<int, unsigned int>> queue;
+    for (size_t i = 0; i < dbSize; i++) {
+        sizes[i] = symmetric[i].size();
+        queue.push(std::make_pair(sizes[i], UINT_MAX - static_cast<unsigned int>(i)));
+    }
+    std::vector<char> removed(dbSize, 0);
+    std::vector<unsigned int> assigned(dbSize, UINT_MAX);
+    std::vector<int> bestScore(dbSize, INT_MIN);
+    while (queue.empty() == false) {
+        const std::pair<int, unsigned int> top = queue.top();
+        queue.pop();
+        const unsigned int representative = UINT_MAX - top.second;
+        if (removed[representative]) {
+            continue;
+        }
+        if (top.first != sizes[representative]) {
+            queue.push(std::make_pair(sizes[representative], top.second));
+            continue;
+        }
+        removed[representative] = 1;
+        assigned[representative] = representative;
+        std::vector<unsigned int> members;
+        for (size_t j = 0; j < symmetric[representative].size(); j++) {
+            const unsigned int element = symmetric[representative][j].first;
+            const short score = symmetric[representative][j].second;
+            if (score > bestScore[element]) {
+                assigned[element] = representative;
+                bestScore[element] = score;
+            }
+            if (removed[element] == 0) {
+                removed[element] = 1;
+                members.push_back(element);
+            }
+        }
+        for (size_t j = 0; j < members.size(); j++) {
+            for (size_t k = 0; k < symmetric[members[j]].size(); k++) {
+                sizes[symmetric[members[j]][k].first] -= (removed[symmetric[members[j]][k].first] == 0);
+            }
+        }
+    }
+    std::pair<unsigned int, unsigned int> *assignment = new std::pair<unsigned int, unsigned int>[dbSize];
+    for (size_t i = 0; i < dbSize; i++) {
+        assignment[i] = std::make_pair(seqDbr.getDbKey(assigned[i]), seqDbr.getDbKey(i));
+    }
+    std::sort(assignment, assignment + dbSize);
+    return assignment;
+}
+
+// the set cover rounds have to pick the same representatives as the sequential greedy with the same tie order
+static bool compareRounds(DBReader<unsigned int> &seqDbr, DBReader<unsigned int> &alnDbr) {
+    std::pair<unsigned int, unsigned int> *expected = sequentialSetCover(seqDbr, alnDbr);
+    ClusteringAlgorithms rounds(&seqDbr, &alnDbr, 1, Parameters::APC_SEQID, 1, 0, "test_clustering_graph", true);
+    std::pair<unsigned int, unsigned int> *result = rounds.execute(1);
+    const size_t differences = countDifferences(expected, result, seqDbr.getSize());
+    std::cout << "Set cover rounds: " << differences << " of " << seqDbr.getSize() << " assignments differ from the sequential greedy\n";
+    delete[] expected;
+    delete[] result;
+    return differences == 0;
+}
+
+int main (int, const char**) {
+    const size_t sequenceCount = 3000;
+    srand(1);
+
+    DBWriter seqWriter("test_clustering_seq", "test_clustering_seq.index", 1, false, Parameters::DBTYPE_AMINO_ACIDS);
+    seqWriter.open();
+    std::vector<unsigned int> lengths(sequenceCount);
+    for (size_t i = 0; i < sequenceCount; i++) {
+        lengths[i] = 50 + rand() % 400;
+        std::string sequence(lengths[i], 'A');
+        sequence.push_back('\n');
+        seqWriter.writeData(sequence.c_str(), sequence.size(), i);
+    }
+    seqWriter.close();
+
+    // leaves a few hundred kilobytes for the partitions next to the per sequence state
+    const size_t memoryLimit = 400 * 1024;
+    bool allEqual = true;
+    // overlapping neighborhoods with a few long range edges leave few representatives per set cover round and
+    // end in the sequential greedy, separate families of 20 sequences are picked in rounds
+    for (size_t familySize = 0; familySize <= 20; familySize += 20) {
+        DBWriter alnWriter("test_clustering_aln", "test_clustering_aln.index", 1, false, Parameters::DBTYPE_ALIGNMENT_RES);
+        alnWriter.open();
+        char buffer[1024];
+        for (size_t i = 0; i < sequenceCount; i++) {
+            // the result lists are not symmetric, every hit is listed once
+            std::string entry;
+            std::vector<unsigned int> targets;
+            const size_t neighbors = rand() % 10;
+            for (size_t j = 0; j <= neighbors; j++) {
+                unsigned int target = (j == 0) ? i : (i + j) % sequenceCount;
+                if (j > 0 && familySize > 0) {
+                    target = (i / familySize) * familySize + rand() % familySize;
+                } else if (j > 0 && rand() % 8 == 0) {
+                    target = rand() % sequenceCount;
+                }
+                if (std::find(targets.begin(), targets.end(), target) != targets.end()) {
+                    continue;
+                }
+                targets.push_back(target);
+                const float seqId = (j == 0) ? 1.0f : 0.3f + static_cast<float>(rand() % 70) / 100.0f;
+                const Matcher::result_t result(target, 100, 1.0, 1.0, seqId, 1e-20, 100, 0, 99, lengths[i], 0, 99, lengths[target], "");
+                const size_t length = Matcher::resultToBuffer(buffer, result, false, false);
+                entry.append(buffer, length);
+            }
+            alnWriter.writeData(entry.c_str(), entry.size(), i);
+        }
+        alnWriter.close();
+
+        DBReader<unsigned int> seqDbr("test_clustering_seq", "test_clustering_seq.index", 1, DBReader<unsigned int>::USE_INDEX);
+        seqDbr.open(DBReader<unsigned int>::SORT_BY_LENGTH);
+        DBReader<unsigned int> alnDbr("test_clustering_aln", "test_clustering_aln.index", 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+        alnDbr.open(DBReader<unsigned int>::NOSORT);
+
+        allEqual = compareModes(seqDbr, alnDbr, 1, 2, memoryLimit) && allEqual;
+        // the partitions cannot apply the depth limit of the search, it has to exceed every component
+        allEqual = compareModes(seqDbr, alnDbr, 3, sequenceCount, memoryLimit) && allEqual;
+        allEqual = compareRounds(seqDbr, alnDbr) && allEqual;
+
+        alnDbr.close();
+        seqDbr.close();
+    }
+    DBReader<unsigned int>::removeDb("test_clustering_seq");
+    DBReader<unsigned int>::removeDb("test_clustering_aln");
+    return allEqual ? EXIT_SUCCESS : EXIT_FAILURE;
+}
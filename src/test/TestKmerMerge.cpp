@@ -0,0 +1,95 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+#include "kmermatcher.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_kmermerge";
+
+typedef KmerPosition<short> Kmer;
+
+// writes a split file like kmermatcher does for one hash range, the same rep. sequence can have sets in several files
+static void writeSplitFile(const std::string &name, std::vector<Kmer> &kmers) {
+    std::sort(kmers.begin(), kmers.end(), Kmer::compareRepSequenceAndIdAndDiag);
+    writeKmersToDisk<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry, short>(name, kmers.data(), kmers.size());
+}
+
+static Kmer makeKmer(size_t repSeq, unsigned int id, short pos) {
+    Kmer kmer;
+    kmer.kmer = repSeq;
+    kmer.id = id;
+    kmer.pos = pos;
+    kmer.seqLen = 0;
+    return kmer;
+}
+
+static void merge(const std::vector<std::string> &files, const std::string &out, std::vector<char> &repSequence, size_t threads) {
+    std::string index = out + ".index";
+    DBWriter writer(out.c_str(), index.c_str(), threads, false, Parameters::DBTYPE_PREFILTER_RES);
+    writer.open();
+    std::fill(repSequence.begin(), repSequence.end(), false);
+    mergeKmerFilesAndOutput<Parameters::DBTYPE_AMINO_ACIDS, KmerEntry>(writer, files, repSequence, threads);
+    writer.close();
+}
+
+int main (int, const char**) {
+    const size_t repSeqCount = 20000;
+    const size_t fileCount = 3;
+    srand(1);
+
+    std::vector<std::string> files;
+    for (size_t file = 0; file < fileCount; file++) {
+        std::vector<Kmer> kmers;
+        for (size_t i = 0; i < 200000; i++) {
+            size_t repSeq = static_cast<size_t>(rand()) % repSeqCount;
+            kmers.push_back(makeKmer(repSeq, static_cast<unsigned int>(rand()) % repSeqCount, static_cast<short>(rand() % 50 - 25)));
+        }
+        // rep. sequence 7 gets a set that is larger than the result buffer of a range
+        if (file == 0) {
+            for (unsigned int id = 0; id < 150000; id++) {
+                kmers.push_back(makeKmer(7, repSeqCount + id, 0));
+            }
+        }
+        files.push_back("test_kmermerge_split_" + SSTR(file));
+        writeSplitFile(files.back(), kmers);
+    }
+
+    std::vector<char> serialRepSequence(repSeqCount + 150000);
+    merge(files, "test_kmermerge_serial", serialRepSequence, 1);
+    std::vector<char> rangeRepSequence(repSeqCount + 150000);
+    merge(files, "test_kmermerge_ranges", rangeRepSequence, 4);
+
+    DBReader<unsigned int> serialDbr("test_kmermerge_serial", "test_kmermerge_serial.index", 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    serialDbr.open(DBReader<unsigned int>::NOSORT);
+    DBReader<unsigned int> rangeDbr("test_kmermerge_ranges", "test_kmermerge_ranges.index", 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    rangeDbr.open(DBReader<unsigned int>::NOSORT);
+    const size_t setCount = serialDbr.getSize();
+    size_t differences = (setCount == rangeDbr.getSize()) ? 0 : 1;
+    size_t largestEntry = 0;
+    for (size_t i = 0; i < setCount; i++) {
+        size_t id = rangeDbr.getId(serialDbr.getDbKey(i));
+        if (id == UINT_MAX || std::string(serialDbr.getData(i, 0)) != std::string(rangeDbr.getData(id, 0))) {
+            differences++;
+        }
+        largestEntry = std::max(largestEntry, serialDbr.getEntryLen(i));
+    }
+    differences += (serialRepSequence == rangeRepSequence) ? 0 : 1;
+    std::cout << setCount << " sets, the largest has " << largestEntry << " bytes\n";
+    std::cout << "Range merge: " << differences << " sets differ from the serial merge\n";
+    rangeDbr.close();
+    serialDbr.close();
+
+    DBReader<unsigned int>::removeDb("test_kmermerge_serial");
+    DBReader<unsigned int>::removeDb("test_kmermerge_ranges");
+    for (size_t file = 0; file < fileCount; file++) {
+        FileUtil::remove(files[file].c_str());
+        FileUtil::remove((files[file] + ".done").c_str());
+    }
+    return (differences == 0 && setCount > 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+#include "kmermatcher.h"
+#include "FastSort.h"
+#include "Timer.h"
+#include "Util.h"
+
+#ifdef OPENMP
+#include <omp.h>
+#endif
+
+const char* binary_name = "test_kmersort";
+
+typedef KmerPosition<short, false> Kmer;
+
+// frequent k-mers form large groups like low complexity regions in real data
+static void fillRandomKmers(std::vector<Kmer> &kmers, size_t kmerCount, size_t distinctKmers) {
+    for (size_t i = 0; i < kmers.size(); i++) {
+        size_t kmer = static_cast<size_t>(rand()) % distinctKmers;
+        if (rand() % 100 == 0) {
+            kmer = static_cast<size_t>(rand()) % 16;
+        }
+        kmers[i].kmer = (kmer * 0x9E3779B97F4A7C15ULL) & ~(1ULL << 63);
+        kmers[i].id = static_cast<unsigned int>(rand()) % (kmerCount / 8 + 1);
+        kmers[i].pos = static_cast<short>(rand() % 30000);
+    }
+}
+
+// every k-mer forms a single run and the runs are sorted by comp
+static bool isGrouped(const std::vector<Kmer> &grouped, const std::vector<Kmer> &sorted) {
+    std::vector<Kmer> runs;
+    for (size_t i = 0; i < grouped.size(); i++) {
+        if (i > 0 && grouped[i].kmer == grouped[i - 1].kmer) {
+            if (Kmer::compareRepSequenceAndIdAndDiag(grouped[i], grouped[i - 1])) {
+                return false;
+            }
+        } else {
+            runs.push_back(grouped[i]);
+        }
+    }
+    size_t distinct = 0;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        distinct += (i == 0 || sorted[i].kmer != sorted[i - 1].kmer) ? 1 : 0;
+    }
+    std::vector<Kmer> regrouped(grouped);
+    SORT_PARALLEL(regrouped.begin(), regrouped.end(), Kmer::compareRepSequenceAndIdAndDiag);
+    return runs.size() == distinct && memcmp(regrouped.data(), sorted.data(), sorted.size() * sizeof(Kmer)) == 0;
+}
+
+int main (int argc, const char** argv) {
+    size_t kmerCount = (argc > 1) ? strtoull(argv[1], NULL, 10) : 4000000;
+#ifdef OPENMP
+    if (argc > 2) {
+        omp_set_num_threads(atoi(argv[2]));
+    }
+    std::cout << "Threads: " << omp_get_max_threads() << "\n";
+#endif
+    srand(1);
+    std::vector<Kmer> input(kmerCount);
+    fillRandomKmers(input, kmerCount, kmerCount / 4);
+
+    std::vector<Kmer> sorted(input);
+    Timer timer;
+    SORT_PARALLEL(sorted.begin(), sorted.end(), Kmer::compareRepSequenceAndIdAndDiag);
+    std::cout << "Sort kmer (comparison sort): " << timer.lap() << "\n";
+    std::vector<Kmer> grouped(input);
+    timer.reset();
+    groupKmers(grouped.data(), grouped.size(), Kmer::compareRepSequenceAndIdAndDiag);
+    std::cout << "Sort kmer (bucket sort): " << timer.lap() << "\n";
+    const bool groupsEqual = isGrouped(grouped, sorted);
+
+    // the second sort orders by the rep. sequence that is stored in the kmer field
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i].kmer = static_cast<size_t>(rand()) % (kmerCount / 8 + 1);
+    }
+    sorted = input;
+    timer.reset();
+    SORT_PARALLEL(sorted.begin(), sorted.end(), Kmer::compareRepSequenceAndIdAndDiag);
+    std::cout << "Sort by rep. sequence (comparison sort): " << timer.lap() << "\n";
+    grouped = input;
+    timer.reset();
+    sortKmersByRepSequence(grouped.data(), grouped.size(), Kmer::compareRepSequenceAndIdAndDiag);
+    std::cout << "Sort by rep. sequence (bucket sort): " << timer.lap() << "\n";
+    const bool sortEqual = memcmp(grouped.data(), sorted.data(), sorted.size() * sizeof(Kmer)) == 0;
+
+    std::cout << "Groups " << (groupsEqual ? "match" : "differ") << ", rep. sequence order " << (sortEqual ? "matches" : "differs") << "\n";
+    return (groupsEqual && sortEqual) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
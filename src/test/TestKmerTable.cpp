@@ -0,0 +1,140 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "Command.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_kmertable";
+
+extern int kmermatcher(int argc, const char **argv, const Command &command);
+
+static const char AMINO_ACIDS[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string mutate(const std::string &sequence, int percent) {
+    std::string mutated(sequence);
+    for (size_t i = 0; i < mutated.size(); i++) {
+        if (rand() % 100 < percent) {
+            mutated[i] = AMINO_ACIDS[rand() % 20];
+        }
+    }
+    return mutated;
+}
+
+static void writeSequenceDb(const std::string &name, const std::vector<std::string> &sequences, const std::vector<char> &skip) {
+    std::string index = name + ".index";
+    DBWriter writer(name.c_str(), index.c_str(), 1, false, Parameters::DBTYPE_AMINO_ACIDS);
+    writer.open();
+    for (size_t i = 0; i < sequences.size(); i++) {
+        if (skip[i]) {
+            continue;
+        }
+        std::string entry = sequences[i] + "\n";
+        writer.writeData(entry.c_str(), entry.size(), i);
+    }
+    writer.close();
+}
+
+static void runKmermatcher(const std::string &db, const std::string &out, const std::string &table) {
+    Parameters &par = Parameters::getInstance();
+    Command command = {"kmermatcher", kmermatcher, &par.kmermatcher, COMMAND_PREFILTER, NULL, NULL, NULL,
+                       "<i:sequenceDB> <o:prefilterDB>", 0,
+                       {{"sequenceDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                        {"prefilterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::prefilterDb }}};
+    std::vector<const char *> argv;
+    argv.push_back(db.c_str());
+    argv.push_back(out.c_str());
+    argv.push_back("--threads");
+    argv.push_back("1");
+    argv.push_back("-v");
+    argv.push_back("1");
+    if (table.empty() == false) {
+        argv.push_back("--kmer-table");
+        argv.push_back(table.c_str());
+    }
+    // every run parses its parameters as a separate call of the module would
+    par.kmerTable = "";
+    for (size_t i = 0; i < par.kmermatcher.size(); i++) {
+        par.kmermatcher[i]->wasSet = false;
+    }
+    kmermatcher(static_cast<int>(argv.size()), argv.data(), command);
+}
+
+static size_t countDifferences(const std::string &expected, const std::string &result) {
+    std::string expectedIndex = expected + ".index";
+    std::string resultIndex = result + ".index";
+    DBReader<unsigned int> expectedDbr(expected.c_str(), expectedIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    expectedDbr.open(DBReader<unsigned int>::NOSORT);
+    DBReader<unsigned int> resultDbr(result.c_str(), resultIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    resultDbr.open(DBReader<unsigned int>::NOSORT);
+    size_t differences = (expectedDbr.getSize() == resultDbr.getSize()) ? 0 : 1;
+    for (size_t i = 0; i < expectedDbr.getSize(); i++) {
+        unsigned int key = expectedDbr.getDbKey(i);
+        size_t id = resultDbr.getId(key);
+        if (id == UINT_MAX || std::string(expectedDbr.getData(i, 0)) != std::string(resultDbr.getData(id, 0))) {
+            differences++;
+        }
+    }
+    resultDbr.close();
+    expectedDbr.close();
+    return differences;
+}
+
+int main (int, const char**) {
+    const size_t oldCount = 2000;
+    const size_t newCount = 500;
+    srand(1);
+
+    // families of similar sequences so that the k-mer groups have several members
+    std::vector<std::string> sequences;
+    for (size_t i = 0; i < oldCount + newCount; i++) {
+        if (i > 0 && rand() % 2 == 0) {
+            sequences.push_back(mutate(sequences[rand() % i], 5));
+        } else {
+            std::string sequence;
+            size_t length = 50 + rand() % 300;
+            for (size_t j = 0; j < length; j++) {
+                sequence.push_back(AMINO_ACIDS[rand() % 20]);
+            }
+            sequences.push_back(sequence);
+        }
+    }
+    std::vector<char> skip(oldCount + newCount, false);
+    for (size_t i = oldCount; i < oldCount + newCount; i++) {
+        skip[i] = true;
+    }
+    std::vector<std::string> oldSequences(sequences);
+    writeSequenceDb("test_kmertable_old", oldSequences, skip);
+
+    // the grown database has new sequences, a changed sequence and misses a removed one
+    std::fill(skip.begin(), skip.end(), false);
+    skip[7] = true;
+    sequences[5] = mutate(sequences[5], 20);
+    writeSequenceDb("test_kmertable_new", sequences, skip);
+
+    const std::string table = "test_kmertable_table";
+    if (FileUtil::fileExists(table.c_str())) {
+        FileUtil::remove(table.c_str());
+    }
+    runKmermatcher("test_kmertable_new", "test_kmertable_expected", "");
+    runKmermatcher("test_kmertable_old", "test_kmertable_old_pref", table);
+    runKmermatcher("test_kmertable_new", "test_kmertable_result", table);
+    const size_t grownDifferences = countDifferences("test_kmertable_expected", "test_kmertable_result");
+    std::cout << "Grown database: " << grownDifferences << " entries differ\n";
+    // the second run on the same database only reads the table
+    runKmermatcher("test_kmertable_new", "test_kmertable_reused", table);
+    const size_t reusedDifferences = countDifferences("test_kmertable_expected", "test_kmertable_reused");
+    std::cout << "Unchanged database: " << reusedDifferences << " entries differ\n";
+
+    const char *dbs[] = {"test_kmertable_old", "test_kmertable_new", "test_kmertable_expected", "test_kmertable_old_pref",
+                         "test_kmertable_result", "test_kmertable_reused"};
+    for (size_t i = 0; i < sizeof(dbs) / sizeof(dbs[0]); i++) {
+        DBReader<unsigned int>::removeDb(dbs[i]);
+    }
+    FileUtil::remove(table.c_str());
+    return (grownDifferences == 0 && reusedDifferences == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
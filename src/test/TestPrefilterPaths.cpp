@@ -0,0 +1,168 @@
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "Command.h"
+#include "DBReader.h"
+#include "DBWriter.h"
+#include "FileUtil.h"
+#include "Parameters.h"
+#include "Prefiltering.h"
+
+const char* binary_name = "test_prefilterpaths";
+
+static const char AMINO_ACIDS[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string mutate(const std::string &sequence, int percent) {
+    std::string mutated;
+    for (size_t i = 0; i < sequence.size(); i++) {
+        const int event = rand() % 100;
+        if (event < percent) {
+            mutated.push_back(AMINO_ACIDS[rand() % 20]);
+        } else if (event < percent + 2) {
+            mutated.push_back(AMINO_ACIDS[rand() % 20]);
+            mutated.push_back(sequence[i]);
+        } else if (event >= percent + 4) {
+            mutated.push_back(sequence[i]);
+        }
+    }
+    return mutated.empty() ? sequence : mutated;
+}
+
+static void writeSequenceDb(const std::string &name, const std::vector<std::string> &sequences) {
+    std::string index = name + ".index";
+    DBWriter writer(name.c_str(), index.c_str(), 1, false, Parameters::DBTYPE_AMINO_ACIDS);
+    writer.open();
+    for (size_t i = 0; i < sequences.size(); i++) {
+        std::string entry = sequences[i] + "\n";
+        writer.writeData(entry.c_str(), entry.size(), i);
+    }
+    writer.close();
+}
+
+// the options of the default path, every run sets all of them because the parameters keep the values of the last run
+static std::map<std::string, std::string> defaultOptions() {
+    std::map<std::string, std::string> options;
+    options["--prefilter-batch-size"] = "1";
+    options["--index-compression"] = "0";
+    options["--prefetch-distance"] = "0";
+    options["--max-kmers-per-pos"] = "0";
+    return options;
+}
+
+static void runPrefilter(const std::string &db, const std::string &out, const std::map<std::string, std::string> &changed) {
+    Parameters &par = Parameters::getInstance();
+    Command command = {"prefilter", NULL, &par.prefilter, COMMAND_PREFILTER, NULL, NULL, NULL,
+                       "<i:queryDB> <i:targetDB> <o:prefilterDB>", 0,
+                       {{"queryDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                        {"targetDB", DbType::ACCESS_MODE_INPUT, DbType::NEED_DATA, &DbValidator::sequenceDb },
+                        {"prefilterDB", DbType::ACCESS_MODE_OUTPUT, DbType::NEED_DATA, &DbValidator::prefilterDb }}};
+    std::map<std::string, std::string> options = defaultOptions();
+    for (std::map<std::string, std::string>::const_iterator it = changed.begin(); it != changed.end(); ++it) {
+        options[it->first] = it->second;
+    }
+    std::vector<const char *> argv;
+    argv.push_back(db.c_str());
+    argv.push_back(db.c_str());
+    argv.push_back(out.c_str());
+    argv.push_back("--threads");
+    argv.push_back("1");
+    argv.push_back("-v");
+    argv.push_back("1");
+    for (std::map<std::string, std::string>::const_iterator it = options.begin(); it != options.end(); ++it) {
+        argv.push_back(it->first.c_str());
+        argv.push_back(it->second.c_str());
+    }
+    for (size_t i = 0; i < par.prefilter.size(); i++) {
+        par.prefilter[i]->wasSet = false;
+    }
+    par.parseParameters(argv.size(), argv.data(), command, true, 0, MMseqsParameter::COMMAND_PREFILTER);
+    // the prefilter module without its server request path
+    Prefiltering pref(par.db1, par.db1Index, par.db2, par.db2Index,
+                      FileUtil::parseDbType(par.db1.c_str()), FileUtil::parseDbType(par.db2.c_str()), par);
+    pref.runAllSplits(par.db3, par.db3Index);
+}
+
+static size_t countEntryDifferences(const std::string &expected, const std::string &result) {
+    std::string expectedIndex = expected + ".index";
+    std::string resultIndex = result + ".index";
+    DBReader<unsigned int> expectedDbr(expected.c_str(), expectedIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    expectedDbr.open(DBReader<unsigned int>::NOSORT);
+    DBReader<unsigned int> resultDbr(result.c_str(), resultIndex.c_str(), 1, DBReader<unsigned int>::USE_DATA|DBReader<unsigned int>::USE_INDEX);
+    resultDbr.open(DBReader<unsigned int>::NOSORT);
+    size_t differences = (expectedDbr.getSize() == resultDbr.getSize()) ? 0 : 1;
+    for (size_t i = 0; i < expectedDbr.getSize(); i++) {
+        size_t id = resultDbr.getId(expectedDbr.getDbKey(i));
+        if (id == UINT_MAX || std::string(expectedDbr.getData(i, 0)) != std::string(resultDbr.getData(id, 0))) {
+            differences++;
+        }
+    }
+    resultDbr.close();
+    expectedDbr.close();
+    return differences;
+}
+
+struct PrefilterPath {
+    const char *name;
+    std::map<std::string, std::string> options;
+    PrefilterPath(const char *name, const char *option, const char *value) : name(name) {
+        options[option] = value;
+    }
+    PrefilterPath(const char *name, const char *option1, const char *value1, const char *option2, const char *value2) : name(name) {
+        options[option1] = value1;
+        options[option2] = value2;
+    }
+};
+
+int main (int, const char**) {
+    const size_t count = 300;
+    srand(1);
+
+    // families of similar sequences, so that most queries have many hits on several diagonals
+    std::vector<std::string> sequences;
+    for (size_t i = 0; i < count; i++) {
+        if (i > 0 && rand() % 3 != 0) {
+            sequences.push_back(mutate(sequences[rand() % i], 5 + rand() % 40));
+        } else {
+            std::string sequence;
+            size_t length = 30 + rand() % 400;
+            for (size_t j = 0; j < length; j++) {
+                sequence.push_back(AMINO_ACIDS[rand() % 20]);
+            }
+            sequences.push_back(sequence);
+        }
+    }
+    writeSequenceDb("test_prefilterpaths_db", sequences);
+    runPrefilter("test_prefilterpaths_db", "test_prefilterpaths_default", std::map<std::string, std::string>());
+
+    // every path has to give the results of the default path
+    std::vector<PrefilterPath> paths;
+    paths.push_back(PrefilterPath("batched matching", "--prefilter-batch-size", "4"));
+    // 7 does not divide the number of queries, so the last batch is smaller
+    paths.push_back(PrefilterPath("batched matching", "--prefilter-batch-size", "7"));
+    paths.push_back(PrefilterPath("compressed index", "--index-compression", "1"));
+    paths.push_back(PrefilterPath("compressed index", "--index-compression", "1", "--prefilter-batch-size", "4"));
+    paths.push_back(PrefilterPath("fixed prefetch distance", "--prefetch-distance", "1"));
+    paths.push_back(PrefilterPath("fixed prefetch distance", "--prefetch-distance", "16"));
+    // no query reaches this budget, so the threshold is never raised
+    paths.push_back(PrefilterPath("k-mer budget", "--max-kmers-per-pos", "100000"));
+
+    size_t totalDifferences = 0;
+    for (size_t i = 0; i < paths.size(); i++) {
+        runPrefilter("test_prefilterpaths_db", "test_prefilterpaths_path", paths[i].options);
+        const size_t differences = countEntryDifferences("test_prefilterpaths_default", "test_prefilterpaths_path");
+        std::cout << paths[i].name;
+        for (std::map<std::string, std::string>::const_iterator it = paths[i].options.begin(); it != paths[i].options.end(); ++it) {
+            std::cout << " " << it->first << " " << it->second;
+        }
+        std::cout << ": " << differences << " queries differ from the default path\n";
+        totalDifferences += differences;
+        DBReader<unsigned int>::removeDb("test_prefilterpaths_path");
+    }
+
+    DBReader<unsigned int>::removeDb("test_prefilterpaths_db");
+    DBReader<unsigned int>::removeDb("test_prefilterpaths_default");
+    return (totalDifferences == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,97 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "Sequence.h"
+#include "SubstitutionMatrix.h"
+#include "StripedSmithWaterman.h"
+#include "EvalueComputation.h"
+#include "Parameters.h"
+
+const char* binary_name = "test_scorebatch";
+
+static const char AMINO_ACIDS[] = "ACDEFGHIKLMNPQRSTVWY";
+
+static std::string randomSequence(size_t length) {
+    std::string sequence;
+    for (size_t i = 0; i < length; i++) {
+        sequence.push_back(AMINO_ACIDS[rand() % 20]);
+    }
+    return sequence;
+}
+
+// a part of the query with substitutions and short gaps, so that the targets reach high scores
+static std::string relatedSequence(const std::string &query) {
+    const size_t start = rand() % query.size();
+    const size_t length = 1 + rand() % (query.size() - start);
+    std::string sequence;
+    for (size_t i = start; i < start + length; i++) {
+        const int event = rand() % 100;
+        if (event < 20) {
+            sequence.push_back(AMINO_ACIDS[rand() % 20]);
+        } else if (event < 23) {
+            sequence.append(randomSequence(1 + rand() % 4));
+        } else if (event >= 26) {
+            sequence.push_back(query[i]);
+        }
+    }
+    return sequence.empty() ? randomSequence(1) : sequence;
+}
+
+int main (int, const char**) {
+    const int gapOpen = 11;
+    const int gapExtend = 1;
+    Parameters &par = Parameters::getInstance();
+    par.initMatrices();
+    SubstitutionMatrix subMat(par.scoringMatrixFile.aminoacids, 2.0, 0.0);
+    int8_t *tinySubMat = new int8_t[subMat.alphabetSize * subMat.alphabetSize];
+    for (int i = 0; i < subMat.alphabetSize; i++) {
+        for (int j = 0; j < subMat.alphabetSize; j++) {
+            tinySubMat[i * subMat.alphabetSize + j] = static_cast<int8_t>(subMat.subMatrix[i][j]);
+        }
+    }
+    EvalueComputation evaluer(100000, &subMat, gapOpen, gapExtend);
+    const size_t maxLen = 2000;
+    Sequence query(maxLen, Parameters::DBTYPE_AMINO_ACIDS, &subMat, 0, false, true);
+    Sequence target(maxLen, Parameters::DBTYPE_AMINO_ACIDS, &subMat, 0, false, false);
+    SmithWaterman aligner(maxLen, subMat.alphabetSize, false);
+    srand(1);
+
+    size_t comparisons = 0;
+    size_t failures = 0;
+    for (size_t round = 0; round < 50; round++) {
+        const std::string querySequence = randomSequence(20 + rand() % 600);
+        query.mapSequence(0, 0, querySequence.c_str(), querySequence.size());
+        aligner.ssw_init(&query, tinySubMat, &subMat, 2);
+
+        // a count that is not a multiple of BATCH_LANES leaves lanes idle at the end, one target leaves all but one idle
+        const size_t count = (round % 5 == 0) ? 1 : 1 + rand() % (3 * SmithWaterman::BATCH_LANES);
+        std::vector<std::vector<unsigned char>> residues(count);
+        std::vector<const unsigned char *> targets(count);
+        std::vector<int32_t> lengths(count);
+        std::vector<int32_t> scores(count);
+        for (size_t i = 0; i < count; i++) {
+            const std::string targetSequence = (rand() % 2 == 0) ? relatedSequence(querySequence) : randomSequence(1 + rand() % 800);
+            target.mapSequence(i, i, targetSequence.c_str(), targetSequence.size());
+            residues[i].assign(target.numSequence, target.numSequence + target.L);
+            targets[i] = residues[i].data();
+            lengths[i] = target.L;
+        }
+        aligner.ssw_score_batch(targets.data(), lengths.data(), count, gapOpen, gapExtend, scores.data());
+
+        for (size_t i = 0; i < count; i++) {
+            s_align alignment = aligner.ssw_align(targets[i], lengths[i], gapOpen, gapExtend, 0, 10000, &evaluer, 0, 0.0, query.L / 2);
+            comparisons++;
+            if (scores[i] < static_cast<int32_t>(alignment.score1)) {
+                std::cout << "Query " << round << " target " << i << ": batch score " << scores[i]
+                          << " is below the ssw_align score " << alignment.score1 << "\n";
+                failures++;
+            }
+            delete[] alignment.cigar;
+        }
+    }
+    std::cout << failures << " of " << comparisons << " batch scores are below the ssw_align score\n";
+    delete[] tinySubMat;
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
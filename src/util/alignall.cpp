@@ -74,6 +74,7 @@ int alignall(int argc, const char **argv, const Command &command) {
             Sequence target(par.maxSeqLen, targetSeqType, subMat, 0, false, par.compBiasCorrection);
 
             char buffer[1024 + 32768*4];
+            std::string longBuffer;
 
             std::vector<unsigned int> results;
             results.reserve(300);
@@ -120,8 +121,17 @@ int alignall(int argc, const char **argv, const Command &command) {
                                                                        swMode, par.seqIdMode, isIdentity);
                         // checkCriteria and Util::canBeCovered always work together
                         if (Alignment::checkCriteria(result, isIdentity, par.evalThr, par.seqIdThr, par.alnLenThr, par.covMode, par.covThr)) {
-                            size_t len = Matcher::resultToBuffer(tmpBuff, result, par.addBacktrace);
-                            resultWriter.writeAdd(buffer, queryIdLen + len, thread_idx);
+                            const size_t maxLen = Matcher::resultToBufferSize(result, par.addBacktrace);
+                            if (queryIdLen + maxLen > sizeof(buffer)) {
+                                // long backtraces do not fit into buffer
+                                longBuffer.assign(buffer, queryIdLen);
+                                longBuffer.resize(queryIdLen + maxLen);
+                                size_t len = Matcher::resultToBuffer(&longBuffer[queryIdLen], result, par.addBacktrace);
+                                resultWriter.writeAdd(longBuffer.data(), queryIdLen + len, thread_idx);
+                            } else {
+                                size_t len = Matcher::resultToBuffer(tmpBuff, result, par.addBacktrace);
+                                resultWriter.writeAdd(buffer, queryIdLen + len, thread_idx);
+                            }
                         }
                     }
                 }
@@ -281,11 +281,7 @@ int convertalignments(int argc, const char **argv, const Command &command) {
         resultWriter.writeAdd(header.c_str(), header.size(), 0);
 
         for (size_t i = 0; i < alnDbr.getSize(); i++) {
-            char *data = alnDbr.getData(i, 0);
-            while (*data != '\0') {
-                char dbKeyBuffer[255 + 1];
-                Util::parseKey(data, dbKeyBuffer);
-                const unsigned int dbKey = (unsigned int) strtoul(dbKeyBuffer, NULL, 10);
+            auto writeTargetHeader = [&](unsigned int dbKey) {
                 if (headerWritten[dbKey] == false) {
                     headerWritten[dbKey] = true;
                     unsigned int tId = tDbr->sequenceReader->getId(dbKey);
@@ -297,11 +293,24 @@ int convertalignments(int argc, const char **argv, const Command &command) {
                                          (int32_t) seqLen);
                     if (count < 0 || static_cast<size_t>(count) >= sizeof(buffer)) {
                         Debug(Debug::WARNING) << "Truncated line in header " << i << "!\n";
-                        continue;
+                        return;
                     }
                     resultWriter.writeAdd(buffer, count, 0);
                 }
                 resultWriter.writeEnd(0, 0, false, 0);
+            };
+            char *data = alnDbr.getData(i, 0);
+            if (AlignmentRecords::isBinary(data)) {
+                AlignmentRecords records(data);
+                for (size_t j = 0; j < records.size(); j++) {
+                    writeTargetHeader(records[j].dbKey);
+                }
+                continue;
+            }
+            while (*data != '\0') {
+                char dbKeyBuffer[255 + 1];
+                Util::parseKey(data, dbKeyBuffer);
+                writeTargetHeader((unsigned int) strtoul(dbKeyBuffer, NULL, 10));
                 data = Util::skipLine(data);
             }
         }
@@ -343,6 +352,9 @@ int convertalignments(int argc, const char **argv, const Command &command) {
         std::string newBacktrace;
         newBacktrace.reserve(1024);
 
+        std::vector<Matcher::result_t> alnResults;
+        alnResults.reserve(300);
+
         const TaxonNode * taxonNode = NULL;
 
 #pragma omp  for schedule(dynamic, 10)
@@ -391,10 +403,10 @@ int convertalignments(int argc, const char **argv, const Command &command) {
                 result.append("\"}, \"alignments\": [\n");
             }
 
-            char *data = alnDbr.getData(i, thread_idx);
-            while (*data != '\0') {
-                Matcher::result_t res = Matcher::parseAlignmentRecord(data, true);
-                data = Util::skipLine(data);
+            alnResults.clear();
+            Matcher::readAlignmentResults(alnResults, alnDbr.getData(i, thread_idx), true);
+            for (size_t j = 0; j < alnResults.size(); j++) {
+                Matcher::result_t &res = alnResults[j];
 
                 if (res.backtrace.empty() && needBacktrace == true) {
                     Debug(Debug::ERROR) << "Backtrace cigar is missing in the alignment result. Please recompute the alignment with the -a flag.\n"
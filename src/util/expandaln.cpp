@@ -178,6 +178,8 @@ int expandaln(int argc, const char **argv, const Command& command, bool returnAl
 
         char buffer[1024 + 32768*4];
 
+        std::vector<Matcher::result_t> resultsAb;
+        resultsAb.reserve(300);
         std::vector<Matcher::result_t> resultsBc;
         resultsBc.reserve(300);
 
@@ -206,10 +208,10 @@ int expandaln(int argc, const char **argv, const Command& command, bool returnAl
                 SubstitutionMatrix::calcLocalAaBiasCorrection(&subMat, aSeq.numSequence, aSeq.L, compositionBias);
             }
 
-            char *data = resultAbReader->getData(i, thread_idx);
-            while (*data != '\0') {
-                Matcher::result_t resultAb = Matcher::parseAlignmentRecord(data, false);
-                data = Util::skipLine(data);
+            resultsAb.clear();
+            Matcher::readAlignmentResults(resultsAb, resultAbReader->getData(i, thread_idx), false);
+            for (size_t j = 0; j < resultsAb.size(); ++j) {
+                const Matcher::result_t &resultAb = resultsAb[j];
                 if(returnAlnRes == false && resultAb.eval > par.evalProfile){
                     continue;
                 }
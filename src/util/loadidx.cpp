@@ -0,0 +1,66 @@
+#include "Parameters.h"
+#include "Util.h"
+#include "Debug.h"
+#include "FileUtil.h"
+#include "PrefilteringIndexReader.h"
+#include "SharedMemory.h"
+
+static std::string findIndexDataFile(const std::string &db) {
+    std::string indexDB = PrefilteringIndexReader::searchForIndex(db);
+    if (indexDB.empty() && Util::endsWith(".idx", db) && FileUtil::fileExists(db.c_str())) {
+        indexDB = db;
+    }
+    if (indexDB.empty()) {
+        Debug(Debug::ERROR) << "No index found for " << db << ". Please create one with createindex first.\n";
+    }
+    return indexDB;
+}
+
+int loadidx(int argc, const char **argv, const Command& command) {
+    Parameters& par = Parameters::getInstance();
+    par.parseParameters(argc, argv, command, true, 0, 0);
+
+    std::string indexDB = findIndexDataFile(par.db1);
+    if (indexDB.empty()) {
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> dataFiles = FileUtil::findDatafiles(indexDB.c_str());
+    std::vector<std::string> createdFiles;
+    for (size_t i = 0; i < dataFiles.size(); i++) {
+        bool created = false;
+        if (SharedMemory::load(dataFiles[i], created) == false) {
+            // do not leave a partially loaded index behind, segments loaded before this call may be in use
+            for (size_t j = 0; j < createdFiles.size(); j++) {
+                SharedMemory::unload(createdFiles[j]);
+            }
+            return EXIT_FAILURE;
+        }
+        if (created) {
+            createdFiles.push_back(dataFiles[i]);
+        }
+        Debug(Debug::INFO) << "Loaded " << dataFiles[i] << " into " << SharedMemory::getSegmentName(dataFiles[i]) << "\n";
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int unloadidx(int argc, const char **argv, const Command& command) {
+    Parameters& par = Parameters::getInstance();
+    par.parseParameters(argc, argv, command, true, 0, 0);
+
+    std::string indexDB = findIndexDataFile(par.db1);
+    if (indexDB.empty()) {
+        return EXIT_FAILURE;
+    }
+
+    int status = EXIT_SUCCESS;
+    std::vector<std::string> dataFiles = FileUtil::findDatafiles(indexDB.c_str());
+    for (size_t i = 0; i < dataFiles.size(); i++) {
+        if (SharedMemory::unload(dataFiles[i]) == false) {
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
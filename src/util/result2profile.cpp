@@ -137,6 +137,7 @@ int result2profile(int argc, const char **argv, const Command &command, bool ret
         char dbKey[255];
         const char *entry[255];
         char buffer[1024 + 32768*4];
+        std::string longBuffer;
 
         std::vector<Matcher::result_t> alnResults;
         alnResults.reserve(300);
@@ -160,43 +161,68 @@ int result2profile(int argc, const char **argv, const Command &command, bool ret
             centerSequence.mapSequence(queryId, queryKey, qDbr->getData(queryId, thread_idx), qDbr->getSeqLen(queryId));
 
             bool isQueryInit = false;
-            char *data = resultReader.getData(id, thread_idx);
-            while (*data != '\0') {
-                Util::parseKey(data, dbKey);
-                const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
-                // in the same database case, we have the query repeated
-                if (key == queryKey && sameDatabase == true) {
-                    data = Util::skipLine(data);
-                    continue;
+            auto addTarget = [&](unsigned int key) {
+                const size_t edgeId = tDbr->getId(key);
+                if (edgeId == UINT_MAX) {
+                    Debug(Debug::ERROR) << "Sequence " << key << " does not exist in target sequence database\n";
+                    EXIT(EXIT_FAILURE);
+                }
+                edgeSequence.mapSequence(edgeId, key, tDbr->getData(edgeId, thread_idx), tDbr->getSeqLen(edgeId));
+                seqSet.emplace_back(std::vector<unsigned char>(edgeSequence.numSequence, edgeSequence.numSequence + edgeSequence.L));
+            };
+            // Recompute if not all the backtraces are present
+            auto recomputeResult = [&]() {
+                if (isQueryInit == false) {
+                    matcher.initQuery(&centerSequence);
+                    isQueryInit = true;
                 }
+                alnResults.emplace_back(matcher.getSWResult(&edgeSequence, INT_MAX, false, 0, 0.0, FLT_MAX, Matcher::SCORE_COV_SEQID, 0, false));
+            };
 
-                const size_t columns = Util::getWordsOfLine(data, entry, 255);
-                float evalue = 0.0;
-                if (columns >= 4) {
-                    evalue = strtod(entry[3], NULL);
+            char *data = resultReader.getData(id, thread_idx);
+            if (AlignmentRecords::isBinary(data)) {
+                AlignmentRecords records(data);
+                for (size_t i = 0; i < records.size(); i++) {
+                    const AlignmentRecord &record = records[i];
+                    // in the same database case, we have the query repeated
+                    if (record.dbKey == queryKey && sameDatabase == true) {
+                        continue;
+                    }
+                    if (record.eval < par.evalProfile) {
+                        addTarget(record.dbKey);
+                        if (record.backtraceLength > 0) {
+                            alnResults.emplace_back(Matcher::recordToResult(records, i));
+                        } else {
+                            recomputeResult();
+                        }
+                    }
                 }
+            } else {
+                while (*data != '\0') {
+                    Util::parseKey(data, dbKey);
+                    const unsigned int key = (unsigned int) strtoul(dbKey, NULL, 10);
+                    // in the same database case, we have the query repeated
+                    if (key == queryKey && sameDatabase == true) {
+                        data = Util::skipLine(data);
+                        continue;
+                    }
 
-                if (evalue < par.evalProfile) {
-                    const size_t edgeId = tDbr->getId(key);
-                    if (edgeId == UINT_MAX) {
-                        Debug(Debug::ERROR) << "Sequence " << key << " does not exist in target sequence database\n";
-                        EXIT(EXIT_FAILURE);
+                    const size_t columns = Util::getWordsOfLine(data, entry, 255);
+                    float evalue = 0.0;
+                    if (columns >= 4) {
+                        evalue = strtod(entry[3], NULL);
                     }
-                    edgeSequence.mapSequence(edgeId, key, tDbr->getData(edgeId, thread_idx), tDbr->getSeqLen(edgeId));
-                    seqSet.emplace_back(std::vector<unsigned char>(edgeSequence.numSequence, edgeSequence.numSequence + edgeSequence.L));
-
-                    if (columns > Matcher::ALN_RES_WITHOUT_BT_COL_CNT) {
-                        alnResults.emplace_back(Matcher::parseAlignmentRecord(data));
-                    } else {
-                        // Recompute if not all the backtraces are present
-                        if (isQueryInit == false) {
-                            matcher.initQuery(&centerSequence);
-                            isQueryInit = true;
+
+                    if (evalue < par.evalProfile) {
+                        addTarget(key);
+                        if (columns > Matcher::ALN_RES_WITHOUT_BT_COL_CNT) {
+                            alnResults.emplace_back(Matcher::parseAlignmentRecord(data));
+                        } else {
+                            recomputeResult();
                         }
-                        alnResults.emplace_back(matcher.getSWResult(&edgeSequence, INT_MAX, false, 0, 0.0, FLT_MAX, Matcher::SCORE_COV_SEQID, 0, false));
                     }
+                    data = Util::skipLine(data);
                 }
-                data = Util::skipLine(data);
             }
 
             // Recompute if not all the backtraces are present
@@ -211,8 +237,15 @@ int result2profile(int argc, const char **argv, const Command &command, bool ret
             if (returnAlnRes) {
                 // do not count query
                 for (size_t i = 0; i < (filteredSetSize - 1); ++i) {
-                    size_t len = Matcher::resultToBuffer(buffer, alnResults[i], true);
-                    result.append(buffer, len);
+                    char *lineBuffer = buffer;
+                    const size_t maxLen = Matcher::resultToBufferSize(alnResults[i], true);
+                    if (maxLen > sizeof(buffer)) {
+                        // long backtraces do not fit into buffer
+                        longBuffer.resize(maxLen);
+                        lineBuffer = &longBuffer[0];
+                    }
+                    size_t len = Matcher::resultToBuffer(lineBuffer, alnResults[i], true);
+                    result.append(lineBuffer, len);
                 }
                 alnResults.clear();
             } else {
@@ -128,6 +128,11 @@ int clusteringworkflow(int argc, const char **argv, const Command& command) {
         EXIT(EXIT_FAILURE);
     }
     setClusterAutomagicParameters(par);
+    // nucleotide clustering and the reassignment step pass the alignments on to modules that read text results
+    if (par.binaryAlignment && (isNucleotideDb || (par.singleStepClustering == false && par.clusterReassignment))) {
+        Debug(Debug::ERROR) << "Cannot use --binary-alignment with nucleotide clustering or --cluster-reassign\n";
+        EXIT(EXIT_FAILURE);
+    }
 
     std::string tmpDir = par.db3;
     std::string hash = SSTR(par.hashParameter(command.databases, par.filenames, par.clusterworkflow));
@@ -39,7 +39,10 @@ int rbh(int argc, const char **argv, const Command &command) {
     par.PARAM_THREADS.removeCategory(MMseqsParameter::COMMAND_EXPERT);
 
     par.parseParameters(argc, argv, command, true, 0, 0);
-
+    if (par.binaryAlignment) {
+        Debug(Debug::ERROR) << "Cannot use --binary-alignment with rbh, the best hits are selected from text results\n";
+        EXIT(EXIT_FAILURE);
+    }
 
     std::string tmpDir = par.db4;
     std::string hash = SSTR(par.hashParameter(command.databases, par.filenames, par.searchworkflow));
@@ -264,6 +264,18 @@ int search(int argc, const char **argv, const Command& command) {
         EXIT(EXIT_FAILURE);
     }
 
+    // only a single gapped search of amino acids or query profiles returns the alignment results as written,
+    // all other paths pass them on to modules that read text results
+    const int textResultModes = Parameters::SEARCH_MODE_FLAG_TARGET_PROFILE
+                                | Parameters::SEARCH_MODE_FLAG_QUERY_TRANSLATED | Parameters::SEARCH_MODE_FLAG_TARGET_TRANSLATED
+                                | Parameters::SEARCH_MODE_FLAG_QUERY_NUCLEOTIDE | Parameters::SEARCH_MODE_FLAG_TARGET_NUCLEOTIDE;
+    if (par.binaryAlignment && (isUngappedMode || par.exhaustiveSearch || par.numIterations > 1 || par.sensSteps > 1
+                                || (searchMode & textResultModes))) {
+        par.printUsageMessage(command, MMseqsParameter::COMMAND_ALIGN | MMseqsParameter::COMMAND_PREFILTER);
+        Debug(Debug::ERROR) << "Cannot use --binary-alignment with iterative, multi step, exhaustive, ungapped, target profile or nucleotide searches\n";
+        EXIT(EXIT_FAILURE);
+    }
+
     // validate and set parameters for iterative search
     if (par.numIterations > 1) {
         if (searchMode & Parameters::SEARCH_MODE_FLAG_TARGET_PROFILE) {
@@ -446,6 +458,10 @@ int search(int argc, const char **argv, const Command& command) {
             par.rescoreMode = originalRescoreMode;
         } else {
             cmd.addVariable("ALIGNMENT_PAR", par.createParameterString(par.align).c_str());
+            // only a single prefilter step can be aligned right away
+            if (par.fusedAlign && par.lcaSearch == false && par.sensSteps <= 1) {
+                cmd.addVariable("FUSED_ALIGN_PAR", par.createParameterString(par.prefilteralign).c_str());
+            }
         }
         FileUtil::writeFile(tmpDir + "/blastp.sh", blastp_sh, blastp_sh_len);
         program = std::string(tmpDir + "/blastp.sh");